@@ -56,6 +56,28 @@
     # include "common.hpp"
     # include "common-stdap.hpp"
     # include "common-opencv.hpp"
+    # include "common-mapping.hpp"
+    # include "common-format.hpp"
+    # include "common-keyfile.hpp"
+    # include "common-matchfile.hpp"
+    # include "common-descfile.hpp"
+    # include "common-parser.hpp"
+    # include "common-writer.hpp"
+    # include "common-archive.hpp"
+    # include "common-database.hpp"
+    # include "common-store.hpp"
+    # include "common-brute.hpp"
+    # include "common-quantize.hpp"
+    # include "common-flann.hpp"
+    # include "common-filter.hpp"
+    # include "common-bucket.hpp"
+    # include "common-vptree.hpp"
+    # include "common-sketch.hpp"
+    # include "common-pca.hpp"
+    # include "common-lazy.hpp"
+    # include "common-kmeans.hpp"
+    # include "common-ivfpq.hpp"
+    # include "common-vocabulary.hpp"
 
 /* 
     Header - Preprocessor definitions
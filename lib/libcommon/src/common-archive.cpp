@@ -0,0 +1,362 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-archive.hpp"
+
+/*
+    Source - Coordinate quantization
+ */
+
+    static inline int64_t lc_archive_quantize( float const lcValue, float const lcStep ) {
+
+        /* Return quantized coordinate */
+        return( std::llround( ( double ) lcValue / lcStep ) );
+
+    }
+
+/*
+    Source - Coordinate validation
+ */
+
+    static inline bool lc_archive_valid( float const lcValue, float const lcStep ) {
+
+        /* Return quantization range inclusion - non-finite values excluded */
+        return( ( std::isfinite( lcValue ) == true ) && ( std::fabs( ( double ) lcValue / lcStep ) < LC_ARCHIVE_RANGE ) );
+
+    }
+
+/*
+    Source - Variable length integer encoding
+ */
+
+    static inline void lc_archive_encode( std::vector < uint8_t > & lcColumn, int64_t const lcValue ) {
+
+        /* Zigzag encoding of the sign */
+        uint64_t lcZigzag( ( ( uint64_t ) lcValue << 1 ) ^ ( uint64_t ) ( lcValue >> 63 ) );
+
+        /* Encode seven bits per byte */
+        while ( lcZigzag >= 0x80 ) {
+
+            /* Push byte with continuation bit */
+            lcColumn.push_back( ( lcZigzag & 0x7f ) | 0x80 );
+
+            /* Next bits */
+            lcZigzag >>= 7;
+
+        }
+
+        /* Push last byte */
+        lcColumn.push_back( lcZigzag );
+
+    }
+
+/*
+    Source - Variable length integer decoding
+ */
+
+    static inline uint8_t const * lc_archive_decode( uint8_t const * lcByte, uint8_t const * const lcStop, int64_t * const lcValue ) {
+
+        /* Decoding variables */
+        uint64_t lcZigzag( 0 );
+
+        /* Decode seven bits per byte */
+        for ( int lcShift( 0 ); ( lcByte < lcStop ) && ( lcShift < 64 ); lcShift += 7 ) {
+
+            /* Accumulate bits */
+            lcZigzag |= ( uint64_t ) ( * lcByte & 0x7f ) << lcShift;
+
+            /* Check continuation bit */
+            if ( ( * ( lcByte ++ ) & 0x80 ) == 0 ) {
+
+                /* Zigzag decoding of the sign */
+                * lcValue = ( int64_t ) ( lcZigzag >> 1 ) ^ - ( int64_t ) ( lcZigzag & 1 );
+
+                /* Return next position */
+                return( lcByte );
+
+            }
+
+        }
+
+        /* Send message */
+        return( NULL );
+
+    }
+
+/*
+    Source - Archive header verification
+ */
+
+    lc_Header_t const * lc_archive_check( lc_Map_t const * const lcMap ) {
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( ( lc_Header_t const * ) lcMap->data );
+
+        /* Description pointer variables */
+        lc_Archive_t const * lcArchive( ( lc_Archive_t const * ) ( lcMap->data + sizeof( lc_Header_t ) ) );
+
+        /* Verify identification string and mapping size */
+        if ( ( lc_format_detect( lcMap, LC_ARCHIVE_MAGIC ) == false ) || ( lcMap->size < sizeof( lc_Header_t ) + sizeof( lc_Archive_t ) ) ) return( NULL );
+
+        /* Verify version and layout */
+        if ( ( lcHeader->version != LC_FORMAT_VERSION ) || ( strncmp( lcHeader->layout, LC_ARCHIVE_LAYOUT, LC_FORMAT_LAYOUT ) != 0 ) ) return( NULL );
+
+        /* Verify record size */
+        if ( lcHeader->size != sizeof( lc_Match_t ) ) return( NULL );
+
+        /* Verify quantization step */
+        if ( ( lcArchive->step > 0.0 ) == false ) return( NULL );
+
+        /* Return header pointer */
+        return( lcHeader );
+
+    }
+
+/*
+    Source - Archive block compression
+ */
+
+    bool lc_archive_pack( lc_Writer_t * const lcWriter, lc_Match_t const * const lcMatch, size_t const lcCount, float const lcStep ) {
+
+        /* Columns variables */
+        std::vector < uint8_t > lcColumn[LC_ARCHIVE_COLUMN];
+
+        /* Compression buffer variables */
+        std::vector < uint8_t > lcPacked;
+
+        /* Block count variables */
+        uint32_t lcAmount( lcCount );
+
+        /* Delta encoding variables */
+        int64_t lcLast[4] = { 0, 0, 0, 0 };
+
+        /* Reserve columns memory */
+        for ( int lcIndex( 0 ); lcIndex < LC_ARCHIVE_COLUMN; lcIndex ++ ) lcColumn[lcIndex].reserve( lcCount * 3 );
+
+        /* Encode matches columns */
+        for ( size_t lcIndex( 0 ); lcIndex < lcCount; lcIndex ++ ) {
+
+            /* Check coordinates quantization */
+            if ( ( lc_archive_valid( lcMatch[lcIndex].ax, lcStep ) && lc_archive_valid( lcMatch[lcIndex].ay, lcStep ) && lc_archive_valid( lcMatch[lcIndex].bx, lcStep ) && lc_archive_valid( lcMatch[lcIndex].by, lcStep ) ) == false ) return( false );
+
+            /* Quantize coordinates */
+            int64_t lcAX( lc_archive_quantize( lcMatch[lcIndex].ax, lcStep ) );
+            int64_t lcAY( lc_archive_quantize( lcMatch[lcIndex].ay, lcStep ) );
+            int64_t lcBX( lc_archive_quantize( lcMatch[lcIndex].bx, lcStep ) );
+            int64_t lcBY( lc_archive_quantize( lcMatch[lcIndex].by, lcStep ) );
+
+            /* Encode delta indices */
+            lc_archive_encode( lcColumn[0], lcMatch[lcIndex].ai - lcLast[0] );
+            lc_archive_encode( lcColumn[1], lcMatch[lcIndex].bi - lcLast[1] );
+
+            /* Encode delta first image coordinates */
+            lc_archive_encode( lcColumn[2], lcAX - lcLast[2] );
+            lc_archive_encode( lcColumn[3], lcAY - lcLast[3] );
+
+            /* Encode second image coordinates relatively to first image */
+            lc_archive_encode( lcColumn[4], lcBX - lcAX );
+            lc_archive_encode( lcColumn[5], lcBY - lcAY );
+
+            /* Update delta references */
+            lcLast[0] = lcMatch[lcIndex].ai;
+            lcLast[1] = lcMatch[lcIndex].bi;
+            lcLast[2] = lcAX;
+            lcLast[3] = lcAY;
+
+        }
+
+        /* Export block count */
+        lc_writer_raw( lcWriter, & lcAmount, sizeof( uint32_t ) );
+
+        /* Compress and export columns */
+        for ( int lcIndex( 0 ); lcIndex < LC_ARCHIVE_COLUMN; lcIndex ++ ) {
+
+            /* Column sizes variables */
+            uLongf   lcBound( compressBound( lcColumn[lcIndex].size() ) );
+            uint32_t lcSize[2] = { ( uint32_t ) lcColumn[lcIndex].size(), 0 };
+
+            /* Allocate compression buffer */
+            lcPacked.resize( lcBound );
+
+            /* Compress column - fastest deflate level */
+            if ( compress2( lcPacked.data(), & lcBound, lcColumn[lcIndex].data(), lcColumn[lcIndex].size(), Z_BEST_SPEED ) != Z_OK ) return( false );
+
+            /* Check compression gain */
+            if ( lcBound < lcSize[0] ) {
+
+                /* Export compressed column */
+                lcSize[1] = lcBound;
+
+                /* Export column sizes and bytes */
+                lc_writer_raw( lcWriter, lcSize, sizeof( lcSize ) );
+                lc_writer_raw( lcWriter, lcPacked.data(), lcSize[1] );
+
+            } else {
+
+                /* Export stored column - equal sizes */
+                lcSize[1] = lcSize[0];
+
+                /* Export column sizes and bytes */
+                lc_writer_raw( lcWriter, lcSize, sizeof( lcSize ) );
+                lc_writer_raw( lcWriter, lcColumn[lcIndex].data(), lcSize[1] );
+
+            }
+
+        }
+
+        /* Return writer state */
+        return( lcWriter->valid );
+
+    }
+
+/*
+    Source - Archive block decompression
+ */
+
+    char const * lc_archive_unpack( char const * lcBlock, char const * const lcStop, float const lcStep, size_t const lcRemain, std::vector < lc_Match_t > & lcMatch ) {
+
+        /* Columns variables */
+        std::vector < uint8_t > lcColumn[LC_ARCHIVE_COLUMN];
+
+        /* Block count variables */
+        uint32_t lcAmount( 0 );
+
+        /* Column reading position variables */
+        uint8_t const * lcRead[LC_ARCHIVE_COLUMN];
+
+        /* Delta decoding variables */
+        int64_t lcLast[4] = { 0, 0, 0, 0 };
+
+        /* Check block count */
+        if ( lcStop - lcBlock < ( long ) sizeof( uint32_t ) ) return( NULL );
+
+        /* Read block count */
+        memcpy( & lcAmount, lcBlock, sizeof( uint32_t ) ); lcBlock += sizeof( uint32_t );
+
+        /* Validate block count - bounded by the block size and the archive count */
+        if ( ( lcAmount == 0 ) || ( lcAmount > LC_ARCHIVE_BLOCK ) || ( lcAmount > lcRemain ) ) return( NULL );
+
+        /* Decompress columns */
+        for ( int lcIndex( 0 ); lcIndex < LC_ARCHIVE_COLUMN; lcIndex ++ ) {
+
+            /* Column sizes variables */
+            uint32_t lcSize[2] = { 0, 0 };
+
+            /* Check column sizes */
+            if ( lcStop - lcBlock < ( long ) sizeof( lcSize ) ) return( NULL );
+
+            /* Read column sizes */
+            memcpy( lcSize, lcBlock, sizeof( lcSize ) ); lcBlock += sizeof( lcSize );
+
+            /* Check column bytes */
+            if ( lcStop - lcBlock < ( long ) lcSize[1] ) return( NULL );
+
+            /* Validate column size - one to LC_ARCHIVE_VARINT bytes per value */
+            if ( ( lcSize[0] < lcAmount ) || ( lcSize[0] > ( size_t ) lcAmount * LC_ARCHIVE_VARINT ) || ( lcSize[1] == 0 ) ) return( NULL );
+
+            /* Allocate column */
+            lcColumn[lcIndex].resize( lcSize[0] );
+
+            /* Check column storage */
+            if ( lcSize[1] == lcSize[0] ) {
+
+                /* Copy stored column */
+                memcpy( lcColumn[lcIndex].data(), lcBlock, lcSize[0] );
+
+            } else {
+
+                /* Decompressed size variables */
+                uLongf lcBound( lcSize[0] );
+
+                /* Decompress column - truncated and corrupted streams fail */
+                if ( ( uncompress( lcColumn[lcIndex].data(), & lcBound, ( Bytef const * ) lcBlock, lcSize[1] ) != Z_OK ) || ( lcBound != lcSize[0] ) ) return( NULL );
+
+            }
+
+            /* Assign column reading position */
+            lcRead[lcIndex] = lcColumn[lcIndex].data();
+
+            /* Next column */
+            lcBlock += lcSize[1];
+
+        }
+
+        /* Allocate matches array */
+        lcMatch.resize( lcAmount );
+
+        /* Decode matches columns */
+        for ( uint32_t lcIndex( 0 ); lcIndex < lcAmount; lcIndex ++ ) {
+
+            /* Decoded values variables */
+            int64_t lcValue[LC_ARCHIVE_COLUMN] = { 0 };
+
+            /* Decode columns values */
+            for ( int lcParse( 0 ); lcParse < LC_ARCHIVE_COLUMN; lcParse ++ ) {
+
+                /* Decode value */
+                if ( ( lcRead[lcParse] = lc_archive_decode( lcRead[lcParse], lcColumn[lcParse].data() + lcColumn[lcParse].size(), lcValue + lcParse ) ) == NULL ) return( NULL );
+
+            }
+
+            /* Undo delta encoding */
+            lcLast[0] += lcValue[0];
+            lcLast[1] += lcValue[1];
+            lcLast[2] += lcValue[2];
+            lcLast[3] += lcValue[3];
+
+            /* Assign match indices */
+            lcMatch[lcIndex].ai = lcLast[0];
+            lcMatch[lcIndex].bi = lcLast[1];
+
+            /* Assign match coordinates */
+            lcMatch[lcIndex].ax = ( double ) ( lcLast[2]              ) * lcStep;
+            lcMatch[lcIndex].ay = ( double ) ( lcLast[3]              ) * lcStep;
+            lcMatch[lcIndex].bx = ( double ) ( lcLast[2] + lcValue[4] ) * lcStep;
+            lcMatch[lcIndex].by = ( double ) ( lcLast[3] + lcValue[5] ) * lcStep;
+
+        }
+
+        /* Return next block position */
+        return( lcBlock );
+
+    }
+
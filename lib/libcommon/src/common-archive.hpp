@@ -0,0 +1,188 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-archive.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Compressed columnar matches archive
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_ARCHIVE__
+    # define __LC_ARCHIVE__
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.hpp"
+    # include "common-mapping.hpp"
+    # include "common-format.hpp"
+    # include "common-writer.hpp"
+    # include "common-matchfile.hpp"
+    # include <cmath>
+    # include <stdint.h>
+    # include <zlib.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define matches archive format */
+    # define LC_ARCHIVE_MAGIC   "FSMATARC"
+    # define LC_ARCHIVE_LAYOUT  "iffiff"
+
+    /* Define default quantization step */
+    # define LC_ARCHIVE_STEP    ( 1.0 / 64.0 )
+
+    /* Define nominal block size */
+    # define LC_ARCHIVE_BLOCK   65536
+
+    /* Define columns count */
+    # define LC_ARCHIVE_COLUMN  6
+
+    /* Define maximal encoded value size - bytes */
+    # define LC_ARCHIVE_VARINT  10
+
+    /* Define quantized coordinates range - deltas fit on 64 bits */
+    # define LC_ARCHIVE_RANGE   1.0e18
+
+/* 
+    Header - Preprocessor macros
+ */
+
+    /* Compute pointer to archive blocks */
+    # define LC_ARCHIVE_DATA(m) ( ( m ).data + sizeof( lc_Header_t ) + sizeof( lc_Archive_t ) )
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Archive_struct
+     *  \brief Archive description structure
+     *
+     *  Structure stored right after the binary header of matches archives. The
+     *  archive is made of blocks of matches stored column-wise. Keypoints
+     *  indices are delta-encoded. Coordinates are quantized on the archive
+     *  step, the first image ones being delta-encoded and the second image
+     *  ones being stored relatively to the first image ones. Each column is
+     *  then compressed using deflate.
+     *
+     *  \var lc_Archive_struct::step
+     *  Quantization step, in pixels, of the coordinates
+     *  \var lc_Archive_struct::block
+     *  Nominal amount of matches per block
+     *  \var lc_Archive_struct::reserved
+     *  Reserved bytes
+     */
+
+    typedef struct lc_Archive_struct {
+
+        float    step;
+        uint32_t block;
+        char     reserved[8];
+
+    } lc_Archive_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Archive header verification
+     *
+     *  This function verifies the binary header and the description of a
+     *  matches archive mapping.
+     *
+     *  \param  lcMap       Mapping of the archive
+     *
+     *  \return Returns a pointer to the mapped header on success, NULL
+     *  otherwise
+     */
+
+    lc_Header_t const * lc_archive_check ( lc_Map_t const * const lcMap );
+
+    /*! \brief Archive block compression
+     *
+     *  This function encodes the provided matches as a single archive block
+     *  and writes it through the provided writer. Matches with non-finite
+     *  coordinates, or coordinates out of the quantization range, are
+     *  rejected.
+     *
+     *  \param  lcWriter    Writer of the archive
+     *  \param  lcMatch     Pointer to the matches of the block
+     *  \param  lcCount     Amount of matches of the block
+     *  \param  lcStep      Quantization step of the coordinates
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_archive_pack ( lc_Writer_t * const lcWriter, lc_Match_t const * const lcMatch, size_t const lcCount, float const lcStep );
+
+    /*! \brief Archive block decompression
+     *
+     *  This function decodes the archive block starting at the provided
+     *  position. The decoded matches replace the content of the provided
+     *  array. Blocks are validated before any allocation : empty blocks,
+     *  blocks larger than LC_ARCHIVE_BLOCK or than the remaining matches of
+     *  the archive, inconsistent columns sizes and truncated or corrupted
+     *  columns are rejected.
+     *
+     *  \param  lcBlock     Position of the block
+     *  \param  lcStop      End of the archive (excluded)
+     *  \param  lcStep      Quantization step of the coordinates
+     *  \param  lcRemain    Amount of matches of the archive not decoded yet
+     *  \param  lcMatch     Array receiving the matches of the block
+     *
+     *  \return Returns the position of the next block, NULL on failure
+     */
+
+    char const * lc_archive_unpack ( char const * lcBlock, char const * const lcStop, float const lcStep, size_t const lcRemain, std::vector < lc_Match_t > & lcMatch );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,325 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-brute.hpp"
+
+/*
+    Source - Neighbours insertion
+ */
+
+    template < int K >
+    static inline void lc_brute_insert( float const lcScore, int const lcIndex, float * const lcBest, int * const lcNear ) {
+
+        /* Insertion position variables */
+        int lcPosition( K - 1 );
+
+        /* Check neighbour candidate */
+        if ( lcScore >= lcBest[K - 1] ) return;
+
+        /* Shift farther neighbours */
+        while ( ( lcPosition > 0 ) && ( lcScore < lcBest[lcPosition - 1] ) ) {
+
+            /* Shift neighbour */
+            lcBest[lcPosition] = lcBest[lcPosition - 1];
+            lcNear[lcPosition] = lcNear[lcPosition - 1];
+
+            /* Update position */
+            lcPosition --;
+
+        }
+
+        /* Insert neighbour */
+        lcBest[lcPosition] = lcScore;
+        lcNear[lcPosition] = lcIndex;
+
+    }
+
+/*
+    Source - Squared norm
+ */
+
+    template < typename T, typename A >
+    static inline A lc_brute_norm( T const * const lcRow, int const lcDimension ) {
+
+        /* Accumulation variables */
+        A lcNorm( 0 );
+
+        /* Accumulate squared components */
+        for ( int lcParse( 0 ); lcParse < lcDimension; lcParse ++ ) lcNorm += ( A ) lcRow[lcParse] * ( A ) lcRow[lcParse];
+
+        /* Return squared norm */
+        return( lcNorm );
+
+    }
+
+/*
+    Source - Blocked search kernel
+ */
+
+    template < typename T, typename A, int L, int D, int K >
+    static void lc_brute_search( cv::Mat const & lcQuery, cv::Mat const & lcTrain, int * const lcIndex, float * const lcDistance ) {
+
+        /* Dimension variables - compile-time constant for specialized kernels */
+        int const lcDimension( D > 0 ? D : lcQuery.cols );
+
+        /* Vectorized dimension variables */
+        int const lcVector( lcDimension - ( lcDimension % L ) );
+
+        /* Train descriptors squared norms */
+        std::vector < A > lcNorm( lcTrain.rows );
+
+        /* Compute train squared norms */
+        for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) lcNorm[lcParse] = lc_brute_norm < T, A > ( lcTrain.ptr < T > ( lcParse ), lcDimension );
+
+        /* Process query chunks */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic )
+        # endif
+        for ( int lcChunk = 0; lcChunk < lcQuery.rows; lcChunk += LC_BRUTE_CHUNK ) {
+
+            /* Chunk boundary variables */
+            int lcStop( std::min( lcChunk + LC_BRUTE_CHUNK, lcQuery.rows ) );
+
+            /* Chunk neighbours variables */
+            float lcBest[LC_BRUTE_CHUNK][K];
+            int   lcNear[LC_BRUTE_CHUNK][K];
+
+            /* Reset chunk neighbours */
+            for ( int lcParse( 0 ); lcParse < LC_BRUTE_CHUNK; lcParse ++ ) std::fill( lcBest[lcParse], lcBest[lcParse] + K, INFINITY ), std::fill( lcNear[lcParse], lcNear[lcParse] + K, -1 );
+
+            /* Process train blocks - the block stays in cache for the whole chunk */
+            for ( int lcBlock( 0 ); lcBlock < lcTrain.rows; lcBlock += LC_BRUTE_BLOCK ) {
+
+                /* Block boundary variables */
+                int lcEnd( std::min( lcBlock + LC_BRUTE_BLOCK, lcTrain.rows ) );
+
+                /* Process query tiles */
+                for ( int lcTile( lcChunk ); lcTile < lcStop; lcTile += LC_BRUTE_QUERY ) {
+
+                    /* Query rows variables */
+                    T const * lcRow[LC_BRUTE_QUERY];
+
+                    /* Assign query rows - incomplete tiles repeat the last row */
+                    for ( int lcQ( 0 ); lcQ < LC_BRUTE_QUERY; lcQ ++ ) lcRow[lcQ] = lcQuery.ptr < T > ( std::min( lcTile + lcQ, lcStop - 1 ) );
+
+                    /* Process train tiles */
+                    for ( int lcParse( lcBlock ); lcParse < lcEnd; lcParse += LC_BRUTE_TRAIN ) {
+
+                        /* Accumulators variables */
+                        A lcAccum[LC_BRUTE_QUERY][LC_BRUTE_TRAIN][L] = { { { 0 } } };
+
+                        /* Train rows variables */
+                        T const * lcSample[LC_BRUTE_TRAIN];
+
+                        /* Assign train rows - incomplete tiles repeat the last row */
+                        for ( int lcT( 0 ); lcT < LC_BRUTE_TRAIN; lcT ++ ) lcSample[lcT] = lcTrain.ptr < T > ( std::min( lcParse + lcT, lcEnd - 1 ) );
+
+                        /* Accumulate dot products by independent lanes */
+                        for ( int lcD( 0 ); lcD < lcVector; lcD += L ) {
+
+                            /* Accumulate tile */
+                            for ( int lcQ( 0 ); lcQ < LC_BRUTE_QUERY; lcQ ++ ) for ( int lcT( 0 ); lcT < LC_BRUTE_TRAIN; lcT ++ ) for ( int lcL( 0 ); lcL < L; lcL ++ ) lcAccum[lcQ][lcT][lcL] += ( A ) lcRow[lcQ][lcD + lcL] * ( A ) lcSample[lcT][lcD + lcL];
+
+                        }
+
+                        /* Accumulate remaining components */
+                        for ( int lcD( lcVector ); lcD < lcDimension; lcD ++ ) {
+
+                            /* Accumulate tile */
+                            for ( int lcQ( 0 ); lcQ < LC_BRUTE_QUERY; lcQ ++ ) for ( int lcT( 0 ); lcT < LC_BRUTE_TRAIN; lcT ++ ) lcAccum[lcQ][lcT][0] += ( A ) lcRow[lcQ][lcD] * ( A ) lcSample[lcT][lcD];
+
+                        }
+
+                        /* Select neighbours of the tile */
+                        for ( int lcQ( 0 ); ( lcQ < LC_BRUTE_QUERY ) && ( lcTile + lcQ < lcStop ); lcQ ++ ) {
+
+                            /* Process train descriptors of the tile */
+                            for ( int lcT( 0 ); ( lcT < LC_BRUTE_TRAIN ) && ( lcParse + lcT < lcEnd ); lcT ++ ) {
+
+                                /* Dot product variables */
+                                A lcDot( 0 );
+
+                                /* Reduce lanes */
+                                for ( int lcL( 0 ); lcL < L; lcL ++ ) lcDot += lcAccum[lcQ][lcT][lcL];
+
+                                /* Insert candidate - the query norm does not change the ordering */
+                                lc_brute_insert < K > ( ( float ) ( lcNorm[lcParse + lcT] - 2 * lcDot ), lcParse + lcT, lcBest[lcTile + lcQ - lcChunk], lcNear[lcTile + lcQ - lcChunk] );
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            /* Export chunk neighbours */
+            for ( int lcParse( lcChunk ); lcParse < lcStop; lcParse ++ ) {
+
+                /* Query squared norm variables */
+                float lcSelf( lc_brute_norm < T, A > ( lcQuery.ptr < T > ( lcParse ), lcDimension ) );
+
+                /* Export neighbours with euclidean distances */
+                for ( int lcK( 0 ); lcK < K; lcK ++ ) {
+
+                    /* Assign neighbour index */
+                    lcIndex[lcParse * K + lcK] = lcNear[lcParse - lcChunk][lcK];
+
+                    /* Assign neighbour distance - rounding may produce small negative values */
+                    lcDistance[lcParse * K + lcK] = std::sqrt( std::max( lcBest[lcParse - lcChunk][lcK] + lcSelf, 0.0f ) );
+
+                }
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Kernel selection
+ */
+
+    template < typename T, typename A, int L, int K >
+    static void lc_brute_dimension( cv::Mat const & lcQuery, cv::Mat const & lcTrain, int * const lcIndex, float * const lcDistance ) {
+
+        /* Select kernel according to descriptors dimension */
+        switch ( lcQuery.cols ) {
+
+            /* SURF descriptors */
+            case (  64 ) : { lc_brute_search < T, A, L,  64, K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+            /* SIFT and extended SURF descriptors */
+            case ( 128 ) : { lc_brute_search < T, A, L, 128, K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+            /* Other dimensions */
+            default      : { lc_brute_search < T, A, L,   0, K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+        }
+
+    }
+
+    template < int K >
+    static void lc_brute_dispatch( cv::Mat const & lcQuery, cv::Mat const & lcTrain, int * const lcIndex, float * const lcDistance ) {
+
+        /* Select kernel according to descriptors components type */
+        switch ( lcQuery.type() ) {
+
+            /* Floating point descriptors */
+            case ( CV_32FC1 ) : { lc_brute_dimension < float  , float  , LC_BRUTE_LANE , K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+            /* Unsigned quantized descriptors - integer accumulation */
+            case ( CV_8UC1  ) : { lc_brute_dimension < uint8_t, int32_t, LC_BRUTE_ILANE, K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+            /* Signed quantized descriptors - integer accumulation */
+            case ( CV_8SC1  ) : { lc_brute_dimension < int8_t , int32_t, LC_BRUTE_ILANE, K > ( lcQuery, lcTrain, lcIndex, lcDistance ); } break;
+
+        }
+
+    }
+
+/*
+    Source - Exact nearest neighbours search
+ */
+
+    void lc_brute_knn( cv::Mat const & lcQuery, cv::Mat const & lcTrain, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK ) {
+
+        /* Neighbours amount variables */
+        int lcCount( std::max( 1, std::min( lcK, LC_BRUTE_K ) ) );
+
+        /* Neighbours variables */
+        std::vector < int   > lcIndex   ( ( size_t ) lcQuery.rows * lcCount );
+        std::vector < float > lcDistance( ( size_t ) lcQuery.rows * lcCount );
+
+        /* Reset matches array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check descriptors consistency */
+        if ( ( lcQuery.rows == 0 ) || ( lcTrain.rows == 0 ) || ( lcQuery.cols != lcTrain.cols ) || ( lcQuery.type() != lcTrain.type() ) ) return;
+
+        /* Check descriptors components type */
+        if ( ( lcQuery.type() != CV_32FC1 ) && ( lcQuery.type() != CV_8UC1 ) && ( lcQuery.type() != CV_8SC1 ) ) return;
+
+        /* Search neighbours */
+        if ( lcCount == 1 ) lc_brute_dispatch < 1 > ( lcQuery, lcTrain, lcIndex.data(), lcDistance.data() );
+        else                lc_brute_dispatch < 2 > ( lcQuery, lcTrain, lcIndex.data(), lcDistance.data() );
+
+        /* Convert neighbours */
+        for ( int lcParse( 0 ); lcParse < lcQuery.rows; lcParse ++ ) {
+
+            /* Convert neighbours of query */
+            for ( int lcNeighbour( 0 ); lcNeighbour < lcCount; lcNeighbour ++ ) {
+
+                /* Check neighbour - less train descriptors than neighbours */
+                if ( lcIndex[lcParse * lcCount + lcNeighbour] < 0 ) continue;
+
+                /* Push neighbour */
+                lcMatch[lcParse].push_back( cv::DMatch( lcParse, lcIndex[lcParse * lcCount + lcNeighbour], lcDistance[lcParse * lcCount + lcNeighbour] ) );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Exact nearest neighbour search
+ */
+
+    void lc_brute_match( cv::Mat const & lcQuery, cv::Mat const & lcTrain, std::vector < cv::DMatch > & lcMatch ) {
+
+        /* Neighbours variables */
+        std::vector < std::vector < cv::DMatch > > lcNeighbour;
+
+        /* Search nearest neighbours */
+        lc_brute_knn( lcQuery, lcTrain, lcNeighbour, 1 );
+
+        /* Reset matches array */
+        lcMatch.clear();
+
+        /* Gather nearest neighbours */
+        for ( size_t lcParse( 0 ); lcParse < lcNeighbour.size(); lcParse ++ ) if ( lcNeighbour[lcParse].empty() == false ) lcMatch.push_back( lcNeighbour[lcParse][0] );
+
+    }
+
@@ -0,0 +1,142 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-brute.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Exact brute-force descriptors matcher
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_BRUTE__
+    # define __LC_BRUTE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <vector>
+    # include <algorithm>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define register tile - queries and train descriptors */
+    # define LC_BRUTE_QUERY 8
+    # define LC_BRUTE_TRAIN 2
+
+    /* Define accumulation lanes - floating point and integer */
+    # define LC_BRUTE_LANE  8
+    # define LC_BRUTE_ILANE 16
+
+    /* Define cache blocks - train descriptors and queries */
+    # define LC_BRUTE_BLOCK 256
+    # define LC_BRUTE_CHUNK 64
+
+    /* Define maximum amount of neighbours */
+    # define LC_BRUTE_K     2
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Exact nearest neighbours search
+     *
+     *  This function searches, for each query descriptor, the nearest train
+     *  descriptors according to the euclidean distance. The distances are
+     *  computed as a blocked matrix product using the identity |a-b|^2 =
+     *  |a|^2 + |b|^2 - 2a.b : the train descriptors are processed by blocks
+     *  that stay in cache while register tiles of query and train descriptors
+     *  are accumulated. The selection of the nearest neighbours is performed
+     *  in the distance kernel so that no distance matrix is stored. Kernels
+     *  are specialized for 64 (SURF) and 128 (SIFT) components.
+     *
+     *  Quantized descriptors (CV_8U or CV_8S) are accumulated on 32 bits
+     *  integers, reading four times less memory than floating point ones. For
+     *  such descriptors, the distances are expressed in quantized units.
+     *
+     *  The neighbours of each query are sorted by increasing distance, the
+     *  distances being euclidean, as with cv::BFMatcher.
+     *
+     *  \param  lcQuery     Query descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcTrain     Train descriptors matrix, of the query type
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     *  \param  lcK         Amount of neighbours, at most LC_BRUTE_K
+     */
+
+    void lc_brute_knn ( cv::Mat const & lcQuery, cv::Mat const & lcTrain, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK );
+
+    /*! \brief Exact nearest neighbour search
+     *
+     *  This function searches the nearest train descriptor of each query
+     *  descriptor. It is the single neighbour form of \b lc_brute_knn and
+     *  gives the matches in the format of cv::DescriptorMatcher::match.
+     *
+     *  \param  lcQuery     Query descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcTrain     Train descriptors matrix, of the query type
+     *  \param  lcMatch     Array receiving the matches
+     */
+
+    void lc_brute_match ( cv::Mat const & lcQuery, cv::Mat const & lcTrain, std::vector < cv::DMatch > & lcMatch );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,221 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-bucket.hpp"
+
+/*
+    Source - Keypoint octave
+ */
+
+    int lc_bucket_octave( cv::KeyPoint const & lcKey ) {
+
+        /* Return lower signed byte of octave field */
+        return( ( int ) ( signed char ) ( lcKey.octave & 255 ) );
+
+    }
+
+/*
+    Source - Bucketed nearest neighbours search
+ */
+
+    void lc_bucket_knn( cv::Mat const & lcQuery, std::vector < cv::KeyPoint > const & lcQueryKey, cv::Mat const & lcTrain, std::vector < cv::KeyPoint > const & lcTrainKey, int const lcOctave, float const lcAngle, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK ) {
+
+        /* Orientation bins variables - last bin holds keypoints without orientation */
+        int lcBins( ( ( lcAngle > 0.0 ) && ( lcAngle < 120.0 ) ) ? ( int ) ( 360.0 / lcAngle ) : 1 );
+
+        /* Octave range variables */
+        int lcLow ( 0 );
+        int lcHigh( 0 );
+
+        /* Row size variables */
+        size_t lcRow( lcTrain.cols * lcTrain.elemSize() );
+
+        /* Buckets variables */
+        std::vector < std::vector < int > > lcBucket;
+
+        /* Query groups variables */
+        std::map < std::pair < int, int >, std::vector < int > > lcGroup;
+
+        /* Query groups array */
+        std::vector < std::pair < std::pair < int, int >, std::vector < int > > > lcList;
+
+        /* Reset neighbours array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check descriptors */
+        if ( ( lcQuery.rows == 0 ) || ( lcTrain.rows == 0 ) ) return;
+
+        /* Compute train octave range */
+        for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) {
+
+            /* Keypoint octave variables */
+            int lcLevel( ( lcOctave < 0 ) ? 0 : lc_bucket_octave( lcTrainKey[lcParse] ) );
+
+            /* Update octave range */
+            if ( ( lcParse == 0 ) || ( lcLevel < lcLow  ) ) lcLow  = lcLevel;
+            if ( ( lcParse == 0 ) || ( lcLevel > lcHigh ) ) lcHigh = lcLevel;
+
+        }
+
+        /* Create buckets */
+        lcBucket.resize( ( size_t ) ( lcHigh - lcLow + 1 ) * ( lcBins + 1 ) );
+
+        /* Bucket train keypoints */
+        for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) {
+
+            /* Keypoint bucket variables */
+            int lcLevel( ( lcOctave < 0 ) ? 0 : lc_bucket_octave( lcTrainKey[lcParse] ) );
+            int lcBin  ( ( lcTrainKey[lcParse].angle < 0.0 ) ? lcBins : ( ( int ) ( lcTrainKey[lcParse].angle * lcBins / 360.0 ) ) % lcBins );
+
+            /* Push keypoint in bucket */
+            lcBucket[( size_t ) ( lcLevel - lcLow ) * ( lcBins + 1 ) + lcBin].push_back( lcParse );
+
+        }
+
+        /* Group queries by bucket */
+        for ( int lcParse( 0 ); lcParse < lcQuery.rows; lcParse ++ ) {
+
+            /* Keypoint bucket variables */
+            int lcLevel( ( lcOctave < 0 ) ? 0 : lc_bucket_octave( lcQueryKey[lcParse] ) );
+            int lcBin  ( ( lcQueryKey[lcParse].angle < 0.0 ) ? lcBins : ( ( int ) ( lcQueryKey[lcParse].angle * lcBins / 360.0 ) ) % lcBins );
+
+            /* Push query in group */
+            lcGroup[std::make_pair( lcLevel, lcBin )].push_back( lcParse );
+
+        }
+
+        /* Convert query groups */
+        lcList.assign( lcGroup.begin(), lcGroup.end() );
+
+        /* Search neighbours of query groups */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic )
+        # endif
+        for ( int lcParse = 0; lcParse < ( int ) lcList.size(); lcParse ++ ) {
+
+            /* Group variables */
+            int lcLevel( lcList[lcParse].first.first  );
+            int lcBin  ( lcList[lcParse].first.second );
+
+            /* Group queries */
+            std::vector < int > const & lcMember( lcList[lcParse].second );
+
+            /* Compatible bins variables */
+            std::vector < char > lcUse( lcBins + 1, 0 );
+
+            /* Candidates variables */
+            std::vector < int > lcCandidate;
+
+            /* Group descriptors matrix */
+            cv::Mat lcSubQuery( lcMember.size(), lcQuery.cols, lcQuery.type() );
+            cv::Mat lcSubTrain;
+
+            /* Group neighbours array */
+            std::vector < std::vector < cv::DMatch > > lcNeighbour;
+
+            /* Select compatible bins - keypoints without orientation are compatible with all bins */
+            if ( lcBin == lcBins ) lcUse.assign( lcBins + 1, 1 ); else lcUse[lcBin] = lcUse[( lcBin + 1 ) % lcBins] = lcUse[( lcBin + lcBins - 1 ) % lcBins] = lcUse[lcBins] = 1;
+
+            /* Gather candidates of compatible buckets */
+            for ( int lcStep( std::max( lcLevel - std::max( lcOctave, 0 ), lcLow ) ); lcStep <= std::min( lcLevel + std::max( lcOctave, 0 ), lcHigh ); lcStep ++ ) {
+
+                /* Parse orientation bins */
+                for ( int lcUnit( 0 ); lcUnit <= lcBins; lcUnit ++ ) {
+
+                    /* Check bin compatibility */
+                    if ( lcUse[lcUnit] == 0 ) continue;
+
+                    /* Bucket variables */
+                    std::vector < int > const & lcItem( lcBucket[( size_t ) ( lcStep - lcLow ) * ( lcBins + 1 ) + lcUnit] );
+
+                    /* Push bucket candidates */
+                    lcCandidate.insert( lcCandidate.end(), lcItem.begin(), lcItem.end() );
+
+                }
+
+            }
+
+            /* Check candidates - full scan on insufficient buckets */
+            if ( ( int ) lcCandidate.size() < std::min( lcK, lcTrain.rows ) ) {
+
+                /* Select all train descriptors */
+                lcCandidate.resize( lcTrain.rows );
+
+                /* Assign train indexes */
+                for ( int lcIndex( 0 ); lcIndex < lcTrain.rows; lcIndex ++ ) lcCandidate[lcIndex] = lcIndex;
+
+            }
+
+            /* Create candidates matrix */
+            lcSubTrain.create( lcCandidate.size(), lcTrain.cols, lcTrain.type() );
+
+            /* Gather group descriptors */
+            for ( size_t lcIndex( 0 ); lcIndex < lcMember.size(); lcIndex ++ ) memcpy( lcSubQuery.ptr < unsigned char > ( lcIndex ), lcQuery.ptr < unsigned char > ( lcMember[lcIndex] ), lcRow );
+
+            /* Gather candidates descriptors */
+            for ( size_t lcIndex( 0 ); lcIndex < lcCandidate.size(); lcIndex ++ ) memcpy( lcSubTrain.ptr < unsigned char > ( lcIndex ), lcTrain.ptr < unsigned char > ( lcCandidate[lcIndex] ), lcRow );
+
+            /* Exact search among candidates */
+            lc_brute_knn( lcSubQuery, lcSubTrain, lcNeighbour, lcK );
+
+            /* Restore query and train indexes */
+            for ( size_t lcIndex( 0 ); lcIndex < lcMember.size(); lcIndex ++ ) {
+
+                /* Parse neighbours */
+                for ( size_t lcNear( 0 ); lcNear < lcNeighbour[lcIndex].size(); lcNear ++ ) {
+
+                    /* Restore indexes */
+                    lcNeighbour[lcIndex][lcNear].queryIdx = lcMember[lcIndex];
+                    lcNeighbour[lcIndex][lcNear].trainIdx = lcCandidate[lcNeighbour[lcIndex][lcNear].trainIdx];
+
+                }
+
+                /* Assign query neighbours */
+                lcMatch[lcMember[lcIndex]].swap( lcNeighbour[lcIndex] );
+
+            }
+
+        }
+
+    }
+
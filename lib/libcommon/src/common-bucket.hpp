@@ -0,0 +1,132 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-bucket.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Scale and orientation bucketed search
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_BUCKET__
+    # define __LC_BUCKET__
+
+/* 
+    Header - Includes
+ */
+
+    # include <map>
+    # include <vector>
+    # include "common.hpp"
+    # include "common-brute.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define default tolerances - octaves and degrees */
+    # define LC_BUCKET_OCTAVE 1
+    # define LC_BUCKET_ANGLE  30.0
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Keypoint octave
+     *
+     *  This function returns the octave of a keypoint. The OpenCV SIFT packs
+     *  the layer and the octave in the keypoint octave field, the octave being
+     *  the lower signed byte. Plain octaves, as given by the OpenCV SURF, are
+     *  left unchanged.
+     *
+     *  \param  lcKey       Keypoint
+     *
+     *  \return Returns the keypoint octave
+     */
+
+    int lc_bucket_octave ( cv::KeyPoint const & lcKey );
+
+    /*! \brief Bucketed nearest neighbours search
+     *
+     *  This function searches, for each query descriptor, the nearest train
+     *  descriptors among the train keypoints of compatible scale and
+     *  orientation. Train keypoints are bucketed by octave and by orientation
+     *  bin, the width of a bin being at least the angle tolerance. Queries
+     *  sharing a bucket are searched together, by \b lc_brute_knn, among the
+     *  train descriptors of the buckets within the octave tolerance and of the
+     *  neighbouring orientation bins. Keypoints without orientation are
+     *  compatible with all bins. When the compatible buckets hold less than the
+     *  requested amount of neighbours, all train descriptors are scanned.
+     *
+     *  A negative octave tolerance disables the scale bucketing and an angle
+     *  tolerance that is not in ]0,120[ disables the orientation bucketing.
+     *
+     *  \param  lcQuery     Query descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcQueryKey  Query keypoints array
+     *  \param  lcTrain     Train descriptors matrix, of the query type
+     *  \param  lcTrainKey  Train keypoints array
+     *  \param  lcOctave    Octave tolerance
+     *  \param  lcAngle     Angle tolerance, in degrees
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     *  \param  lcK         Amount of neighbours, at most LC_BRUTE_K
+     */
+
+    void lc_bucket_knn ( cv::Mat const & lcQuery, std::vector < cv::KeyPoint > const & lcQueryKey, cv::Mat const & lcTrain, std::vector < cv::KeyPoint > const & lcTrainKey, int const lcOctave, float const lcAngle, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
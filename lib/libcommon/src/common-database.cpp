@@ -0,0 +1,693 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-database.hpp"
+
+/*
+    Source - Positioned reading
+ */
+
+    static bool lc_database_read( int const lcHandle, void * const lcData, size_t const lcSize, uint64_t const lcOffset ) {
+
+        /* Read bytes variables */
+        size_t lcRead( 0 );
+
+        /* Read requested bytes */
+        while ( lcRead < lcSize ) {
+
+            /* Read call variables */
+            ssize_t lcCall( pread( lcHandle, ( char * ) lcData + lcRead, lcSize - lcRead, lcOffset + lcRead ) );
+
+            /* Check read call - interrupted calls are repeated */
+            if ( lcCall == 0 ) return( false ); else if ( lcCall > 0 ) lcRead += lcCall; else if ( errno != EINTR ) return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Positioned writing
+ */
+
+    static bool lc_database_write( int const lcHandle, void const * const lcData, size_t const lcSize, uint64_t const lcOffset ) {
+
+        /* Written bytes variables */
+        size_t lcWritten( 0 );
+
+        /* Write requested bytes */
+        while ( lcWritten < lcSize ) {
+
+            /* Write call variables */
+            ssize_t lcCall( pwrite( lcHandle, ( char const * ) lcData + lcWritten, lcSize - lcWritten, lcOffset + lcWritten ) );
+
+            /* Check write call - interrupted calls are repeated */
+            if ( lcCall >= 0 ) lcWritten += lcCall; else if ( errno != EINTR ) return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Images names hash
+ */
+
+    static uint64_t lc_database_hash( char const * const lcImageA, char const * const lcImageB ) {
+
+        /* Hash variables - FNV-1a */
+        uint64_t lcHash( 14695981039346656037ULL );
+
+        /* Hash first name and its terminator */
+        for ( char const * lcChar( lcImageA ); ; lcChar ++ ) { lcHash = ( lcHash ^ ( uint8_t ) * lcChar ) * 1099511628211ULL; if ( * lcChar == '\0' ) break; }
+
+        /* Hash second name */
+        for ( char const * lcChar( lcImageB ); * lcChar != '\0'; lcChar ++ ) lcHash = ( lcHash ^ ( uint8_t ) * lcChar ) * 1099511628211ULL;
+
+        /* Return hash */
+        return( lcHash );
+
+    }
+
+/*
+    Source - Entry names padded size
+ */
+
+    static inline uint64_t lc_database_names( lc_Entry_t const & lcEntry ) {
+
+        /* Return names size padded on eight bytes */
+        return( ( ( uint64_t ) lcEntry.sizea + lcEntry.sizeb + 7 ) & ~ ( uint64_t ) 7 );
+
+    }
+
+/*
+    Source - Index header reading
+ */
+
+    static bool lc_database_capacity( int const lcIndex, uint64_t * const lcCapacity ) {
+
+        /* Header variables */
+        lc_Header_t lcHeader;
+
+        /* Read index header */
+        if ( lc_database_read( lcIndex, & lcHeader, sizeof( lc_Header_t ), 0 ) == false ) return( false );
+
+        /* Verify index header */
+        if ( strncmp( lcHeader.magic, LC_DATABASE_IMAGIC, LC_FORMAT_MAGIC ) != 0 ) return( false );
+
+        /* Verify capacity - power of two */
+        if ( ( lcHeader.count == 0 ) || ( ( lcHeader.count & ( lcHeader.count - 1 ) ) != 0 ) ) return( false );
+
+        /* Assign index capacity */
+        * lcCapacity = lcHeader.count;
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Index storage
+ */
+
+    static bool lc_database_store( std::string const & lcPath, std::vector < lc_Slot_t > const & lcSlot ) {
+
+        /* Index header variables */
+        lc_Header_t lcHeader( lc_format_header( LC_DATABASE_IMAGIC, LC_DATABASE_ILAYOU, 1, lcSlot.size() ) );
+
+        /* Temporary path variables */
+        std::string lcTemporary( lcPath + ".tmp" );
+
+        /* Writing status variables */
+        bool lcReturn( true );
+
+        /* Create temporary index */
+        int lcIndex( open( lcTemporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 ) );
+
+        /* Check index creation */
+        if ( lcIndex < 0 ) return( false );
+
+        /* Export header and slots */
+        lcReturn &= lc_database_write( lcIndex, & lcHeader, sizeof( lc_Header_t ), 0 );
+        lcReturn &= lc_database_write( lcIndex, lcSlot.data(), lcSlot.size() * sizeof( lc_Slot_t ), sizeof( lc_Header_t ) );
+
+        /* Close temporary index */
+        if ( close( lcIndex ) != 0 ) lcReturn = false;
+
+        /* Replace index atomically */
+        if ( lcReturn == true ) lcReturn = ( rename( lcTemporary.c_str(), lcPath.c_str() ) == 0 );
+
+        /* Return storage status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Index probing
+ */
+
+    static bool lc_database_probe( int const lcHandle, int const lcIndex, uint64_t const lcCapacity, char const * const lcImageA, char const * const lcImageB, uint64_t * const lcPosition, lc_Slot_t * const lcSlot, bool * const lcFound ) {
+
+        /* Hash variables */
+        uint64_t lcHash( lc_database_hash( lcImageA, lcImageB ) );
+
+        /* Names comparison variables */
+        std::vector < char > lcNames;
+
+        /* Probe slots from hash position */
+        for ( uint64_t lcProbe( 0 ); lcProbe < lcCapacity; lcProbe ++ ) {
+
+            /* Compute slot position */
+            * lcPosition = ( lcHash + lcProbe ) & ( lcCapacity - 1 );
+
+            /* Read slot */
+            if ( lc_database_read( lcIndex, lcSlot, sizeof( lc_Slot_t ), sizeof( lc_Header_t ) + ( * lcPosition ) * sizeof( lc_Slot_t ) ) == false ) return( false );
+
+            /* Check empty slot */
+            if ( lcSlot->offset == 0 ) {
+
+                /* Pair not found */
+                * lcFound = false;
+
+                /* Assign slot hash */
+                lcSlot->hash = lcHash;
+
+                /* Send message */
+                return( true );
+
+            }
+
+            /* Check slot hash */
+            if ( lcSlot->hash == lcHash ) {
+
+                /* Entry variables */
+                lc_Entry_t lcEntry;
+
+                /* Read entry */
+                if ( lc_database_read( lcHandle, & lcEntry, sizeof( lc_Entry_t ), lcSlot->offset ) == false ) return( false );
+
+                /* Compare names lengths */
+                if ( ( lcEntry.sizea == strlen( lcImageA ) ) && ( lcEntry.sizeb == strlen( lcImageB ) ) ) {
+
+                    /* Allocate names */
+                    lcNames.resize( lcEntry.sizea + lcEntry.sizeb + 1 );
+
+                    /* Read names */
+                    if ( lc_database_read( lcHandle, lcNames.data(), lcNames.size() - 1, lcSlot->offset + sizeof( lc_Entry_t ) ) == false ) return( false );
+
+                    /* Compare names */
+                    if ( ( memcmp( lcNames.data(), lcImageA, lcEntry.sizea ) == 0 ) && ( memcmp( lcNames.data() + lcEntry.sizea, lcImageB, lcEntry.sizeb ) == 0 ) ) {
+
+                        /* Pair found */
+                        * lcFound = true;
+
+                        /* Send message */
+                        return( true );
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* Send message - saturated index */
+        return( false );
+
+    }
+
+/*
+    Source - Index enlargement
+ */
+
+    static bool lc_database_rebuild( lc_Database_t * const lcDatabase, int const lcIndex, uint64_t const lcCapacity ) {
+
+        /* Slots variables */
+        std::vector < lc_Slot_t > lcSlot( lcCapacity );
+        std::vector < lc_Slot_t > lcGrow( lcCapacity * 2 );
+
+        /* Read current slots */
+        if ( lc_database_read( lcIndex, lcSlot.data(), lcSlot.size() * sizeof( lc_Slot_t ), sizeof( lc_Header_t ) ) == false ) return( false );
+
+        /* Rehash used slots */
+        for ( uint64_t lcParse( 0 ); lcParse < lcCapacity; lcParse ++ ) {
+
+            /* Check used slot */
+            if ( lcSlot[lcParse].offset == 0 ) continue;
+
+            /* Search empty slot - keys are unique */
+            for ( uint64_t lcProbe( lcSlot[lcParse].hash ); ; lcProbe ++ ) {
+
+                /* Check slot */
+                if ( lcGrow[lcProbe & ( lcGrow.size() - 1 )].offset == 0 ) {
+
+                    /* Assign slot */
+                    lcGrow[lcProbe & ( lcGrow.size() - 1 )] = lcSlot[lcParse];
+
+                    /* Abort search */
+                    break;
+
+                }
+
+            }
+
+        }
+
+        /* Store enlarged index */
+        return( lc_database_store( lcDatabase->index, lcGrow ) );
+
+    }
+
+/*
+    Source - Database opening
+ */
+
+    bool lc_database_open( char const * const lcPath, lc_Database_t * const lcDatabase, int const lcMode ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Header variables */
+        lc_Header_t lcHeader;
+
+        /* Opening status variables */
+        bool lcReturn( true );
+
+        /* Assign index path */
+        lcDatabase->index = std::string( lcPath ) + LC_DATABASE_INDEX;
+
+        /* Open data file */
+        if ( ( lcDatabase->handle = open( lcPath, lcMode == LC_DATABASE_WRITE ? O_RDWR | O_CREAT : O_RDONLY, 0644 ) ) < 0 ) return( false );
+
+        /* Lock database */
+        if ( flock( lcDatabase->handle, lcMode == LC_DATABASE_WRITE ? LOCK_EX : LOCK_SH ) != 0 ) {
+
+            /* Release data file */
+            lc_database_close( lcDatabase );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Retrieve data file size */
+        if ( fstat( lcDatabase->handle, & lcStat ) != 0 ) {
+
+            /* Update opening status */
+            lcReturn = false;
+
+        } else if ( ( lcStat.st_size == 0 ) && ( lcMode == LC_DATABASE_WRITE ) ) {
+
+            /* Create data header and empty index */
+            lcHeader = lc_format_header( LC_DATABASE_MAGIC, LC_DATABASE_LAYOUT, 1, 0 );
+
+            /* Export data header and empty index */
+            lcReturn = lc_database_write( lcDatabase->handle, & lcHeader, sizeof( lc_Header_t ), 0 ) && lc_database_store( lcDatabase->index, std::vector < lc_Slot_t > ( LC_DATABASE_SLOTS ) );
+
+        } else {
+
+            /* Read and verify data header */
+            lcReturn = ( lc_database_read( lcDatabase->handle, & lcHeader, sizeof( lc_Header_t ), 0 ) == true ) &&
+                       ( strncmp( lcHeader.magic , LC_DATABASE_MAGIC , LC_FORMAT_MAGIC  ) == 0 ) &&
+                       ( strncmp( lcHeader.layout, LC_DATABASE_LAYOUT, LC_FORMAT_LAYOUT ) == 0 ) &&
+                       ( lcHeader.version == LC_FORMAT_VERSION );
+
+        }
+
+        /* Unlock database */
+        flock( lcDatabase->handle, LOCK_UN );
+
+        /* Check opening status */
+        if ( lcReturn == false ) lc_database_close( lcDatabase );
+
+        /* Return opening status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Database closure
+ */
+
+    void lc_database_close( lc_Database_t * const lcDatabase ) {
+
+        /* Release descriptor */
+        if ( lcDatabase->handle >= 0 ) close( lcDatabase->handle );
+
+        /* Reset database structure */
+        lcDatabase->handle = -1;
+
+    }
+
+/*
+    Source - Database pair insertion
+ */
+
+    bool lc_database_insert( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, std::vector < lc_Match_t > const & lcMatch, uint32_t const lcFlags ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Header variables */
+        lc_Header_t lcHeader;
+
+        /* Entry variables */
+        lc_Entry_t lcEntry = { lcMatch.size(), ( uint32_t ) strlen( lcImageA ), ( uint32_t ) strlen( lcImageB ), lcFlags, { 0 } };
+
+        /* Entry names variables */
+        std::vector < char > lcNames( lc_database_names( lcEntry ), 0 );
+
+        /* Index variables */
+        int      lcIndex   ( -1 );
+        uint64_t lcCapacity( 0 );
+        uint64_t lcPosition( 0 );
+
+        /* Slot variables */
+        lc_Slot_t lcSlot;
+        bool      lcFound( false );
+
+        /* Insertion status variables */
+        bool lcReturn( false );
+
+        /* Compose padded names */
+        memcpy( lcNames.data(), lcImageA, lcEntry.sizea );
+        memcpy( lcNames.data() + lcEntry.sizea, lcImageB, lcEntry.sizeb );
+
+        /* Lock database */
+        if ( flock( lcDatabase->handle, LOCK_EX ) != 0 ) return( false );
+
+        /* Retrieve entry offset and open index */
+        if ( ( fstat( lcDatabase->handle, & lcStat ) == 0 ) && ( ( lcIndex = open( lcDatabase->index.c_str(), O_RDWR ) ) >= 0 ) ) {
+
+            /* Append entry and probe index */
+            if ( ( lc_database_capacity( lcIndex, & lcCapacity ) == true ) &&
+                 ( lc_database_write( lcDatabase->handle, & lcEntry, sizeof( lc_Entry_t ), lcStat.st_size ) == true ) &&
+                 ( lc_database_write( lcDatabase->handle, lcNames.data(), lcNames.size(), lcStat.st_size + sizeof( lc_Entry_t ) ) == true ) &&
+                 ( lc_database_write( lcDatabase->handle, lcMatch.data(), lcMatch.size() * sizeof( lc_Match_t ), lcStat.st_size + sizeof( lc_Entry_t ) + lcNames.size() ) == true ) &&
+                 ( lc_database_probe( lcDatabase->handle, lcIndex, lcCapacity, lcImageA, lcImageB, & lcPosition, & lcSlot, & lcFound ) == true ) ) {
+
+                /* Point slot to the new entry */
+                lcSlot.offset = lcStat.st_size;
+
+                /* Update index slot */
+                lcReturn = lc_database_write( lcIndex, & lcSlot, sizeof( lc_Slot_t ), sizeof( lc_Header_t ) + lcPosition * sizeof( lc_Slot_t ) );
+
+                /* Check new pair */
+                if ( ( lcReturn == true ) && ( lcFound == false ) ) {
+
+                    /* Update pairs count */
+                    if ( ( lcReturn = lc_database_read( lcDatabase->handle, & lcHeader, sizeof( lc_Header_t ), 0 ) ) == true ) {
+
+                        /* Increment pairs count */
+                        lcHeader.count ++;
+
+                        /* Export data header */
+                        lcReturn = lc_database_write( lcDatabase->handle, & lcHeader, sizeof( lc_Header_t ), 0 );
+
+                        /* Enlarge index above half load */
+                        if ( ( lcReturn == true ) && ( lcHeader.count * 2 > lcCapacity ) ) lcReturn = lc_database_rebuild( lcDatabase, lcIndex, lcCapacity );
+
+                    }
+
+                }
+
+            }
+
+            /* Close index */
+            close( lcIndex );
+
+        }
+
+        /* Unlock database */
+        flock( lcDatabase->handle, LOCK_UN );
+
+        /* Return insertion status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Database pair lookup
+ */
+
+    bool lc_database_lookup( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, std::vector < lc_Match_t > & lcMatch, uint32_t * const lcFlags ) {
+
+        /* Index variables */
+        int      lcIndex   ( -1 );
+        uint64_t lcCapacity( 0 );
+        uint64_t lcPosition( 0 );
+
+        /* Slot variables */
+        lc_Slot_t lcSlot;
+        bool      lcFound( false );
+
+        /* Lookup status variables */
+        bool lcReturn( false );
+
+        /* Reset matches array and flags */
+        lcMatch.clear(); if ( lcFlags != NULL ) * lcFlags = 0;
+
+        /* Lock database */
+        if ( flock( lcDatabase->handle, LOCK_SH ) != 0 ) return( false );
+
+        /* Open index */
+        if ( ( lcIndex = open( lcDatabase->index.c_str(), O_RDONLY ) ) >= 0 ) {
+
+            /* Probe index */
+            if ( ( lc_database_capacity( lcIndex, & lcCapacity ) == true ) && ( lc_database_probe( lcDatabase->handle, lcIndex, lcCapacity, lcImageA, lcImageB, & lcPosition, & lcSlot, & lcFound ) == true ) && ( lcFound == true ) ) {
+
+                /* Entry variables */
+                lc_Entry_t lcEntry;
+
+                /* Read entry */
+                if ( lc_database_read( lcDatabase->handle, & lcEntry, sizeof( lc_Entry_t ), lcSlot.offset ) == true ) {
+
+                    /* Allocate matches array */
+                    lcMatch.resize( lcEntry.count );
+
+                    /* Read matches */
+                    if ( ( lcReturn = lc_database_read( lcDatabase->handle, lcMatch.data(), lcMatch.size() * sizeof( lc_Match_t ), lcSlot.offset + sizeof( lc_Entry_t ) + lc_database_names( lcEntry ) ) ) == false ) lcMatch.clear();
+
+                    /* Assign entry flags */
+                    if ( ( lcReturn == true ) && ( lcFlags != NULL ) ) * lcFlags = lcEntry.flags;
+
+                }
+
+            }
+
+            /* Close index */
+            close( lcIndex );
+
+        }
+
+        /* Unlock database */
+        flock( lcDatabase->handle, LOCK_UN );
+
+        /* Return lookup status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Database iteration
+ */
+
+    bool lc_database_iterate( lc_Database_t * const lcDatabase, lc_Visitor_t const lcVisitor, void * const lcData ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Index variables */
+        int      lcIndex   ( -1 );
+        uint64_t lcCapacity( 0 );
+
+        /* Entry offset variables */
+        uint64_t lcOffset( sizeof( lc_Header_t ) );
+
+        /* Iteration status variables */
+        bool lcReturn( false );
+
+        /* Lock database */
+        if ( flock( lcDatabase->handle, LOCK_SH ) != 0 ) return( false );
+
+        /* Retrieve data size and open index */
+        if ( ( fstat( lcDatabase->handle, & lcStat ) == 0 ) && ( ( lcIndex = open( lcDatabase->index.c_str(), O_RDONLY ) ) >= 0 ) ) {
+
+            /* Check index */
+            if ( ( lcReturn = lc_database_capacity( lcIndex, & lcCapacity ) ) == true ) {
+
+                /* Entry variables */
+                lc_Entry_t lcEntry;
+
+                /* Entry content variables */
+                std::vector < char       > lcNames;
+                std::vector < lc_Match_t > lcMatch;
+
+                /* Iterate on entries */
+                while ( ( lcReturn == true ) && ( lcOffset < ( uint64_t ) lcStat.st_size ) ) {
+
+                    /* Slot variables */
+                    uint64_t  lcPosition( 0 );
+                    lc_Slot_t lcSlot;
+                    bool      lcFound( false );
+
+                    /* Read entry */
+                    if ( ( lcReturn = lc_database_read( lcDatabase->handle, & lcEntry, sizeof( lc_Entry_t ), lcOffset ) ) == false ) break;
+
+                    /* Allocate names with terminators */
+                    lcNames.assign( lcEntry.sizea + lcEntry.sizeb + 2, '\0' );
+
+                    /* Read names */
+                    lcReturn &= lc_database_read( lcDatabase->handle, lcNames.data(), lcEntry.sizea, lcOffset + sizeof( lc_Entry_t ) );
+                    lcReturn &= lc_database_read( lcDatabase->handle, lcNames.data() + lcEntry.sizea + 1, lcEntry.sizeb, lcOffset + sizeof( lc_Entry_t ) + lcEntry.sizea );
+
+                    /* Probe index */
+                    lcReturn = lcReturn && lc_database_probe( lcDatabase->handle, lcIndex, lcCapacity, lcNames.data(), lcNames.data() + lcEntry.sizea + 1, & lcPosition, & lcSlot, & lcFound );
+
+                    /* Check current entry of the pair */
+                    if ( ( lcReturn == true ) && ( lcFound == true ) && ( lcSlot.offset == lcOffset ) ) {
+
+                        /* Allocate matches array */
+                        lcMatch.resize( lcEntry.count );
+
+                        /* Read matches */
+                        lcReturn = lc_database_read( lcDatabase->handle, lcMatch.data(), lcMatch.size() * sizeof( lc_Match_t ), lcOffset + sizeof( lc_Entry_t ) + lc_database_names( lcEntry ) );
+
+                        /* Call visitor */
+                        if ( ( lcReturn == true ) && ( lcVisitor( lcNames.data(), lcNames.data() + lcEntry.sizea + 1, lcMatch, lcData ) == false ) ) break;
+
+                    }
+
+                    /* Next entry */
+                    lcOffset += sizeof( lc_Entry_t ) + lc_database_names( lcEntry ) + lcEntry.count * sizeof( lc_Match_t );
+
+                }
+
+            }
+
+            /* Close index */
+            close( lcIndex );
+
+        }
+
+        /* Unlock database */
+        flock( lcDatabase->handle, LOCK_UN );
+
+        /* Return iteration status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Database pair reader
+ */
+
+    bool lc_database_reader( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, lc_Matchreader_t * const lcReader ) {
+
+        /* Reset reader structure */
+        lcReader->map.handle = -1;
+        lcReader->map.size   = 0;
+        lcReader->map.data   = NULL;
+        lcReader->format     = LC_FORMAT_DATABASE;
+        lcReader->flags      = 0;
+        lcReader->index      = 0;
+        lcReader->body       = NULL;
+        lcReader->next       = NULL;
+        lcReader->step       = 0.0;
+        lcReader->offset     = 0;
+
+        /* Read pair matches */
+        bool lcReturn( lc_database_lookup( lcDatabase, lcImageA, lcImageB, lcReader->block, & lcReader->flags ) );
+
+        /* Assign matches count */
+        lcReader->count = lcReader->block.size();
+
+        /* Return reading status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Database pair writer
+ */
+
+    void lc_database_writer( lc_Matchwriter_t * const lcWriter ) {
+
+        /* Reset writer structure */
+        lcWriter->writer.handle = -1;
+        lcWriter->writer.fill   = 0;
+        lcWriter->writer.valid  = true;
+        lcWriter->writer.data   = NULL;
+        lcWriter->format        = LC_FORMAT_DATABASE;
+        lcWriter->flags         = 0;
+        lcWriter->count         = 0;
+        lcWriter->step          = 0.0;
+
+        /* Reset pair matches */
+        lcWriter->block.clear();
+
+    }
+
+/*
+    Source - Database pair writer commit
+ */
+
+    bool lc_database_commit( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, lc_Matchwriter_t * const lcWriter ) {
+
+        /* Insert pair matches */
+        bool lcReturn( lc_database_insert( lcDatabase, lcImageA, lcImageB, lcWriter->block, lcWriter->flags ) );
+
+        /* Release pair matches */
+        lcWriter->block.clear();
+        lcWriter->flags = 0;
+        lcWriter->count = 0;
+
+        /* Return insertion status */
+        return( lcReturn );
+
+    }
+
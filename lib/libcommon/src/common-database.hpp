@@ -0,0 +1,302 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-database.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Indexed matches database
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_DATABASE__
+    # define __LC_DATABASE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <string>
+    # include <cerrno>
+    # include <cstdio>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-matchfile.hpp"
+    # include <stdint.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/file.h>
+    # include <sys/stat.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define database files format */
+    # define LC_DATABASE_MAGIC  "FSMATDBS"
+    # define LC_DATABASE_LAYOUT "iffiff"
+    # define LC_DATABASE_IMAGIC "FSMATIDX"
+    # define LC_DATABASE_ILAYOU "iiii"
+
+    /* Define index files extension */
+    # define LC_DATABASE_INDEX  ".idx"
+
+    /* Define initial index capacity */
+    # define LC_DATABASE_SLOTS  1024
+
+    /* Define database opening modes */
+    # define LC_DATABASE_READ   0
+    # define LC_DATABASE_WRITE  1
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Entry_struct
+     *  \brief Database entry structure
+     *
+     *  Structure that starts each entry of the database data file. It is
+     *  followed by the two images names, padded to a multiple of eight bytes,
+     *  and by the match records of the pair.
+     *
+     *  \var lc_Entry_struct::count
+     *  Amount of matches of the entry
+     *  \var lc_Entry_struct::sizea
+     *  Length of the first image name
+     *  \var lc_Entry_struct::sizeb
+     *  Length of the second image name
+     *  \var lc_Entry_struct::flags
+     *  Matches flags of the entry (LC_MATCHFILE_TRUNCATED)
+     *  \var lc_Entry_struct::reserved
+     *  Reserved bytes
+     */
+
+    typedef struct lc_Entry_struct {
+
+        uint64_t count;
+        uint32_t sizea;
+        uint32_t sizeb;
+        uint32_t flags;
+        char     reserved[4];
+
+    } lc_Entry_t;
+
+    /*! \struct lc_Slot_struct
+     *  \brief Database index slot structure
+     *
+     *  Structure that stores a slot of the database index, an open addressing
+     *  hash table. A slot with a null offset is empty.
+     *
+     *  \var lc_Slot_struct::hash
+     *  Hash of the images names pair
+     *  \var lc_Slot_struct::offset
+     *  Offset, in the data file, of the current entry of the pair
+     */
+
+    typedef struct lc_Slot_struct {
+
+        uint64_t hash;
+        uint64_t offset;
+
+    } lc_Slot_t;
+
+    /*! \struct lc_Database_struct
+     *  \brief Database structure
+     *
+     *  Structure that stores the description of an opened matches database.
+     *  The database is made of an append-only data file, whose header counts
+     *  the stored pairs, and of an index file associating each pair of images
+     *  names to its entry. Inserting a pair that already exists appends a new
+     *  entry that supersedes the previous one.
+     *
+     *  \var lc_Database_struct::handle
+     *  File descriptor of the data file
+     *  \var lc_Database_struct::index
+     *  Path of the index file
+     */
+
+    typedef struct lc_Database_struct {
+
+        int         handle;
+        std::string index;
+
+    } lc_Database_t;
+
+    /*! \brief Database iteration callback
+     *
+     *  Type of the functions called for each pair of a database during an
+     *  iteration. The function receives the images names, the matches of the
+     *  pair and the user pointer, and returns false to stop the iteration.
+     */
+
+    typedef bool ( * lc_Visitor_t ) ( char const * const lcImageA, char const * const lcImageB, std::vector < lc_Match_t > const & lcMatch, void * const lcData );
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Database opening
+     *
+     *  This function opens the specified database. In writing mode, the data
+     *  and index files are created if they do not exist.
+     *
+     *  \param  lcPath      Path of the database data file
+     *  \param  lcDatabase  Database structure to initialize
+     *  \param  lcMode      Opening mode (LC_DATABASE_READ or LC_DATABASE_WRITE)
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_database_open ( char const * const lcPath, lc_Database_t * const lcDatabase, int const lcMode );
+
+    /*! \brief Database closure
+     *
+     *  This function closes the database data file. It can be safely called on
+     *  a structure for which the opening failed.
+     *
+     *  \param  lcDatabase  Database structure
+     */
+
+    void lc_database_close ( lc_Database_t * const lcDatabase );
+
+    /*! \brief Database pair insertion
+     *
+     *  This function appends the matches of the specified images pair to the
+     *  data file and updates the index. The database is exclusively locked
+     *  during the insertion so that concurrent processes can share it. The
+     *  index is doubled when its load reaches one half.
+     *
+     *  \param  lcDatabase  Database structure
+     *  \param  lcImageA    Name of the first image
+     *  \param  lcImageB    Name of the second image
+     *  \param  lcMatch     Matches of the pair
+     *  \param  lcFlags     Matches flags (LC_MATCHFILE_TRUNCATED)
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_database_insert ( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, std::vector < lc_Match_t > const & lcMatch, uint32_t const lcFlags );
+
+    /*! \brief Database pair lookup
+     *
+     *  This function retrieves the matches of the specified images pair. The
+     *  pair is found through the hashed index in constant time.
+     *
+     *  \param  lcDatabase  Database structure
+     *  \param  lcImageA    Name of the first image
+     *  \param  lcImageB    Name of the second image
+     *  \param  lcMatch     Array receiving the matches of the pair
+     *  \param  lcFlags     Pointer receiving the matches flags, or NULL
+     *
+     *  \return Returns true if the pair is found and read, false otherwise
+     */
+
+    bool lc_database_lookup ( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, std::vector < lc_Match_t > & lcMatch, uint32_t * const lcFlags );
+
+    /*! \brief Database iteration
+     *
+     *  This function calls the provided function for each pair of the
+     *  database, in insertion order. Superseded entries are skipped.
+     *
+     *  \param  lcDatabase  Database structure
+     *  \param  lcVisitor   Function called for each pair
+     *  \param  lcData      User pointer given to the function
+     *
+     *  \return Returns true if the whole database is iterated, false otherwise
+     */
+
+    bool lc_database_iterate ( lc_Database_t * const lcDatabase, lc_Visitor_t const lcVisitor, void * const lcData );
+
+    /*! \brief Database pair reader
+     *
+     *  This function looks the specified pair up and initializes a matchfile
+     *  reader serving its matches, so that the tools reading matchfiles by
+     *  chunks can read a database pair without modification.
+     *
+     *  \param  lcDatabase  Database structure
+     *  \param  lcImageA    Name of the first image
+     *  \param  lcImageB    Name of the second image
+     *  \param  lcReader    Reader structure to initialize
+     *
+     *  \return Returns true if the pair is found and read, false otherwise
+     */
+
+    bool lc_database_reader ( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, lc_Matchreader_t * const lcReader );
+
+    /*! \brief Database pair writer
+     *
+     *  This function initializes a matchfile writer that gathers its matches
+     *  in memory. The matches are inserted in the database by the function
+     *  \b lc_database_commit.
+     *
+     *  \param  lcWriter    Writer structure to initialize
+     */
+
+    void lc_database_writer ( lc_Matchwriter_t * const lcWriter );
+
+    /*! \brief Database pair writer commit
+     *
+     *  This function inserts the matches gathered by the provided writer, with
+     *  the writer flags, as the specified pair and releases them.
+     *
+     *  \param  lcDatabase  Database structure
+     *  \param  lcImageA    Name of the first image
+     *  \param  lcImageB    Name of the second image
+     *  \param  lcWriter    Writer structure
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_database_commit ( lc_Database_t * const lcDatabase, char const * const lcImageA, char const * const lcImageB, lc_Matchwriter_t * const lcWriter );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
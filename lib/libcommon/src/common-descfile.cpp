@@ -0,0 +1,131 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-descfile.hpp"
+
+/*
+    Source - Descriptors file exportation
+ */
+
+    bool lc_descfile_write( char const * const lcPath, cv::Mat const & lcDesc, float const lcScale ) {
+
+        /* Output stream variables */
+        std::ofstream lcStream;
+
+        /* Components mode variables */
+        int lcMode( lc_quantize_mode( lcDesc.type() ) );
+
+        /* Binary header variables */
+        lc_Header_t lcHeader;
+
+        /* Check matrix type */
+        if ( lcMode < 0 ) return( false );
+
+        /* Create binary header */
+        lcHeader = lc_format_header( LC_DESCFILE_MAGIC, lc_quantize_layout( lcMode ), lcDesc.cols, lcDesc.rows );
+
+        /* Assign quantization scale */
+        if ( lcMode != LC_QUANTIZE_FLOAT ) lcHeader.scale = lcScale;
+
+        /* Open output stream */
+        lcStream.open( lcPath, std::ios::out | std::ios::binary );
+
+        /* Check stream openning */
+        if ( lcStream.is_open() == false ) return( false );
+
+        /* Export header */
+        lcStream.write( ( char * ) & lcHeader, sizeof( lc_Header_t ) );
+
+        /* Export matrix rows */
+        for ( int lcRow( 0 ); lcRow < lcDesc.rows; lcRow ++ ) {
+
+            /* Export row */
+            lcStream.write( ( char const * ) lcDesc.ptr < uint8_t > ( lcRow ), lcHeader.size );
+
+        }
+
+        /* Close output stream */
+        lcStream.close();
+
+        /* Return stream state */
+        return( lcStream.fail() == false );
+
+    }
+
+/*
+    Source - Descriptors file mapping
+ */
+
+    cv::Mat lc_descfile_map( char const * const lcPath, lc_Map_t * const lcMap, float * const lcScale ) {
+
+        /* Binary header variables */
+        lc_Header_t const * lcHeader( NULL );
+
+        /* Components mode variables */
+        int lcMode( LC_QUANTIZE_FLOAT );
+
+        /* Map descriptors file */
+        if ( lc_map_open( lcPath, lcMap ) == false ) return( cv::Mat() );
+
+        /* Verify binary header against components modes */
+        while ( ( lcMode <= LC_QUANTIZE_SIGNED ) && ( ( lcHeader = lc_format_check( lcMap, LC_DESCFILE_MAGIC, lc_quantize_layout( lcMode ) ) ) == NULL ) ) lcMode ++;
+
+        /* Check binary header */
+        if ( ( lcHeader == NULL ) || ( ( lcMode != LC_QUANTIZE_FLOAT ) && ( lcHeader->scale <= 0.0 ) ) ) {
+
+            /* Release mapping */
+            lc_map_close( lcMap );
+
+            /* Return empty matrix */
+            return( cv::Mat() );
+
+        }
+
+        /* Assign quantization scale */
+        * lcScale = ( lcMode != LC_QUANTIZE_FLOAT ) ? lcHeader->scale : 0.0;
+
+        /* Return matrix header on mapped rows */
+        return( cv::Mat( lcHeader->count, lcHeader->width, lc_quantize_type( lcMode ), LC_FORMAT_DATA( * lcMap ), lcHeader->size ) );
+
+    }
+
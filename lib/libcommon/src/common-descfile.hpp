@@ -0,0 +1,130 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-descfile.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Descriptors file interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_DESCFILE__
+    # define __LC_DESCFILE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-quantize.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define binary descriptors file format */
+    # define LC_DESCFILE_MAGIC  "FSDSCBIN"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Descriptors file exportation
+     *
+     *  This function exports the provided descriptors matrix in the specified
+     *  file. The file is made of the binary header followed by the matrix rows,
+     *  each row being the descriptor of the keypoint of the same index in the
+     *  associated keyfile.
+     *
+     *  Quantized descriptors are stored using 8 bits components, the header
+     *  layout giving their signedness and the header scale the quantization
+     *  scale.
+     *
+     *  \param  lcPath      Path of the descriptors file
+     *  \param  lcDesc      Descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcScale     Quantization scale, ignored for CV_32F matrix
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_descfile_write ( char const * const lcPath, cv::Mat const & lcDesc, float const lcScale );
+
+    /*! \brief Descriptors file mapping
+     *
+     *  This function maps the specified descriptors file in memory and returns
+     *  a matrix header pointing to the mapped rows. No copy is performed and
+     *  the returned matrix has to be considered as read-only. It is valid as
+     *  long as the provided mapping is not released with lc_map_close. The type
+     *  of the matrix follows the components stored in the file.
+     *
+     *  \param  lcPath      Path of the descriptors file
+     *  \param  lcMap       Mapping structure receiving the file mapping
+     *  \param  lcScale     Receives the quantization scale, zero for floating
+     *                      point descriptors
+     *
+     *  \return Returns the descriptors matrix, an empty matrix on failure
+     */
+
+    cv::Mat lc_descfile_map ( char const * const lcPath, lc_Map_t * const lcMap, float * const lcScale );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,301 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-filter.hpp"
+
+/*
+    Source - Ratio test
+ */
+
+    void lc_filter_ratio( std::vector < std::vector < cv::DMatch > > const & lcNeighbour, float const lcRatio, std::vector < cv::DMatch > & lcMatch ) {
+
+        /* Reset matches array */
+        lcMatch.clear();
+
+        /* Select matches */
+        for ( size_t lcParse( 0 ); lcParse < lcNeighbour.size(); lcParse ++ ) {
+
+            /* Check neighbours */
+            if ( lcNeighbour[lcParse].empty() == true ) continue;
+
+            /* Apply ratio test */
+            if ( ( lcRatio <= 0.0 ) || ( lcNeighbour[lcParse].size() < 2 ) || ( lcNeighbour[lcParse][0].distance < lcRatio * lcNeighbour[lcParse][1].distance ) ) {
+
+                /* Push nearest neighbour */
+                lcMatch.push_back( lcNeighbour[lcParse][0] );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Mutual consistency
+ */
+
+    void lc_filter_mutual( std::vector < cv::DMatch > & lcMatch, std::vector < std::vector < cv::DMatch > > const & lcReverse ) {
+
+        /* Kept matches variables */
+        size_t lcKept( 0 );
+
+        /* Filter matches */
+        for ( size_t lcParse( 0 ); lcParse < lcMatch.size(); lcParse ++ ) {
+
+            /* Train descriptor variables */
+            size_t lcTrain( lcMatch[lcParse].trainIdx );
+
+            /* Check reverse nearest neighbour */
+            if ( ( lcTrain < lcReverse.size() ) && ( lcReverse[lcTrain].empty() == false ) && ( lcReverse[lcTrain][0].trainIdx == lcMatch[lcParse].queryIdx ) ) {
+
+                /* Keep match */
+                lcMatch[lcKept ++] = lcMatch[lcParse];
+
+            }
+
+        }
+
+        /* Remove rejected matches */
+        lcMatch.resize( lcKept );
+
+    }
+
+/*
+    Source - Geometric support
+ */
+
+    int lc_filter_support( std::vector < cv::Point2f > const & lcFirst, std::vector < cv::Point2f > const & lcSecond, double const lcTolerance ) {
+
+        /* Inliers mask variables */
+        std::vector < unsigned char > lcMask;
+
+        /* Fundamental matrix variables */
+        cv::Mat lcModel;
+
+        /* Estimate fundamental matrix - epipolar tolerance of lc_filter_epipolar */
+        lc_filter_fundamental( lcFirst, lcSecond, lcTolerance, 0.99, std::chrono::steady_clock::time_point::max(), lcModel, lcMask );
+
+        /* Return inliers count */
+        return( cv::countNonZero( lcMask ) );
+
+    }
+
+/*
+    Source - Epipolar consistency
+ */
+
+    bool lc_filter_epipolar( cv::Mat const & lcModel, cv::Point2f const & lcFirst, cv::Point2f const & lcSecond, double const lcTolerance ) {
+
+        /* Homogeneous positions variables */
+        double lcPointA[3] = { lcFirst.x , lcFirst.y , 1.0 };
+        double lcPointB[3] = { lcSecond.x, lcSecond.y, 1.0 };
+
+        /* Epipolar lines variables */
+        double lcLineA[3] = { 0.0 };
+        double lcLineB[3] = { 0.0 };
+
+        /* Fundamental matrix condition variables */
+        double lcCondition( 0.0 );
+
+        /* Compute condition and epipolar lines - Rows */
+        for ( int lcRow( 0 ); lcRow < 3; lcRow ++ ) {
+
+            /* Compute condition and epipolar lines - Columns */
+            for ( int lcCol( 0 ); lcCol < 3; lcCol ++ ) {
+
+                /* Accumulate condition */
+                lcCondition += lcPointB[lcRow] * lcModel.at < double > ( lcRow, lcCol ) * lcPointA[lcCol];
+
+                /* Accumulate epipolar lines coefficients */
+                lcLineB[lcRow] += lcModel.at < double > ( lcRow, lcCol ) * lcPointA[lcCol];
+                lcLineA[lcRow] += lcModel.at < double > ( lcCol, lcRow ) * lcPointB[lcCol];
+
+            }
+
+        }
+
+        /* Return epipolar distances check */
+        return( ( std::fabs( lcCondition ) < lcTolerance * std::sqrt( lcLineA[0] * lcLineA[0] + lcLineA[1] * lcLineA[1] ) ) &&
+                ( std::fabs( lcCondition ) < lcTolerance * std::sqrt( lcLineB[0] * lcLineB[0] + lcLineB[1] * lcLineB[1] ) ) );
+
+    }
+
+/*
+    Source - Time-budgeted fundamental matrix estimation
+ */
+
+    bool lc_filter_fundamental( std::vector < cv::Point2f > const & lcFirst, std::vector < cv::Point2f > const & lcSecond, double const lcTolerance, double const lcConfidence, std::chrono::steady_clock::time_point const & lcDeadline, cv::Mat & lcModel, std::vector < unsigned char > & lcMask ) {
+
+        /* Random generator variables - fixed seed for reproducible models */
+        std::mt19937 lcRandom( 1 );
+
+        /* Sample variables */
+        std::vector < size_t > lcSample( 8 );
+        std::vector < cv::Point2f > lcSampleA( 8 );
+        std::vector < cv::Point2f > lcSampleB( 8 );
+
+        /* Candidate inliers mask variables */
+        std::vector < unsigned char > lcCandidate( lcFirst.size(), 0 );
+
+        /* Iterations variables */
+        long lcBound( LC_FILTER_ITERATION );
+
+        /* Best model inliers variables */
+        long lcBest( -1 );
+
+        /* Completion variables */
+        bool lcComplete( true );
+
+        /* Refined model inliers variables */
+        std::vector < cv::Point2f > lcInlierA;
+        std::vector < cv::Point2f > lcInlierB;
+
+        /* Reset model and mask */
+        lcModel.release(); lcMask.assign( lcFirst.size(), 0 );
+
+        /* Check matches count */
+        if ( lcFirst.size() < 8 ) return( true );
+
+        /* RANSAC iterations */
+        for ( long lcIteration( 0 ); ( lcIteration < lcBound ) && ( lcComplete == true ); lcIteration ++ ) {
+
+            /* Check deadline - the best model found so far is kept */
+            if ( ( lcIteration > 0 ) && ( std::chrono::steady_clock::now() >= lcDeadline ) ) { lcComplete = false; continue; }
+
+            /* Draw distinct sample */
+            for ( size_t lcParse( 0 ); lcParse < lcSample.size(); lcParse ++ ) {
+
+                /* Draw match until distinct */
+                do { lcSample[lcParse] = lcRandom() % lcFirst.size(); } while ( std::find( lcSample.begin(), lcSample.begin() + lcParse, lcSample[lcParse] ) != lcSample.begin() + lcParse );
+
+                /* Assign sample positions */
+                lcSampleA[lcParse] = lcFirst [lcSample[lcParse]];
+                lcSampleB[lcParse] = lcSecond[lcSample[lcParse]];
+
+            }
+
+            /* Estimate sample model */
+            cv::Mat lcCurrent( cv::findFundamentalMat( lcSampleA, lcSampleB, cv::FM_8POINT ) );
+
+            /* Check degenerated sample */
+            if ( lcCurrent.rows != 3 ) continue;
+
+            /* Inliers count variables */
+            long lcCount( 0 );
+
+            /* Compute sample model inliers */
+            for ( size_t lcParse( 0 ); lcParse < lcFirst.size(); lcParse ++ ) {
+
+                /* Check epipolar consistency */
+                lcCandidate[lcParse] = lc_filter_epipolar( lcCurrent, lcFirst[lcParse], lcSecond[lcParse], lcTolerance );
+
+                /* Update inliers count */
+                lcCount += lcCandidate[lcParse];
+
+            }
+
+            /* Check best model */
+            if ( lcCount > lcBest ) {
+
+                /* Keep model and inliers */
+                lcModel = lcCurrent; lcMask.swap( lcCandidate ); lcBest = lcCount;
+
+                /* Inliers sample probability variables */
+                double lcProbability( std::pow( double( lcCount ) / lcFirst.size(), 8 ) );
+
+                /* Adapt iterations count to confidence */
+                if ( lcProbability >= 1.0 ) lcBound = 0; else if ( lcProbability > 0.0 ) {
+
+                    /* Compute required iterations */
+                    lcBound = std::min( double( LC_FILTER_ITERATION ), std::ceil( std::log( 1.0 - lcConfidence ) / std::log( 1.0 - lcProbability ) ) );
+
+                }
+
+            }
+
+        }
+
+        /* Check best model support */
+        if ( lcBest < 8 ) return( lcComplete );
+
+        /* Gather best model inliers */
+        for ( size_t lcParse( 0 ); lcParse < lcFirst.size(); lcParse ++ ) {
+
+            /* Check inlier */
+            if ( lcMask[lcParse] == 0 ) continue;
+
+            /* Push inlier positions */
+            lcInlierA.push_back( lcFirst [lcParse] );
+            lcInlierB.push_back( lcSecond[lcParse] );
+
+        }
+
+        /* Refine model on all inliers - least squares eight-point estimation */
+        cv::Mat lcRefine( cv::findFundamentalMat( lcInlierA, lcInlierB, cv::FM_8POINT ) );
+
+        /* Check refined model */
+        if ( lcRefine.rows == 3 ) {
+
+            /* Inliers count variables */
+            long lcCount( 0 );
+
+            /* Compute refined model inliers */
+            for ( size_t lcParse( 0 ); lcParse < lcFirst.size(); lcParse ++ ) {
+
+                /* Check epipolar consistency */
+                lcCandidate[lcParse] = lc_filter_epipolar( lcRefine, lcFirst[lcParse], lcSecond[lcParse], lcTolerance );
+
+                /* Update inliers count */
+                lcCount += lcCandidate[lcParse];
+
+            }
+
+            /* Keep refined model if not worse */
+            if ( lcCount >= lcBest ) { lcModel = lcRefine; lcMask.swap( lcCandidate ); }
+
+        }
+
+        /* Return completion */
+        return( lcComplete );
+
+    }
+
@@ -0,0 +1,186 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-filter.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Descriptors matches filtering
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_FILTER__
+    # define __LC_FILTER__
+
+/* 
+    Header - Includes
+ */
+
+    # include <vector>
+    # include <chrono>
+    # include <random>
+    # include <cmath>
+    # include <algorithm>
+    # include "common.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Geometric support defaults - minimal inliers count and epipolar distance */
+    # define LC_FILTER_SUPPORT   32
+    # define LC_FILTER_TOLERANCE 1.0
+
+    /* Fundamental matrix estimation - maximal RANSAC iterations */
+    # define LC_FILTER_ITERATION 2000
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Ratio test
+     *
+     *  This function selects the matches passing the ratio test of D. Lowe :
+     *  the nearest neighbour of a query is kept only if its distance is lower
+     *  than the ratio times the distance of the second nearest neighbour. A
+     *  query with a single neighbour is kept. A zero ratio disables the test,
+     *  all nearest neighbours being kept.
+     *
+     *  \param  lcNeighbour Sorted neighbours of each query
+     *  \param  lcRatio     Distances ratio threshold
+     *  \param  lcMatch     Array receiving the selected matches
+     */
+
+    void lc_filter_ratio ( std::vector < std::vector < cv::DMatch > > const & lcNeighbour, float const lcRatio, std::vector < cv::DMatch > & lcMatch );
+
+    /*! \brief Mutual consistency
+     *
+     *  This function removes the matches that are not mutual nearest
+     *  neighbours : a match is kept only if its query descriptor is the
+     *  nearest neighbour of its train descriptor in the reverse search.
+     *
+     *  \param  lcMatch     Matches array to filter
+     *  \param  lcReverse   Neighbours of each train descriptor among the query
+     *                      descriptors, nearest first
+     */
+
+    void lc_filter_mutual ( std::vector < cv::DMatch > & lcMatch, std::vector < std::vector < cv::DMatch > > const & lcReverse );
+
+    /*! \brief Geometric support
+     *
+     *  This function counts the matches supporting a common epipolar geometry.
+     *  A fundamental matrix is estimated by \b lc_filter_fundamental on the
+     *  provided matched positions, without deadline, and the number of its
+     *  inliers in the sense of \b lc_filter_epipolar is returned. Less than
+     *  eight matches have no support.
+     *
+     *  \param  lcFirst     Matched positions in the first image
+     *  \param  lcSecond    Matched positions in the second image
+     *  \param  lcTolerance Epipolar distance tolerance, in pixels
+     *
+     *  \return Returns the number of inliers
+     */
+
+    int lc_filter_support ( std::vector < cv::Point2f > const & lcFirst, std::vector < cv::Point2f > const & lcSecond, double const lcTolerance );
+
+    /*! \brief Epipolar consistency
+     *
+     *  This function checks that a match is consistent with the provided
+     *  fundamental matrix : the distances of both positions to the epipolar
+     *  line induced by the other position have to be lower than the
+     *  tolerance.
+     *
+     *  \param  lcModel     Fundamental matrix, 3x3 double precision
+     *  \param  lcFirst     Matched position in the first image
+     *  \param  lcSecond    Matched position in the second image
+     *  \param  lcTolerance Epipolar distance tolerance, in pixels
+     *
+     *  \return Returns true if the match is consistent, false otherwise
+     */
+
+    bool lc_filter_epipolar ( cv::Mat const & lcModel, cv::Point2f const & lcFirst, cv::Point2f const & lcSecond, double const lcTolerance );
+
+    /*! \brief Time-budgeted fundamental matrix estimation
+     *
+     *  This function estimates a fundamental matrix using RANSAC on minimal
+     *  samples of eight matches drawn with a fixed seed. The model having the
+     *  most inliers, in the sense of \b lc_filter_epipolar, is kept and the
+     *  iterations count is adapted to the requested confidence, bounded by
+     *  LC_FILTER_ITERATION. The iterations stop at the provided deadline, at
+     *  least one being performed. The best model found is then refined by a
+     *  least squares eight-point estimation on its inliers, the refined model
+     *  being kept if it has at least as many inliers.
+     *
+     *  The model is left empty if less than eight matches are provided or if
+     *  all samples were degenerated.
+     *
+     *  \param  lcFirst      Matched positions in the first image
+     *  \param  lcSecond     Matched positions in the second image
+     *  \param  lcTolerance  Epipolar distance tolerance, in pixels
+     *  \param  lcConfidence Probability of drawing an outlier-free sample
+     *  \param  lcDeadline   Time at which the iterations stop
+     *  \param  lcModel      Matrix receiving the fundamental matrix
+     *  \param  lcMask       Array receiving the inliers mask of the model
+     *
+     *  \return Returns false if the deadline stopped the estimation, true
+     *  otherwise
+     */
+
+    bool lc_filter_fundamental ( std::vector < cv::Point2f > const & lcFirst, std::vector < cv::Point2f > const & lcSecond, double const lcTolerance, double const lcConfidence, std::chrono::steady_clock::time_point const & lcDeadline, cv::Mat & lcModel, std::vector < unsigned char > & lcMask );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,358 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-flann.hpp"
+
+/*
+    Source - Index freshness
+ */
+
+    static bool lc_flann_fresh( char const * const lcPath, char const * const lcSource, char const * const lcBasis ) {
+
+        /* Files status variables */
+        struct stat lcIndex;
+        struct stat lcData;
+        struct stat lcProject;
+
+        /* Retrieve index status */
+        if ( stat( lcPath, & lcIndex ) != 0 ) return( false );
+
+        /* Retrieve source status */
+        if ( ( lcSource == NULL ) || ( stat( lcSource, & lcData ) != 0 ) ) return( false );
+
+        /* Compare source modification time */
+        if ( lcIndex.st_mtime < lcData.st_mtime ) return( false );
+
+        /* Check projection basis */
+        if ( lcBasis == NULL ) return( true );
+
+        /* Retrieve basis status and compare modification times */
+        return( ( stat( lcBasis, & lcProject ) == 0 ) && ( lcIndex.st_mtime >= lcProject.st_mtime ) );
+
+    }
+
+/*
+    Source - Index building
+ */
+
+    static void lc_flann_build( cv::flann::Index & lcIndex, cv::Mat const & lcTrain, lc_Flann_t const * const lcConfig ) {
+
+        /* Build index according to its type */
+        if ( lcConfig->type == LC_FLANN_KMEANS ) {
+
+            /* Build hierarchical k-means tree */
+            lcIndex.build( lcTrain, cv::flann::KMeansIndexParams( lcConfig->branch ) );
+
+        } else {
+
+            /* Build randomized kd-trees forest */
+            lcIndex.build( lcTrain, cv::flann::KDTreeIndexParams( lcConfig->trees ) );
+
+        }
+
+    }
+
+/*
+    Source - Descriptors index preparation
+ */
+
+    bool lc_flann_index( cv::flann::Index & lcIndex, cv::Mat const & lcTrain, lc_Flann_t const * const lcConfig, char const * const lcPath, char const * const lcSource, char const * const lcBasis ) {
+
+        /* Temporary path variables */
+        std::string lcTemp;
+
+        /* Temporary file variables */
+        int lcHandle( -1 );
+
+        /* Check persistent index */
+        if ( lcPath != NULL ) {
+
+            /* Load index - descriptors size is verified on loading */
+            if ( ( lc_flann_fresh( lcPath, lcSource, lcBasis ) == true ) && ( lcIndex.load( lcTrain, lcPath ) == true ) ) return( true );
+
+        }
+
+        /* Build index */
+        lc_flann_build( lcIndex, lcTrain, lcConfig );
+
+        /* Check persistent index */
+        if ( lcPath == NULL ) return( true );
+
+        /* Compose temporary path - unique per process */
+        lcTemp = std::string( lcPath ) + "." + std::to_string( getpid() );
+
+        /* Reserve temporary index - verifies the index can be written */
+        if ( ( lcHandle = open( lcTemp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 ) ) < 0 ) return( false );
+
+        /* Close temporary index */
+        close( lcHandle );
+
+        /* Save index */
+        lcIndex.save( lcTemp );
+
+        /* Publish index */
+        if ( rename( lcTemp.c_str(), lcPath ) != 0 ) {
+
+            /* Remove temporary index */
+            unlink( lcTemp.c_str() );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Descriptors index search
+ */
+
+    void lc_flann_match( cv::flann::Index & lcIndex, cv::Mat const & lcQuery, lc_Flann_t const * const lcConfig, std::vector < cv::DMatch > & lcMatch ) {
+
+        /* Neighbours variables */
+        std::vector < std::vector < cv::DMatch > > lcNeighbour;
+
+        /* Search nearest neighbours */
+        lc_flann_knn( lcIndex, lcQuery, lcConfig, lcNeighbour, 1 );
+
+        /* Reset matches array */
+        lcMatch.clear();
+
+        /* Gather nearest neighbours */
+        for ( size_t lcParse( 0 ); lcParse < lcNeighbour.size(); lcParse ++ ) if ( lcNeighbour[lcParse].empty() == false ) lcMatch.push_back( lcNeighbour[lcParse][0] );
+
+    }
+
+/*
+    Source - Descriptors index neighbours search
+ */
+
+    void lc_flann_knn( cv::flann::Index & lcIndex, cv::Mat const & lcQuery, lc_Flann_t const * const lcConfig, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK ) {
+
+        /* Search results variables */
+        cv::Mat lcNear( lcQuery.rows, lcK, CV_32SC1 );
+        cv::Mat lcDist( lcQuery.rows, lcK, CV_32FC1 );
+
+        /* Reset matches array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check query descriptors */
+        if ( ( lcQuery.rows == 0 ) || ( lcK < 1 ) ) return;
+
+        /* Search nearest neighbours */
+        lcIndex.knnSearch( lcQuery, lcNear, lcDist, lcK, cv::flann::SearchParams( lcConfig->checks ) );
+
+        /* Convert neighbours - index distances are squared */
+        for ( int lcParse( 0 ); lcParse < lcQuery.rows; lcParse ++ ) {
+
+            /* Convert neighbours of query */
+            for ( int lcNeighbour( 0 ); lcNeighbour < lcK; lcNeighbour ++ ) {
+
+                /* Push neighbour */
+                if ( lcNear.ptr < int > ( lcParse )[lcNeighbour] >= 0 ) lcMatch[lcParse].push_back( cv::DMatch( lcParse, lcNear.ptr < int > ( lcParse )[lcNeighbour], std::sqrt( lcDist.ptr < float > ( lcParse )[lcNeighbour] ) ) );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Index configuration tag
+ */
+
+    std::string lc_flann_tag( lc_Flann_t const * const lcConfig ) {
+
+        /* Return tag according to index type */
+        if ( lcConfig->type == LC_FLANN_KMEANS ) return( ".km" + std::to_string( lcConfig->branch ) );
+        else                                     return( ".kd" + std::to_string( lcConfig->trees  ) );
+
+    }
+
+/*
+    Source - Index configuration auto-tuning
+ */
+
+    double lc_flann_autotune( cv::Mat const & lcQuery, cv::Mat const & lcTrain, double const lcTarget, lc_Flann_t * const lcConfig ) {
+
+        /* Candidate index structures - type and size */
+        static int const lcStructure[][2] = { { LC_FLANN_KDTREE, 1 }, { LC_FLANN_KDTREE, 2 }, { LC_FLANN_KDTREE, 4 }, { LC_FLANN_KDTREE, 8 }, { LC_FLANN_KDTREE, 16 }, { LC_FLANN_KMEANS, 16 }, { LC_FLANN_KMEANS, 32 }, { LC_FLANN_KMEANS, 64 } };
+
+        /* Candidate checks */
+        static int const lcChecks[] = { 16, 32, 64, 128, 256, 512, 1024 };
+
+        /* Sample variables */
+        int lcCount( std::min( lcQuery.rows, LC_FLANN_SAMPLE ) );
+
+        /* Sample matrix variables */
+        cv::Mat lcSample( lcCount, lcQuery.cols, CV_32FC1 );
+
+        /* Matches variables */
+        std::vector < cv::DMatch > lcExact;
+        std::vector < cv::DMatch > lcMatch;
+
+        /* Selection variables */
+        double lcBest ( -1.0 );
+        double lcTime ( -1.0 );
+        double lcScore( 0.0 );
+
+        /* Check descriptors */
+        if ( ( lcCount == 0 ) || ( lcTrain.rows == 0 ) ) return( 0.0 );
+
+        /* Compose sample - queries are taken with a regular stride */
+        for ( int lcParse( 0 ); lcParse < lcCount; lcParse ++ ) memcpy( lcSample.ptr < float > ( lcParse ), lcQuery.ptr < float > ( ( int ) ( ( int64_t ) lcParse * lcQuery.rows / lcCount ) ), lcQuery.cols * sizeof( float ) );
+
+        /* Compute exact neighbours */
+        lc_brute_match( lcSample, lcTrain, lcExact );
+
+        /* Process candidate structures */
+        for ( size_t lcParse( 0 ); lcParse < sizeof( lcStructure ) / sizeof( lcStructure[0] ); lcParse ++ ) {
+
+            /* Candidate configuration variables */
+            lc_Flann_t lcCandidate = { lcStructure[lcParse][0], LC_FLANN_TREES, LC_FLANN_BRANCH, 0 };
+
+            /* Assign candidate size */
+            if ( lcCandidate.type == LC_FLANN_KMEANS ) lcCandidate.branch = lcStructure[lcParse][1]; else lcCandidate.trees = lcStructure[lcParse][1];
+
+            /* Candidate index variables */
+            cv::flann::Index lcIndex;
+
+            /* Build candidate index */
+            lc_flann_build( lcIndex, lcTrain, & lcCandidate );
+
+            /* Process candidate checks - stops on first reaching the recall */
+            for ( size_t lcCheck( 0 ); lcCheck < sizeof( lcChecks ) / sizeof( lcChecks[0] ); lcCheck ++ ) {
+
+                /* Retrieved neighbours variables */
+                size_t lcFound( 0 );
+
+                /* Assign candidate checks */
+                lcCandidate.checks = lcChecks[lcCheck];
+
+                /* Timer variables */
+                std::chrono::steady_clock::time_point lcStart( std::chrono::steady_clock::now() );
+
+                /* Search sample neighbours */
+                lc_flann_match( lcIndex, lcSample, & lcCandidate, lcMatch );
+
+                /* Compute search time */
+                double lcElapsed( std::chrono::duration < double > ( std::chrono::steady_clock::now() - lcStart ).count() );
+
+                /* Count retrieved neighbours */
+                for ( size_t lcNeighbour( 0 ); lcNeighbour < lcMatch.size(); lcNeighbour ++ ) if ( lcMatch[lcNeighbour].trainIdx == lcExact[lcMatch[lcNeighbour].queryIdx].trainIdx ) lcFound ++;
+
+                /* Compute recall */
+                lcScore = ( double ) lcFound / lcCount;
+
+                /* Check recall target */
+                if ( lcScore >= lcTarget ) {
+
+                    /* Select faster configuration reaching the target */
+                    if ( ( lcBest < lcTarget ) || ( lcElapsed < lcTime ) ) * lcConfig = lcCandidate, lcBest = lcScore, lcTime = lcElapsed;
+
+                    /* Further checks are slower */
+                    break;
+
+                /* Select more accurate configuration while the target is not reached */
+                } else if ( ( lcBest < lcTarget ) && ( lcScore > lcBest ) ) { * lcConfig = lcCandidate, lcBest = lcScore, lcTime = lcElapsed; }
+
+            }
+
+        }
+
+        /* Return selected configuration recall */
+        return( lcBest );
+
+    }
+
+/*
+    Source - Index configuration reading
+ */
+
+    bool lc_flann_read( char const * const lcPath, lc_Flann_t * const lcConfig ) {
+
+        /* Input stream variables */
+        std::ifstream lcStream( lcPath );
+
+        /* Configuration variables */
+        lc_Flann_t lcRead;
+
+        /* Read configuration */
+        if ( ! ( lcStream >> lcRead.type >> lcRead.trees >> lcRead.branch >> lcRead.checks ) ) return( false );
+
+        /* Verify configuration */
+        if ( ( ( lcRead.type != LC_FLANN_KDTREE ) && ( lcRead.type != LC_FLANN_KMEANS ) ) || ( lcRead.trees < 1 ) || ( lcRead.branch < 2 ) || ( lcRead.checks < 1 ) ) return( false );
+
+        /* Assign configuration */
+        * lcConfig = lcRead;
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Index configuration exportation
+ */
+
+    bool lc_flann_write( char const * const lcPath, lc_Flann_t const * const lcConfig ) {
+
+        /* Output stream variables */
+        std::ofstream lcStream( lcPath );
+
+        /* Check stream openning */
+        if ( lcStream.is_open() == false ) return( false );
+
+        /* Export configuration */
+        lcStream << lcConfig->type << " " << lcConfig->trees << " " << lcConfig->branch << " " << lcConfig->checks << std::endl;
+
+        /* Close output stream */
+        lcStream.close();
+
+        /* Return stream state */
+        return( lcStream.fail() == false );
+
+    }
+
@@ -0,0 +1,254 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-flann.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Persistent FLANN descriptors index
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_FLANN__
+    # define __LC_FLANN__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <string>
+    # include <vector>
+    # include <algorithm>
+    # include <cstdio>
+    # include <chrono>
+    # include <fstream>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include "common.hpp"
+    # include "common-brute.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define index types */
+    # define LC_FLANN_KDTREE    0
+    # define LC_FLANN_KMEANS    1
+
+    /* Define default index configuration - cv::FlannBasedMatcher defaults */
+    # define LC_FLANN_TREES     4
+    # define LC_FLANN_BRANCH    32
+    # define LC_FLANN_CHECKS    32
+
+    /* Define auto-tuning queries sample size */
+    # define LC_FLANN_SAMPLE    1000
+
+    /* Define persistent index files extension */
+    # define LC_FLANN_EXTENSION ".flann"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Flann_struct
+     *  \brief FLANN configuration structure
+     *
+     *  Structure that stores the configuration of a FLANN index and of the
+     *  searches performed on it.
+     *
+     *  \var lc_Flann_struct::type
+     *  Index type, randomized kd-trees or hierarchical k-means tree
+     *  \var lc_Flann_struct::trees
+     *  Amount of randomized kd-trees of the index
+     *  \var lc_Flann_struct::branch
+     *  Branching factor of the k-means tree
+     *  \var lc_Flann_struct::checks
+     *  Amount of leaves visited during searches
+     */
+
+    typedef struct lc_Flann_struct {
+
+        int type;
+        int trees;
+        int branch;
+        int checks;
+
+    } lc_Flann_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Descriptors index preparation
+     *
+     *  This function provides the FLANN index of the train descriptors. If a
+     *  persistent index path is given and the index file is not older than
+     *  the source of the descriptors, and than their projection basis, the
+     *  index is loaded instead of being built. Otherwise, the index is built and saved in the index file so
+     *  that later processes using the same train descriptors only pay for
+     *  their queries. The index file is written under a temporary name and
+     *  renamed, so that concurrent processes never load a partial index.
+     *
+     *  The descriptors matrix is referenced by the index and has to remain
+     *  valid during its use. Only the index structure is loaded, the
+     *  descriptors staying in their shared mapping.
+     *
+     *  \param  lcIndex     Index to prepare
+     *  \param  lcTrain     Train descriptors matrix (CV_32F)
+     *  \param  lcConfig    Index configuration
+     *  \param  lcPath      Path of the persistent index, NULL for none
+     *  \param  lcSource    Path of the file providing the train descriptors
+     *  \param  lcBasis     Path of the basis the train descriptors are
+     *                      projected on, NULL for none
+     *
+     *  \return Returns false if the index cannot be saved, true otherwise. In
+     *  both cases the index is usable.
+     */
+
+    bool lc_flann_index ( cv::flann::Index & lcIndex, cv::Mat const & lcTrain, lc_Flann_t const * const lcConfig, char const * const lcPath, char const * const lcSource, char const * const lcBasis );
+
+    /*! \brief Descriptors index search
+     *
+     *  This function searches the approximated nearest train descriptor of
+     *  each query descriptor using the provided index. Matches are given in
+     *  the format of cv::DescriptorMatcher::match, with euclidean distances.
+     *
+     *  \param  lcIndex     Prepared index of the train descriptors
+     *  \param  lcQuery     Query descriptors matrix (CV_32F)
+     *  \param  lcConfig    Index configuration
+     *  \param  lcMatch     Array receiving the matches
+     */
+
+    void lc_flann_match ( cv::flann::Index & lcIndex, cv::Mat const & lcQuery, lc_Flann_t const * const lcConfig, std::vector < cv::DMatch > & lcMatch );
+
+    /*! \brief Descriptors index neighbours search
+     *
+     *  This function searches the approximated nearest train descriptors of
+     *  each query descriptor using the provided index. The neighbours of each
+     *  query are sorted by increasing euclidean distance, as with the method
+     *  cv::DescriptorMatcher::knnMatch. The amount of neighbours has not to
+     *  exceed the amount of train descriptors.
+     *
+     *  \param  lcIndex     Prepared index of the train descriptors
+     *  \param  lcQuery     Query descriptors matrix (CV_32F)
+     *  \param  lcConfig    Index configuration
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     *  \param  lcK         Amount of neighbours
+     */
+
+    void lc_flann_knn ( cv::flann::Index & lcIndex, cv::Mat const & lcQuery, lc_Flann_t const * const lcConfig, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK );
+
+    /*! \brief Index configuration tag
+     *
+     *  This function returns a string identifying the index structure of the
+     *  provided configuration. It is used to name persistent index files so
+     *  that an index built with another configuration is never loaded.
+     *
+     *  \param  lcConfig    Index configuration
+     *
+     *  \return Returns the configuration tag
+     */
+
+    std::string lc_flann_tag ( lc_Flann_t const * const lcConfig );
+
+    /*! \brief Index configuration auto-tuning
+     *
+     *  This function searches the fastest index configuration reaching the
+     *  provided recall. A sample of the query descriptors is taken and their
+     *  exact nearest neighbours are computed. Kd-trees forests and k-means
+     *  trees of several sizes are then built and searched with increasing
+     *  amounts of checks. The configuration with the lowest search time among
+     *  the ones reaching the recall is kept. If none reaches it, the most
+     *  accurate configuration is kept.
+     *
+     *  \param  lcQuery     Query descriptors matrix (CV_32F)
+     *  \param  lcTrain     Train descriptors matrix (CV_32F)
+     *  \param  lcTarget    Recall target, in [0,1]
+     *  \param  lcConfig    Receives the selected configuration
+     *
+     *  \return Returns the recall of the selected configuration
+     */
+
+    double lc_flann_autotune ( cv::Mat const & lcQuery, cv::Mat const & lcTrain, double const lcTarget, lc_Flann_t * const lcConfig );
+
+    /*! \brief Index configuration reading
+     *
+     *  This function reads an index configuration from the provided file, as
+     *  written by \b lc_flann_write.
+     *
+     *  \param  lcPath      Path of the configuration file
+     *  \param  lcConfig    Receives the configuration
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_flann_read ( char const * const lcPath, lc_Flann_t * const lcConfig );
+
+    /*! \brief Index configuration exportation
+     *
+     *  This function exports the provided index configuration in a text file
+     *  made of a single line giving the index type, the amount of trees, the
+     *  branching factor and the amount of checks.
+     *
+     *  \param  lcPath      Path of the configuration file
+     *  \param  lcConfig    Configuration to export
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_flann_write ( char const * const lcPath, lc_Flann_t const * const lcConfig );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,148 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-format.hpp"
+
+/*
+    Source - Binary header creation
+ */
+
+    lc_Header_t lc_format_header( char const * const lcMagic, char const * const lcLayout, uint32_t const lcWidth, uint64_t const lcCount ) {
+
+        /* Header variables */
+        lc_Header_t lcHeader;
+
+        /* Field size variables */
+        uint32_t lcSize( 0 );
+
+        /* Reset header */
+        memset( & lcHeader, 0, sizeof( lc_Header_t ) );
+
+        /* Compute record layout size */
+        for ( char const * lcField( lcLayout ); * lcField != '\0'; lcField ++ ) {
+
+            /* Accumulate field size */
+            lcSize += ( ( * lcField == 'b' ) || ( * lcField == 'B' ) ) ? 1 : 4;
+
+        }
+
+        /* Assign header fields - header reset keeps the padding */
+        memcpy( lcHeader.magic , lcMagic , std::min( strlen( lcMagic  ), ( size_t ) LC_FORMAT_MAGIC  ) );
+        memcpy( lcHeader.layout, lcLayout, std::min( strlen( lcLayout ), ( size_t ) LC_FORMAT_LAYOUT ) );
+
+        /* Assign header values */
+        lcHeader.version = LC_FORMAT_VERSION;
+        lcHeader.count   = lcCount;
+        lcHeader.width   = lcWidth;
+        lcHeader.size    = lcSize * lcWidth;
+
+        /* Return header */
+        return( lcHeader );
+
+    }
+
+/*
+    Source - Binary format detection
+ */
+
+    bool lc_format_detect( lc_Map_t const * const lcMap, char const * const lcMagic ) {
+
+        /* Check mapping size */
+        if ( lcMap->size < sizeof( lc_Header_t ) ) return( false );
+
+        /* Compare identification string */
+        return( strncmp( lcMap->data, lcMagic, LC_FORMAT_MAGIC ) == 0 );
+
+    }
+
+/*
+    Source - Binary header verification
+ */
+
+    lc_Header_t const * lc_format_check( lc_Map_t const * const lcMap, char const * const lcMagic, char const * const lcLayout ) {
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( ( lc_Header_t const * ) lcMap->data );
+
+        /* Verify identification string */
+        if ( lc_format_detect( lcMap, lcMagic ) == false ) return( NULL );
+
+        /* Verify version and layout */
+        if ( ( lcHeader->version != LC_FORMAT_VERSION ) || ( strncmp( lcHeader->layout, lcLayout, LC_FORMAT_LAYOUT ) != 0 ) ) return( NULL );
+
+        /* Verify record size */
+        if ( ( lcHeader->size == 0 ) || ( lcHeader->size != lc_format_header( lcMagic, lcLayout, lcHeader->width, 0 ).size ) ) return( NULL );
+
+        /* Verify records count against mapping size */
+        if ( lcHeader->count > ( lcMap->size - sizeof( lc_Header_t ) ) / lcHeader->size ) return( NULL );
+
+        /* Return header pointer */
+        return( lcHeader );
+
+    }
+
+/*
+    Source - Binary header identification
+ */
+
+    lc_Header_t const * lc_format_probe( lc_Map_t const * const lcMap ) {
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( ( lc_Header_t const * ) lcMap->data );
+
+        /* Header strings variables */
+        char lcMagic [LC_FORMAT_MAGIC  + 1] = { 0 };
+        char lcLayout[LC_FORMAT_LAYOUT + 1] = { 0 };
+
+        /* Check mapping size */
+        if ( lcMap->size < sizeof( lc_Header_t ) ) return( NULL );
+
+        /* Extract header strings */
+        memcpy( lcMagic , lcHeader->magic , LC_FORMAT_MAGIC  );
+        memcpy( lcLayout, lcHeader->layout, LC_FORMAT_LAYOUT );
+
+        /* Verify header against itself */
+        return( lc_format_check( lcMap, lcMagic, lcLayout ) );
+
+    }
+
@@ -0,0 +1,213 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-format.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Binary file format header interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_FORMAT__
+    # define __LC_FORMAT__
+
+/* 
+    Header - Includes
+ */
+
+    # include <algorithm>
+    # include "common.hpp"
+    # include "common-mapping.hpp"
+    # include <stdint.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define file formats */
+    # define LC_FORMAT_TEXT     0
+    # define LC_FORMAT_BINARY   1
+    # define LC_FORMAT_ARCHIVE  2
+    # define LC_FORMAT_DATABASE 3
+
+    /* Define binary format version */
+    # define LC_FORMAT_VERSION  1
+
+    /* Define binary header sizes */
+    # define LC_FORMAT_MAGIC    8
+    # define LC_FORMAT_LAYOUT   16
+
+    /* Define text padded count width */
+    # define LC_FORMAT_COUNT    20
+
+/* 
+    Header - Preprocessor macros
+ */
+
+    /* Compute pointer to binary records */
+    # define LC_FORMAT_DATA(m)  ( ( m ).data + sizeof( lc_Header_t ) )
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Header_struct
+     *  \brief Binary file header structure
+     *
+     *  Structure that stores the header of the suite binary files. The header
+     *  is 64 bytes long so that the records that follow it are aligned for
+     *  direct access through memory mapping. Values are stored in the host
+     *  byte order.
+     *
+     *  The layout string describes the fields of a record using one character
+     *  per field : 'i' for 32 bits signed integer, 'f' for 32 bits floating
+     *  point, 'b' for 8 bits signed integer and 'B' for 8 bits unsigned
+     *  integer. A record is made of width consecutive repetitions of the
+     *  layout, allowing matrix rows to be described.
+     *
+     *  \var lc_Header_struct::magic
+     *  Format identification string
+     *  \var lc_Header_struct::version
+     *  Format version
+     *  \var lc_Header_struct::flags
+     *  Format specific flags
+     *  \var lc_Header_struct::count
+     *  Number of records following the header
+     *  \var lc_Header_struct::size
+     *  Size, in bytes, of a record
+     *  \var lc_Header_struct::width
+     *  Number of repetitions of the layout in a record
+     *  \var lc_Header_struct::layout
+     *  Record fields description string
+     *  \var lc_Header_struct::scale
+     *  Quantization scale of 8 bits records, zero otherwise
+     *  \var lc_Header_struct::reserved
+     *  Reserved bytes
+     */
+
+    typedef struct lc_Header_struct {
+
+        char     magic[LC_FORMAT_MAGIC];
+        uint32_t version;
+        uint32_t flags;
+        uint64_t count;
+        uint32_t size;
+        uint32_t width;
+        char     layout[LC_FORMAT_LAYOUT];
+        float    scale;
+        char     reserved[12];
+
+    } lc_Header_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Binary header creation
+     *
+     *  This function initializes a binary header using the provided format
+     *  description. The record size is computed from the layout and width.
+     *
+     *  \param  lcMagic     Format identification string
+     *  \param  lcLayout    Record fields description string
+     *  \param  lcWidth     Number of repetitions of the layout in a record
+     *  \param  lcCount     Number of records
+     *
+     *  \return Returns the initialized header
+     */
+
+    lc_Header_t lc_format_header ( char const * const lcMagic, char const * const lcLayout, uint32_t const lcWidth, uint64_t const lcCount );
+
+    /*! \brief Binary format detection
+     *
+     *  This function checks if the provided file mapping starts with a binary
+     *  header carrying the specified identification string.
+     *
+     *  \param  lcMap       Mapping of the file to check
+     *  \param  lcMagic     Format identification string
+     *
+     *  \return Returns true if the mapping is a binary file of the specified
+     *  format, false otherwise
+     */
+
+    bool lc_format_detect ( lc_Map_t const * const lcMap, char const * const lcMagic );
+
+    /*! \brief Binary header verification
+     *
+     *  This function verifies the header of a binary file mapping against the
+     *  expected format. The identification string, the version, the layout
+     *  and the record size are checked as well as the consistency between the
+     *  records count and the mapping size.
+     *
+     *  \param  lcMap       Mapping of the binary file
+     *  \param  lcMagic     Expected format identification string
+     *  \param  lcLayout    Expected record fields description string
+     *
+     *  \return Returns a pointer to the mapped header on success, NULL
+     *  otherwise
+     */
+
+    lc_Header_t const * lc_format_check ( lc_Map_t const * const lcMap, char const * const lcMagic, char const * const lcLayout );
+
+    /*! \brief Binary header identification
+     *
+     *  This function checks if the provided file mapping starts with a valid
+     *  binary header of any format. The header is verified against its own
+     *  identification string and layout.
+     *
+     *  \param  lcMap       Mapping of the file to check
+     *
+     *  \return Returns a pointer to the mapped header on success, NULL
+     *  otherwise
+     */
+
+    lc_Header_t const * lc_format_probe ( lc_Map_t const * const lcMap );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,571 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-ivfpq.hpp"
+
+/*
+    Source - Index sections layout
+ */
+
+    static void lc_ivfpq_layout( lc_Quantizer_t const * const lcQuantizer, uint64_t const lcCount, uint64_t * const lcSection ) {
+
+        /* Inverted lists offsets section */
+        lcSection[0] = LC_IVFPQ_ALIGNED( sizeof( lc_Header_t ) + sizeof( lc_Quantizer_t ) );
+
+        /* Coarse centers section */
+        lcSection[1] = LC_IVFPQ_ALIGNED( lcSection[0] + ( uint64_t ) ( lcQuantizer->lists + 1 ) * sizeof( uint64_t ) );
+
+        /* Subspaces codebooks section */
+        lcSection[2] = LC_IVFPQ_ALIGNED( lcSection[1] + ( uint64_t ) lcQuantizer->lists * lcQuantizer->dimension * sizeof( float ) );
+
+        /* Entries section */
+        lcSection[3] = LC_IVFPQ_ALIGNED( lcSection[2] + ( uint64_t ) lcQuantizer->codes * lcQuantizer->dimension * sizeof( float ) );
+
+        /* Codes section */
+        lcSection[4] = LC_IVFPQ_ALIGNED( lcSection[3] + lcCount * sizeof( lc_Posting_t ) );
+
+        /* End of index */
+        lcSection[5] = lcSection[4] + lcCount * lcQuantizer->spaces;
+
+    }
+
+/*
+    Source - Coarse residuals
+ */
+
+    static void lc_ivfpq_residual( cv::Mat const & lcDesc, cv::Mat const & lcCoarse, std::vector < int > & lcList, cv::Mat & lcResidual ) {
+
+        /* Assignment variables */
+        std::vector < cv::DMatch > lcMatch;
+
+        /* Assign descriptors to nearest coarse centers */
+        lc_brute_match( lcDesc, lcCoarse, lcMatch );
+
+        /* Create residuals matrix */
+        lcResidual.create( lcDesc.rows, lcDesc.cols, CV_32FC1 );
+
+        /* Allocate lists array */
+        lcList.resize( lcDesc.rows );
+
+        /* Compute residuals */
+        for ( int lcParse( 0 ); lcParse < lcDesc.rows; lcParse ++ ) {
+
+            /* Rows pointer variables */
+            float const * lcRow   ( lcDesc.ptr < float > ( lcParse ) );
+            float const * lcCenter( lcCoarse.ptr < float > ( lcList[lcParse] = lcMatch[lcParse].trainIdx ) );
+            float       * lcDiff  ( lcResidual.ptr < float > ( lcParse ) );
+
+            /* Compute residual components */
+            for ( int lcComp( 0 ); lcComp < lcDesc.cols; lcComp ++ ) lcDiff[lcComp] = lcRow[lcComp] - lcCenter[lcComp];
+
+        }
+
+    }
+
+/*
+    Source - Residuals subspace
+ */
+
+    static void lc_ivfpq_subspace( cv::Mat const & lcResidual, int const lcSpace, int const lcWidth, cv::Mat & lcSub ) {
+
+        /* Create subspace matrix */
+        lcSub.create( lcResidual.rows, lcWidth, CV_32FC1 );
+
+        /* Extract subspace components - contiguous rows for the brute-force kernel */
+        for ( int lcParse( 0 ); lcParse < lcResidual.rows; lcParse ++ ) memcpy( lcSub.ptr < float > ( lcParse ), lcResidual.ptr < float > ( lcParse ) + lcSpace * lcWidth, lcWidth * sizeof( float ) );
+
+    }
+
+/*
+    Source - Section padding
+ */
+
+    static void lc_ivfpq_pad( lc_Writer_t * const lcWriter, uint64_t & lcOffset, uint64_t const lcTarget ) {
+
+        /* Padding bytes variables */
+        static char const lcZero[LC_IVFPQ_ALIGN] = { 0 };
+
+        /* Write padding bytes */
+        lc_writer_raw( lcWriter, lcZero, lcTarget - lcOffset );
+
+        /* Update offset */
+        lcOffset = lcTarget;
+
+    }
+
+/*
+    Source - Index building
+ */
+
+    bool lc_ivfpq_build( char const * const lcPath, lc_Store_t const * const lcStore, uint32_t const lcLists, uint32_t const lcSpaces, uint32_t const lcSample ) {
+
+        /* Store variables */
+        uint32_t lcSlots( lc_store_slots( lcStore ) );
+
+        /* Image variables */
+        std::vector < cv::KeyPoint > lcKey;
+        cv::Mat lcDesc;
+        cv::Mat lcFloat;
+
+        /* Dimensions variables */
+        uint64_t lcTotal( 0 );
+        int      lcDimension( 0 );
+        int      lcWidth( 0 );
+
+        /* Training variables */
+        cv::Mat lcTrain;
+        cv::Mat lcCoarse;
+        cv::Mat lcResidual;
+        cv::Mat lcSub;
+        std::vector < cv::Mat > lcBook( lcSpaces );
+        std::vector < int > lcLabel;
+
+        /* Encoding variables */
+        std::vector < cv::DMatch   > lcWord;
+        std::vector < uint32_t     > lcList;
+        std::vector < lc_Posting_t > lcEntry;
+        std::vector < uint8_t      > lcCode;
+
+        /* Inverted lists variables */
+        std::vector < uint64_t > lcOffset;
+        std::vector < uint64_t > lcFill;
+        std::vector < uint64_t > lcOrder;
+
+        /* File variables */
+        lc_Quantizer_t lcQuantizer = { 0, 0, 0, 0, { 0 } };
+        lc_Header_t    lcHeader;
+        lc_Writer_t    lcWriter;
+        uint64_t       lcSection[6];
+        uint64_t       lcWritten( 0 );
+        std::string    lcTemp( std::string( lcPath ) + "." + std::to_string( getpid() ) );
+
+        /* Compose training sample - descriptors are taken with a regular stride over the store */
+        if ( lc_store_sample( lcStore, lcSample, lcTrain, & lcTotal ) == false ) return( false );
+
+        /* Check subspaces */
+        if ( ( lcLists == 0 ) || ( lcSpaces == 0 ) || ( ( lcDimension = lcTrain.cols ) % lcSpaces != 0 ) ) return( false );
+
+        /* Compute subspaces width */
+        lcWidth = lcDimension / lcSpaces;
+
+        /* Compute coarse centers */
+        lc_kmeans( lcTrain, lcLists, LC_KMEANS_ITERATION, lcCoarse, NULL );
+
+        /* Compute training residuals */
+        lc_ivfpq_residual( lcTrain, lcCoarse, lcLabel, lcResidual );
+
+        /* Compute subspaces codebooks */
+        for ( uint32_t lcSpace( 0 ); lcSpace < lcSpaces; lcSpace ++ ) {
+
+            /* Codebook variables */
+            cv::Mat lcCenter;
+
+            /* Extract residuals subspace */
+            lc_ivfpq_subspace( lcResidual, lcSpace, lcWidth, lcSub );
+
+            /* Cluster residuals subspace */
+            lc_kmeans( lcSub, LC_IVFPQ_CODES, LC_KMEANS_ITERATION, lcCenter, NULL );
+
+            /* Create complete codebook */
+            lcBook[lcSpace].create( LC_IVFPQ_CODES, lcWidth, CV_32FC1 );
+
+            /* Copy codewords - small samples repeat the last codeword, never selected */
+            for ( int lcParse( 0 ); lcParse < LC_IVFPQ_CODES; lcParse ++ ) memcpy( lcBook[lcSpace].ptr < float > ( lcParse ), lcCenter.ptr < float > ( std::min( lcParse, lcCenter.rows - 1 ) ), lcWidth * sizeof( float ) );
+
+        }
+
+        /* Release training sample */
+        lcTrain.release(); lcResidual.release();
+
+        /* Allocate encoding arrays */
+        lcList.reserve( lcTotal ); lcEntry.reserve( lcTotal ); lcCode.resize( lcTotal * lcSpaces );
+
+        /* Encode store descriptors */
+        for ( uint32_t lcImage( 0 ); lcImage < lcSlots; lcImage ++ ) {
+
+            /* Read image descriptors */
+            if ( ( lc_store_read( lcStore, lcImage, lcKey, lcDesc ) == false ) || ( lcDesc.rows == 0 ) ) continue;
+
+            /* Convert descriptors */
+            lc_store_float( lcStore, lcDesc, lcFloat );
+
+            /* Compute coarse residuals */
+            lc_ivfpq_residual( lcFloat, lcCoarse, lcLabel, lcResidual );
+
+            /* Encode residuals subspaces */
+            for ( uint32_t lcSpace( 0 ); lcSpace < lcSpaces; lcSpace ++ ) {
+
+                /* Extract residuals subspace */
+                lc_ivfpq_subspace( lcResidual, lcSpace, lcWidth, lcSub );
+
+                /* Search nearest codewords */
+                lc_brute_match( lcSub, lcBook[lcSpace], lcWord );
+
+                /* Assign code bytes */
+                for ( int lcParse( 0 ); lcParse < lcSub.rows; lcParse ++ ) lcCode[( lcEntry.size() + lcParse ) * lcSpaces + lcSpace] = lcWord[lcParse].trainIdx;
+
+            }
+
+            /* Push entries */
+            for ( int lcParse( 0 ); lcParse < lcFloat.rows; lcParse ++ ) {
+
+                /* Entry variables */
+                lc_Posting_t lcItem = { lcImage, ( uint32_t ) lcParse };
+
+                /* Push entry and its list */
+                lcEntry.push_back( lcItem ), lcList.push_back( lcLabel[lcParse] );
+
+            }
+
+        }
+
+        /* Initialize quantizer description */
+        lcQuantizer.dimension = lcDimension;
+        lcQuantizer.lists     = lcCoarse.rows;
+        lcQuantizer.spaces    = lcSpaces;
+        lcQuantizer.codes     = LC_IVFPQ_CODES;
+
+        /* Count inverted lists entries */
+        lcOffset.assign( lcQuantizer.lists + 1, 0 );
+
+        /* Accumulate lists sizes */
+        for ( uint64_t lcParse( 0 ); lcParse < lcTotal; lcParse ++ ) lcOffset[lcList[lcParse] + 1] ++;
+
+        /* Compute lists offsets */
+        for ( uint32_t lcParse( 0 ); lcParse < lcQuantizer.lists; lcParse ++ ) lcOffset[lcParse + 1] += lcOffset[lcParse];
+
+        /* Sort entries by list - stable counting sort */
+        lcFill = lcOffset; lcOrder.resize( lcTotal );
+
+        /* Compute entries order */
+        for ( uint64_t lcParse( 0 ); lcParse < lcTotal; lcParse ++ ) lcOrder[lcFill[lcList[lcParse]] ++] = lcParse;
+
+        /* Compute index sections layout */
+        lc_ivfpq_layout( & lcQuantizer, lcTotal, lcSection );
+
+        /* Create index header */
+        lcHeader = lc_format_header( LC_IVFPQ_MAGIC, LC_IVFPQ_LAYOUT, 1, lcTotal );
+
+        /* Create temporary index */
+        if ( lc_writer_open( lcTemp.c_str(), & lcWriter ) == false ) return( false );
+
+        /* Write header and quantizer description */
+        lc_writer_raw( & lcWriter, & lcHeader, sizeof( lc_Header_t ) ); lc_writer_raw( & lcWriter, & lcQuantizer, sizeof( lc_Quantizer_t ) );
+
+        /* Write inverted lists offsets */
+        lc_ivfpq_pad( & lcWriter, lcWritten = sizeof( lc_Header_t ) + sizeof( lc_Quantizer_t ), lcSection[0] ); lc_writer_raw( & lcWriter, lcOffset.data(), lcOffset.size() * sizeof( uint64_t ) );
+
+        /* Write coarse centers */
+        lc_ivfpq_pad( & lcWriter, lcWritten += lcOffset.size() * sizeof( uint64_t ), lcSection[1] );
+
+        /* Write coarse centers rows */
+        for ( int lcParse( 0 ); lcParse < lcCoarse.rows; lcParse ++ ) lc_writer_raw( & lcWriter, lcCoarse.ptr < float > ( lcParse ), lcDimension * sizeof( float ) );
+
+        /* Write subspaces codebooks */
+        lc_ivfpq_pad( & lcWriter, lcWritten += ( uint64_t ) lcCoarse.rows * lcDimension * sizeof( float ), lcSection[2] );
+
+        /* Write codebooks rows */
+        for ( uint32_t lcSpace( 0 ); lcSpace < lcSpaces; lcSpace ++ ) for ( int lcParse( 0 ); lcParse < LC_IVFPQ_CODES; lcParse ++ ) lc_writer_raw( & lcWriter, lcBook[lcSpace].ptr < float > ( lcParse ), lcWidth * sizeof( float ) );
+
+        /* Write entries */
+        lc_ivfpq_pad( & lcWriter, lcWritten += ( uint64_t ) LC_IVFPQ_CODES * lcDimension * sizeof( float ), lcSection[3] );
+
+        /* Write sorted entries */
+        for ( uint64_t lcParse( 0 ); lcParse < lcTotal; lcParse ++ ) lc_writer_raw( & lcWriter, & lcEntry[lcOrder[lcParse]], sizeof( lc_Posting_t ) );
+
+        /* Write codes */
+        lc_ivfpq_pad( & lcWriter, lcWritten += lcTotal * sizeof( lc_Posting_t ), lcSection[4] );
+
+        /* Write sorted codes */
+        for ( uint64_t lcParse( 0 ); lcParse < lcTotal; lcParse ++ ) lc_writer_raw( & lcWriter, & lcCode[lcOrder[lcParse] * lcSpaces], lcSpaces );
+
+        /* Close temporary index and publish it */
+        if ( ( lc_writer_close( & lcWriter ) == false ) || ( rename( lcTemp.c_str(), lcPath ) != 0 ) ) {
+
+            /* Remove temporary index */
+            unlink( lcTemp.c_str() );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Index opening
+ */
+
+    bool lc_ivfpq_open( char const * const lcPath, lc_Ivfpq_t * const lcIndex ) {
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( NULL );
+
+        /* Sections variables */
+        uint64_t lcSection[6];
+
+        /* Map index file */
+        if ( lc_map_open( lcPath, & lcIndex->map ) == false ) return( false );
+
+        /* Verify header and quantizer description size */
+        if ( ( ( lcHeader = lc_format_check( & lcIndex->map, LC_IVFPQ_MAGIC, LC_IVFPQ_LAYOUT ) ) == NULL ) || ( lcIndex->map.size < sizeof( lc_Header_t ) + sizeof( lc_Quantizer_t ) ) ) {
+
+            /* Release mapping */
+            lc_ivfpq_close( lcIndex );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Assign quantizer pointer and descriptors count */
+        lcIndex->quantizer = ( lc_Quantizer_t const * ) ( lcIndex->map.data + sizeof( lc_Header_t ) ), lcIndex->count = lcHeader->count;
+
+        /* Verify quantizer description */
+        if ( ( lcIndex->quantizer->lists == 0 ) || ( lcIndex->quantizer->spaces == 0 ) || ( lcIndex->quantizer->codes != LC_IVFPQ_CODES ) || ( lcIndex->quantizer->dimension % lcIndex->quantizer->spaces != 0 ) ) {
+
+            /* Release mapping */
+            lc_ivfpq_close( lcIndex );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Compute index sections layout */
+        lc_ivfpq_layout( lcIndex->quantizer, lcIndex->count, lcSection );
+
+        /* Verify index size */
+        if ( lcSection[5] > lcIndex->map.size ) {
+
+            /* Release mapping */
+            lc_ivfpq_close( lcIndex );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Assign sections pointers */
+        lcIndex->offset   = ( uint64_t     const * ) ( lcIndex->map.data + lcSection[0] );
+        lcIndex->coarse   = ( float        const * ) ( lcIndex->map.data + lcSection[1] );
+        lcIndex->codebook = ( float        const * ) ( lcIndex->map.data + lcSection[2] );
+        lcIndex->entry    = ( lc_Posting_t const * ) ( lcIndex->map.data + lcSection[3] );
+        lcIndex->code     = ( uint8_t      const * ) ( lcIndex->map.data + lcSection[4] );
+
+        /* Verify inverted lists offsets */
+        if ( lcIndex->offset[lcIndex->quantizer->lists] != lcIndex->count ) {
+
+            /* Release mapping */
+            lc_ivfpq_close( lcIndex );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Advise random access - only the visited lists are read */
+        madvise( lcIndex->map.data, lcIndex->map.size, MADV_RANDOM );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Index closure
+ */
+
+    void lc_ivfpq_close( lc_Ivfpq_t * const lcIndex ) {
+
+        /* Release mapping */
+        lc_map_close( & lcIndex->map );
+
+    }
+
+/*
+    Source - Index neighbours search
+ */
+
+    void lc_ivfpq_search( lc_Ivfpq_t const * const lcIndex, cv::Mat const & lcQuery, int const lcProbe, int const lcK, std::vector < std::vector < cv::DMatch > > & lcMatch ) {
+
+        /* Quantizer variables */
+        int lcLists    ( lcIndex->quantizer->lists );
+        int lcSpaces   ( lcIndex->quantizer->spaces );
+        int lcDimension( lcIndex->quantizer->dimension );
+        int lcWidth    ( lcDimension / lcSpaces );
+        int lcVisit    ( std::min( lcProbe, lcLists ) );
+
+        /* Reset matches array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check query descriptors */
+        if ( ( lcQuery.cols != lcDimension ) || ( lcVisit < 1 ) || ( lcK < 1 ) ) return;
+
+        /* Process queries */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic )
+        # endif
+        for ( int lcParse = 0; lcParse < lcQuery.rows; lcParse ++ ) {
+
+            /* Query pointer variables */
+            float const * lcRow( lcQuery.ptr < float > ( lcParse ) );
+
+            /* Coarse distances variables */
+            std::vector < std::pair < float, int > > lcCoarse( lcLists );
+
+            /* Residual and distances table variables */
+            std::vector < float > lcResidual( lcDimension );
+            std::vector < float > lcTable( lcSpaces * LC_IVFPQ_CODES );
+
+            /* Neighbours variables - sorted by increasing distance */
+            std::vector < float    > lcBest( lcK, HUGE_VALF );
+            std::vector < uint64_t > lcNear( lcK, lcIndex->count );
+
+            /* Compute coarse distances */
+            for ( int lcList( 0 ); lcList < lcLists; lcList ++ ) {
+
+                /* Center pointer variables */
+                float const * lcCenter( lcIndex->coarse + ( size_t ) lcList * lcDimension );
+
+                /* Distance variables */
+                float lcDist( 0.0 );
+
+                /* Accumulate squared differences */
+                for ( int lcComp( 0 ); lcComp < lcDimension; lcComp ++ ) lcDist += ( lcRow[lcComp] - lcCenter[lcComp] ) * ( lcRow[lcComp] - lcCenter[lcComp] );
+
+                /* Assign coarse distance */
+                lcCoarse[lcList] = std::make_pair( lcDist, lcList );
+
+            }
+
+            /* Select nearest coarse centers */
+            std::partial_sort( lcCoarse.begin(), lcCoarse.begin() + lcVisit, lcCoarse.end() );
+
+            /* Visit inverted lists */
+            for ( int lcProbed( 0 ); lcProbed < lcVisit; lcProbed ++ ) {
+
+                /* List variables */
+                int lcList( lcCoarse[lcProbed].second );
+
+                /* Center pointer variables */
+                float const * lcCenter( lcIndex->coarse + ( size_t ) lcList * lcDimension );
+
+                /* Compute query residual */
+                for ( int lcComp( 0 ); lcComp < lcDimension; lcComp ++ ) lcResidual[lcComp] = lcRow[lcComp] - lcCenter[lcComp];
+
+                /* Tabulate subspaces distances */
+                for ( int lcSpace( 0 ); lcSpace < lcSpaces; lcSpace ++ ) {
+
+                    /* Subspace pointer variables */
+                    float const * lcSub( lcResidual.data() + lcSpace * lcWidth );
+
+                    /* Compute codewords distances */
+                    for ( int lcWord( 0 ); lcWord < LC_IVFPQ_CODES; lcWord ++ ) {
+
+                        /* Codeword pointer variables */
+                        float const * lcCode( lcIndex->codebook + ( ( size_t ) lcSpace * LC_IVFPQ_CODES + lcWord ) * lcWidth );
+
+                        /* Distance variables */
+                        float lcDist( 0.0 );
+
+                        /* Accumulate squared differences */
+                        for ( int lcComp( 0 ); lcComp < lcWidth; lcComp ++ ) lcDist += ( lcSub[lcComp] - lcCode[lcComp] ) * ( lcSub[lcComp] - lcCode[lcComp] );
+
+                        /* Assign table value */
+                        lcTable[lcSpace * LC_IVFPQ_CODES + lcWord] = lcDist;
+
+                    }
+
+                }
+
+                /* Scan list entries */
+                for ( uint64_t lcEntry( lcIndex->offset[lcList] ); lcEntry < lcIndex->offset[lcList + 1]; lcEntry ++ ) {
+
+                    /* Code pointer variables */
+                    uint8_t const * lcCode( lcIndex->code + lcEntry * lcSpaces );
+
+                    /* Distance variables */
+                    float lcDist( 0.0 );
+
+                    /* Position variables */
+                    int lcPosition( lcK - 1 );
+
+                    /* Accumulate tabulated distances */
+                    for ( int lcSpace( 0 ); lcSpace < lcSpaces; lcSpace ++ ) lcDist += lcTable[lcSpace * LC_IVFPQ_CODES + lcCode[lcSpace]];
+
+                    /* Check neighbour candidate */
+                    if ( lcDist >= lcBest[lcK - 1] ) continue;
+
+                    /* Shift farther neighbours */
+                    while ( ( lcPosition > 0 ) && ( lcDist < lcBest[lcPosition - 1] ) ) {
+
+                        /* Shift neighbour */
+                        lcBest[lcPosition] = lcBest[lcPosition - 1], lcNear[lcPosition] = lcNear[lcPosition - 1];
+
+                        /* Update position */
+                        lcPosition --;
+
+                    }
+
+                    /* Insert neighbour */
+                    lcBest[lcPosition] = lcDist, lcNear[lcPosition] = lcEntry;
+
+                }
+
+            }
+
+            /* Export neighbours */
+            for ( int lcNeighbour( 0 ); ( lcNeighbour < lcK ) && ( lcNear[lcNeighbour] < lcIndex->count ); lcNeighbour ++ ) {
+
+                /* Push neighbour - distance is squared */
+                lcMatch[lcParse].push_back( cv::DMatch( lcParse, lcIndex->entry[lcNear[lcNeighbour]].keypoint, lcIndex->entry[lcNear[lcNeighbour]].image, std::sqrt( std::max( lcBest[lcNeighbour], 0.0f ) ) ) );
+
+            }
+
+        }
+
+    }
+
@@ -0,0 +1,282 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-ivfpq.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Inverted file product quantization index
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_IVFPQ__
+    # define __LC_IVFPQ__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <string>
+    # include <vector>
+    # include <cstring>
+    # include <algorithm>
+    # include <stdint.h>
+    # include <unistd.h>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-writer.hpp"
+    # include "common-store.hpp"
+    # include "common-brute.hpp"
+    # include "common-kmeans.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define index file format */
+    # define LC_IVFPQ_MAGIC     "FSIVFPQX"
+    # define LC_IVFPQ_LAYOUT    "ii"
+
+    /* Define sections alignment */
+    # define LC_IVFPQ_ALIGN     64
+
+    /* Define amount of codewords per subspace */
+    # define LC_IVFPQ_CODES     256
+
+    /* Define default amount of inverted lists */
+    # define LC_IVFPQ_LISTS     1024
+
+    /* Define default amount of subspaces */
+    # define LC_IVFPQ_SPACES    16
+
+    /* Define default training sample size */
+    # define LC_IVFPQ_SAMPLE    131072
+
+    /* Define default amount of visited lists */
+    # define LC_IVFPQ_PROBES    16
+
+/* 
+    Header - Preprocessor macros
+ */
+
+    /* Align offset on sections alignment */
+    # define LC_IVFPQ_ALIGNED(o) ( ( ( o ) + LC_IVFPQ_ALIGN - 1 ) & ~ ( uint64_t ) ( LC_IVFPQ_ALIGN - 1 ) )
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Quantizer_struct
+     *  \brief Index quantizer structure
+     *
+     *  Structure that follows the header of the index file and describes its
+     *  quantizers. The header records count gives the amount of indexed
+     *  descriptors. The structure is followed, on aligned offsets, by the
+     *  offsets of the inverted lists, the coarse centers, the subspaces
+     *  codebooks, the entries and the codes of the indexed descriptors, the
+     *  entries and codes being sorted by inverted list.
+     *
+     *  \var lc_Quantizer_struct::dimension
+     *  Amount of components of the descriptors
+     *  \var lc_Quantizer_struct::lists
+     *  Amount of inverted lists, i.e. of coarse centers
+     *  \var lc_Quantizer_struct::spaces
+     *  Amount of subspaces, i.e. of code bytes per descriptor
+     *  \var lc_Quantizer_struct::codes
+     *  Amount of codewords per subspace
+     *  \var lc_Quantizer_struct::reserved
+     *  Reserved bytes
+     */
+
+    typedef struct lc_Quantizer_struct {
+
+        uint32_t dimension;
+        uint32_t lists;
+        uint32_t spaces;
+        uint32_t codes;
+        char     reserved[48];
+
+    } lc_Quantizer_t;
+
+    /*! \struct lc_Posting_struct
+     *  \brief Index posting structure
+     *
+     *  Structure that identifies the keypoint of an indexed descriptor.
+     *
+     *  \var lc_Posting_struct::image
+     *  Store identifier of the image
+     *  \var lc_Posting_struct::keypoint
+     *  Index of the keypoint in the image
+     */
+
+    typedef struct lc_Posting_struct {
+
+        uint32_t image;
+        uint32_t keypoint;
+
+    } lc_Posting_t;
+
+    /*! \struct lc_Ivfpq_struct
+     *  \brief Index structure
+     *
+     *  Structure that stores the mapping of an opened index file and the
+     *  pointers to its sections. The file is mapped read-only and shared, so
+     *  that concurrent queries use a single copy of the index.
+     *
+     *  \var lc_Ivfpq_struct::map
+     *  Mapping of the index file
+     *  \var lc_Ivfpq_struct::count
+     *  Amount of indexed descriptors
+     *  \var lc_Ivfpq_struct::quantizer
+     *  Pointer to the quantizer description
+     *  \var lc_Ivfpq_struct::offset
+     *  Pointer to the inverted lists offsets, lists + 1 values
+     *  \var lc_Ivfpq_struct::coarse
+     *  Pointer to the coarse centers, one row per list
+     *  \var lc_Ivfpq_struct::codebook
+     *  Pointer to the subspaces codebooks
+     *  \var lc_Ivfpq_struct::entry
+     *  Pointer to the entries
+     *  \var lc_Ivfpq_struct::code
+     *  Pointer to the codes, spaces bytes per entry
+     */
+
+    typedef struct lc_Ivfpq_struct {
+
+        lc_Map_t               map;
+        uint64_t               count;
+        lc_Quantizer_t const * quantizer;
+        uint64_t       const * offset;
+        float          const * coarse;
+        float          const * codebook;
+        lc_Posting_t   const * entry;
+        uint8_t        const * code;
+
+    } lc_Ivfpq_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Index building
+     *
+     *  This function builds the inverted file product quantization index of
+     *  all the descriptors of a features store. The coarse centers are
+     *  computed by k-means clustering on a sample of the descriptors taken
+     *  with a regular stride over the whole store. The residuals of the sample
+     *  to their coarse center are split in subspaces, each of them being
+     *  clustered to obtain its codebook. Each descriptor of the store is then
+     *  assigned to its nearest coarse center and the nearest codewords of its
+     *  residual subspaces give its code. Entries keep the image identifier
+     *  and the keypoint index of each descriptor.
+     *
+     *  Quantized store descriptors are converted back to floating point using
+     *  the store scale. The index is written on a temporary file renamed on
+     *  the provided path once complete.
+     *
+     *  \param  lcPath      Path of the index file
+     *  \param  lcStore     Features store structure
+     *  \param  lcLists     Amount of inverted lists
+     *  \param  lcSpaces    Amount of subspaces, dividing the descriptors size
+     *  \param  lcSample    Maximum amount of training descriptors
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_ivfpq_build ( char const * const lcPath, lc_Store_t const * const lcStore, uint32_t const lcLists, uint32_t const lcSpaces, uint32_t const lcSample );
+
+    /*! \brief Index opening
+     *
+     *  This function maps the specified index file and verifies the layout of
+     *  its sections.
+     *
+     *  \param  lcPath      Path of the index file
+     *  \param  lcIndex     Index structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_ivfpq_open ( char const * const lcPath, lc_Ivfpq_t * const lcIndex );
+
+    /*! \brief Index closure
+     *
+     *  This function releases the mapping of the index.
+     *
+     *  \param  lcIndex     Index structure
+     */
+
+    void lc_ivfpq_close ( lc_Ivfpq_t * const lcIndex );
+
+    /*! \brief Index neighbours search
+     *
+     *  This function searches the nearest indexed descriptors of each query
+     *  descriptor. The query is compared to the coarse centers and the
+     *  inverted lists of the nearest ones are visited. For each visited list,
+     *  the distances between the query residual subspaces and the codewords
+     *  are tabulated, so that the distance to an indexed descriptor is the
+     *  sum of one table value per code byte (asymmetric distance computation).
+     *  Queries are processed in parallel.
+     *
+     *  The neighbours of each query are sorted by increasing approximated
+     *  euclidean distance. For each neighbour, the image identifier is given
+     *  by the imgIdx field and the keypoint index by the trainIdx field.
+     *
+     *  \param  lcIndex     Index structure
+     *  \param  lcQuery     Query descriptors matrix (CV_32F)
+     *  \param  lcProbe     Amount of visited inverted lists
+     *  \param  lcK         Amount of neighbours
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     */
+
+    void lc_ivfpq_search ( lc_Ivfpq_t const * const lcIndex, cv::Mat const & lcQuery, int const lcProbe, int const lcK, std::vector < std::vector < cv::DMatch > > & lcMatch );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
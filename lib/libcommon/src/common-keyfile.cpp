@@ -0,0 +1,271 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-keyfile.hpp"
+
+/*
+    Source - Keyfile exportation
+ */
+
+    bool lc_keyfile_write( char const * const lcPath, std::vector < cv::KeyPoint > const & lcKey, int const lcFormat ) {
+
+        /* Writer variables */
+        lc_Writer_t lcWriter;
+
+        /* Create output file */
+        if ( lc_writer_open( lcPath, & lcWriter ) == false ) return( false );
+
+        /* Check requested format */
+        if ( lcFormat == LC_FORMAT_BINARY ) {
+
+            /* Binary header variables */
+            lc_Header_t lcHeader( lc_format_header( LC_KEYFILE_MAGIC, LC_KEYFILE_LAYOUT, 1, lcKey.size() ) );
+
+            /* Record variables */
+            lc_Key_t lcRecord;
+
+            /* Export header */
+            lc_writer_raw( & lcWriter, & lcHeader, sizeof( lc_Header_t ) );
+
+            /* Export keypoints */
+            for ( size_t lcIndex( 0 ); lcIndex < lcKey.size(); lcIndex ++ ) {
+
+                /* Assign record fields */
+                lcRecord.x        = lcKey[lcIndex].pt.x;
+                lcRecord.y        = lcKey[lcIndex].pt.y;
+                lcRecord.size     = lcKey[lcIndex].size;
+                lcRecord.angle    = lcKey[lcIndex].angle;
+                lcRecord.response = lcKey[lcIndex].response;
+                lcRecord.octave   = lcKey[lcIndex].octave;
+
+                /* Export record */
+                lc_writer_raw( & lcWriter, & lcRecord, sizeof( lc_Key_t ) );
+
+            }
+
+        } else {
+
+            /* Export keypoints count */
+            lc_writer_integer( & lcWriter, lcKey.size() ); lc_writer_char( & lcWriter, '\n' );
+
+            /* Export keypoints */
+            for ( size_t lcIndex( 0 ); lcIndex < lcKey.size(); lcIndex ++ ) {
+
+                /* Export keypoint parameters */
+                lc_writer_float  ( & lcWriter, lcKey[lcIndex].pt.x     ); lc_writer_char( & lcWriter, ' '  );
+                lc_writer_float  ( & lcWriter, lcKey[lcIndex].pt.y     ); lc_writer_char( & lcWriter, ' '  );
+                lc_writer_float  ( & lcWriter, lcKey[lcIndex].size     ); lc_writer_char( & lcWriter, ' '  );
+                lc_writer_float  ( & lcWriter, lcKey[lcIndex].angle    ); lc_writer_char( & lcWriter, ' '  );
+                lc_writer_float  ( & lcWriter, lcKey[lcIndex].response ); lc_writer_char( & lcWriter, ' '  );
+                lc_writer_integer( & lcWriter, lcKey[lcIndex].octave   ); lc_writer_char( & lcWriter, '\n' );
+
+            }
+
+        }
+
+        /* Close output file and return state */
+        return( lc_writer_close( & lcWriter ) );
+
+    }
+
+/*
+    Source - Keyfile text line parser
+ */
+
+    static bool lc_keyfile_line( char const * lcLine, char const * const lcStop, void * const lcRecord ) {
+
+        /* Keypoint pointer variables */
+        cv::KeyPoint * lcKey( ( cv::KeyPoint * ) lcRecord );
+
+        /* Octave parsing variables */
+        long lcOctave( 0 );
+
+        /* Parse keypoint parameters */
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcKey->pt.x     ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcKey->pt.y     ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcKey->size     ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcKey->angle    ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcKey->response ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_integer( lcLine, lcStop, & lcOctave        ) ) == NULL ) return( false );
+
+        /* Check octave range */
+        if ( ( lcOctave < INT_MIN ) || ( lcOctave > INT_MAX ) ) return( false );
+
+        /* Assign keypoint octave */
+        lcKey->octave = lcOctave;
+
+        /* Return parsing status */
+        return( true );
+
+    }
+
+/*
+    Source - Keyfile importation
+ */
+
+    std::vector < cv::KeyPoint > lc_keyfile_read( char const * const lcPath ) {
+
+        /* Returned array variables */
+        std::vector < cv::KeyPoint > lcKey;
+
+        /* Mapping variables */
+        lc_Map_t lcMap;
+
+        /* Map keyfile */
+        if ( lc_map_open( lcPath, & lcMap ) == false ) return( lcKey );
+
+        /* Detect keyfile format */
+        if ( lc_format_detect( & lcMap, LC_KEYFILE_MAGIC ) == true ) {
+
+            /* Verify binary header */
+            lc_Header_t const * lcHeader( lc_format_check( & lcMap, LC_KEYFILE_MAGIC, LC_KEYFILE_LAYOUT ) );
+
+            /* Check binary header */
+            if ( lcHeader != NULL ) {
+
+                /* Records pointer variables */
+                lc_Key_t const * lcRecord( ( lc_Key_t const * ) LC_FORMAT_DATA( lcMap ) );
+
+                /* Allocate keypoints array */
+                lcKey.resize( lcHeader->count );
+
+                /* Convert records to keypoints */
+                for ( size_t lcIndex( 0 ); lcIndex < lcKey.size(); lcIndex ++ ) {
+
+                    /* Assign keypoint parameters */
+                    lcKey[lcIndex] = cv::KeyPoint( cv::Point2f( lcRecord[lcIndex].x, lcRecord[lcIndex].y ), lcRecord[lcIndex].size, lcRecord[lcIndex].angle, lcRecord[lcIndex].response, lcRecord[lcIndex].octave );
+
+                }
+
+            }
+
+        } else {
+
+            /* Records position variables */
+            char const * lcBody( NULL );
+
+            /* Parse keypoints count */
+            long lcCount( lc_parse_count( & lcMap, & lcBody ) );
+
+            /* Check keypoints count */
+            if ( lcCount > 0 ) {
+
+                /* Parsed records variables */
+                size_t lcFound( 0 );
+
+                /* Allocate keypoints array */
+                lcKey.resize( lcCount );
+
+                /* Parse keypoints in parallel */
+                if ( lc_parse_records( lcBody, lcMap.data + lcMap.size, lcCount, lcKey.data(), sizeof( cv::KeyPoint ), & lc_keyfile_line, & lcFound ) == false ) {
+
+                    /* Reset keypoints array */
+                    lcKey.clear();
+
+                } else if ( lcFound < lcKey.size() ) {
+
+                    /* Display message - header count of edge-filtered keyfiles */
+                    std::cerr << "Warning : Keyfile " << lcPath << " holds " << lcFound << " of " << lcCount << " declared keypoints" << std::endl;
+
+                    /* Shrink keypoints array */
+                    lcKey.resize( lcFound );
+
+                }
+
+            }
+
+        }
+
+        /* Release mapping */
+        lc_map_close( & lcMap );
+
+        /* Return keypoints */
+        return( lcKey );
+
+    }
+
+/*
+    Source - Keypoints response comparison
+ */
+
+    static bool lc_keyfile_stronger( cv::KeyPoint const & lcFirst, cv::KeyPoint const & lcSecond ) {
+
+        /* Compare keypoints response */
+        return( lcFirst.response > lcSecond.response );
+
+    }
+
+/*
+    Source - Keypoints response ordering
+ */
+
+    void lc_keyfile_sort( std::vector < cv::KeyPoint > & lcKey ) {
+
+        /* Sort keypoints by decreasing response */
+        std::stable_sort( lcKey.begin(), lcKey.end(), & lc_keyfile_stronger );
+
+    }
+
+/*
+    Source - Keypoints priority order
+ */
+
+    void lc_keyfile_order( std::vector < cv::KeyPoint > const & lcKey, std::vector < int > & lcOrder ) {
+
+        /* Ranking variables - negated response and index */
+        std::vector < std::pair < float, int > > lcRank( lcKey.size() );
+
+        /* Compose ranking */
+        for ( size_t lcParse( 0 ); lcParse < lcKey.size(); lcParse ++ ) lcRank[lcParse] = std::make_pair( - lcKey[lcParse].response, ( int ) lcParse );
+
+        /* Sort by decreasing response - equal responses by index */
+        std::sort( lcRank.begin(), lcRank.end() );
+
+        /* Assign keypoints order */
+        lcOrder.resize( lcKey.size() );
+
+        /* Extract keypoints indexes */
+        for ( size_t lcParse( 0 ); lcParse < lcRank.size(); lcParse ++ ) lcOrder[lcParse] = lcRank[lcParse].second;
+
+    }
+
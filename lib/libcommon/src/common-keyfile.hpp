@@ -0,0 +1,183 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-keyfile.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Keypoints file interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_KEYFILE__
+    # define __LC_KEYFILE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <algorithm>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-parser.hpp"
+    # include "common-writer.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define binary keyfile format */
+    # define LC_KEYFILE_MAGIC   "FSKEYBIN"
+    # define LC_KEYFILE_LAYOUT  "fffffi"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Key_struct
+     *  \brief Keypoint record structure
+     *
+     *  Structure that stores a keypoint record as found in binary keyfiles.
+     *  Records are fixed-width and directly addressable in a file mapping.
+     *
+     *  \var lc_Key_struct::x
+     *  Position x of the keypoint
+     *  \var lc_Key_struct::y
+     *  Position y of the keypoint
+     *  \var lc_Key_struct::size
+     *  Diameter of the keypoint neighborhood
+     *  \var lc_Key_struct::angle
+     *  Orientation of the keypoint
+     *  \var lc_Key_struct::response
+     *  Detector response of the keypoint
+     *  \var lc_Key_struct::octave
+     *  Octave in which the keypoint has been detected
+     */
+
+    typedef struct lc_Key_struct {
+
+        float   x;
+        float   y;
+        float   size;
+        float   angle;
+        float   response;
+        int32_t octave;
+
+    } lc_Key_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Keyfile exportation
+     *
+     *  This function exports the provided keypoints in the specified file
+     *  using the text or binary format. The text format stores the keypoints
+     *  count on the first line followed by one keypoint per line. The binary
+     *  format stores a header followed by fixed-width keypoint records.
+     *
+     *  \param  lcPath      Path of the keyfile
+     *  \param  lcKey       Keypoints to export
+     *  \param  lcFormat    Keyfile format (LC_FORMAT_TEXT or LC_FORMAT_BINARY)
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_keyfile_write ( char const * const lcPath, std::vector < cv::KeyPoint > const & lcKey, int const lcFormat );
+
+    /*! \brief Keyfile importation
+     *
+     *  This function imports the keypoints stored in the specified file. The
+     *  format of the file is automatically detected. Binary keyfiles are
+     *  mapped in memory and their records are converted without parsing.
+     *  Text keyfiles holding less keypoints than their header count, as the
+     *  ones written by former detectors after edge filtering, are shrunk to
+     *  their available keypoints and a warning is displayed.
+     *
+     *  \param  lcPath      Path of the keyfile
+     *
+     *  \return Returns the imported keypoints, an empty array on failure
+     */
+
+    std::vector < cv::KeyPoint > lc_keyfile_read ( char const * const lcPath );
+
+    /*! \brief Keypoints response ordering
+     *
+     *  This function sorts the provided keypoints by decreasing response. The
+     *  sort is stable, keypoints of equal response keeping their detection
+     *  order. Any prefix of the sorted array then holds the strongest
+     *  keypoints, allowing consumers to read and describe only the first
+     *  keypoints of a keyfile.
+     *
+     *  \param  lcKey       Keypoints array to sort
+     */
+
+    void lc_keyfile_sort ( std::vector < cv::KeyPoint > & lcKey );
+
+    /*! \brief Keypoints priority order
+     *
+     *  This function computes the indexes of the provided keypoints by
+     *  decreasing response, without reordering the keypoints. Keypoints of
+     *  equal response keep their order, as with \b lc_keyfile_sort.
+     *
+     *  \param  lcKey       Keypoints array
+     *  \param  lcOrder     Array receiving the keypoints indexes
+     */
+
+    void lc_keyfile_order ( std::vector < cv::KeyPoint > const & lcKey, std::vector < int > & lcOrder );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,156 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-kmeans.hpp"
+
+/*
+    Source - Descriptors k-means clustering
+ */
+
+    void lc_kmeans( cv::Mat const & lcData, int const lcK, int const lcIteration, cv::Mat & lcCenter, std::vector < int > * const lcLabel ) {
+
+        /* Centers amount variables */
+        int lcCount( std::min( lcK, lcData.rows ) );
+
+        /* Assignment variables */
+        std::vector < cv::DMatch > lcMatch;
+
+        /* Accumulation variables */
+        std::vector < double > lcSum;
+        std::vector < int    > lcSize;
+
+        /* Convergence variables */
+        bool lcMove( true );
+
+        /* Previous assignment variables */
+        std::vector < int > lcPrevious( lcData.rows, -1 );
+
+        /* Create centers matrix */
+        lcCenter.create( lcCount, lcData.cols, CV_32FC1 );
+
+        /* Reset labels array */
+        if ( lcLabel != NULL ) lcLabel->assign( lcData.rows, 0 );
+
+        /* Check descriptors */
+        if ( lcCount == 0 ) return;
+
+        /* Initialize centers - descriptors are taken with a regular stride */
+        for ( int lcParse( 0 ); lcParse < lcCount; lcParse ++ ) memcpy( lcCenter.ptr < float > ( lcParse ), lcData.ptr < float > ( ( int ) ( ( int64_t ) lcParse * lcData.rows / lcCount ) ), lcData.cols * sizeof( float ) );
+
+        /* Lloyd iterations */
+        for ( int lcStep( 0 ); ( lcStep < lcIteration ) && ( lcMove == true ); lcStep ++ ) {
+
+            /* Assign descriptors to nearest centers */
+            lc_brute_match( lcData, lcCenter, lcMatch );
+
+            /* Reset accumulators */
+            lcSum.assign( ( size_t ) lcCount * lcData.cols, 0.0 ); lcSize.assign( lcCount, 0 );
+
+            /* Reset convergence flag */
+            lcMove = false;
+
+            /* Accumulate descriptors */
+            for ( int lcParse( 0 ); lcParse < lcData.rows; lcParse ++ ) {
+
+                /* Descriptor pointer variables */
+                float const * lcRow( lcData.ptr < float > ( lcParse ) );
+
+                /* Accumulator pointer variables */
+                double * lcAccum( lcSum.data() + ( size_t ) lcMatch[lcParse].trainIdx * lcData.cols );
+
+                /* Detect assignment change */
+                if ( lcPrevious[lcParse] != lcMatch[lcParse].trainIdx ) lcMove = true, lcPrevious[lcParse] = lcMatch[lcParse].trainIdx;
+
+                /* Accumulate components */
+                for ( int lcComp( 0 ); lcComp < lcData.cols; lcComp ++ ) lcAccum[lcComp] += lcRow[lcComp];
+
+                /* Update center size */
+                lcSize[lcMatch[lcParse].trainIdx] ++;
+
+            }
+
+            /* Update centers */
+            for ( int lcParse( 0 ); lcParse < lcCount; lcParse ++ ) {
+
+                /* Center pointer variables */
+                float * lcRow( lcCenter.ptr < float > ( lcParse ) );
+
+                /* Check center size */
+                if ( lcSize[lcParse] > 0 ) {
+
+                    /* Compute center components */
+                    for ( int lcComp( 0 ); lcComp < lcData.cols; lcComp ++ ) lcRow[lcComp] = lcSum[( size_t ) lcParse * lcData.cols + lcComp] / lcSize[lcParse];
+
+                } else {
+
+                    /* Farthest descriptor variables */
+                    int lcFar( 0 );
+
+                    /* Search farthest descriptor */
+                    for ( int lcFind( 1 ); lcFind < lcData.rows; lcFind ++ ) if ( lcMatch[lcFind].distance > lcMatch[lcFar].distance ) lcFar = lcFind;
+
+                    /* Move empty center on farthest descriptor */
+                    memcpy( lcRow, lcData.ptr < float > ( lcFar ), lcData.cols * sizeof( float ) );
+
+                    /* Invalidate farthest descriptor - not reused by other empty centers */
+                    lcMatch[lcFar].distance = 0.0;
+
+                    /* Force next iteration */
+                    lcMove = true;
+
+                }
+
+            }
+
+        }
+
+        /* Check labels array */
+        if ( lcLabel == NULL ) return;
+
+        /* Assign descriptors to final centers */
+        lc_brute_match( lcData, lcCenter, lcMatch );
+
+        /* Export labels */
+        for ( int lcParse( 0 ); lcParse < lcData.rows; lcParse ++ ) ( * lcLabel )[lcParse] = lcMatch[lcParse].trainIdx;
+
+    }
+
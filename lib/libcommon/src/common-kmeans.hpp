@@ -0,0 +1,113 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-kmeans.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Descriptors k-means clustering
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_KMEANS__
+    # define __LC_KMEANS__
+
+/* 
+    Header - Includes
+ */
+
+    # include <vector>
+    # include <cstring>
+    # include "common.hpp"
+    # include "common-brute.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define default amount of iterations */
+    # define LC_KMEANS_ITERATION    10
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Descriptors k-means clustering
+     *
+     *  This function computes the centers of the k-means clustering of the
+     *  provided floating point descriptors using the Lloyd iterations. The
+     *  centers are initialized on descriptors taken with a regular stride, so
+     *  that the clustering is deterministic. The assignment step relies on the
+     *  exact brute-force search of the common library. Centers left without
+     *  descriptors are moved on the descriptor that is the farthest of its
+     *  center.
+     *
+     *  If less descriptors than centers are provided, each descriptor becomes
+     *  a center.
+     *
+     *  \param  lcData      Descriptors matrix (CV_32F), one row per descriptor
+     *  \param  lcK         Amount of centers
+     *  \param  lcIteration Maximum amount of iterations
+     *  \param  lcCenter    Matrix receiving the centers, one row per center
+     *  \param  lcLabel     Array receiving the center of each descriptor, NULL
+     *                      if not required
+     */
+
+    void lc_kmeans ( cv::Mat const & lcData, int const lcK, int const lcIteration, cv::Mat & lcCenter, std::vector < int > * const lcLabel );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,371 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-lazy.hpp"
+
+/*
+    Source - Leading keypoints bound
+ */
+
+    static size_t lc_lazy_bound( std::vector < cv::KeyPoint > const & lcKey, int const lcLimit ) {
+
+        /* Return amount of considered keypoints */
+        return( ( lcLimit > 0 ) ? std::min( ( size_t ) lcLimit, lcKey.size() ) : lcKey.size() );
+
+    }
+
+/*
+    Source - Region inclusion
+ */
+
+    static bool lc_lazy_inside( cv::KeyPoint const & lcKey, cv::Rect const & lcRegion ) {
+
+        /* Check whole image region */
+        if ( lcRegion.area() <= 0 ) return( true );
+
+        /* Return keypoint inclusion */
+        return( ( lcKey.pt.x >= lcRegion.x ) && ( lcKey.pt.y >= lcRegion.y ) && ( lcKey.pt.x < lcRegion.x + lcRegion.width ) && ( lcKey.pt.y < lcRegion.y + lcRegion.height ) );
+
+    }
+
+/*
+    Source - Lazy descriptors creation
+ */
+
+    bool lc_lazy_create( cv::Mat const & lcImage, std::vector < cv::KeyPoint > const & lcKey, cv::DescriptorExtractor const & lcExtract, lc_Lazy_t * const lcLazy, cv::Mat & lcDesc ) {
+
+        /* Check image */
+        if ( lcImage.empty() == true ) return( false );
+
+        /* Assign image */
+        lcLazy->image = lcImage;
+
+        /* Reset keypoints states */
+        lcLazy->state.assign( lcKey.size(), LC_LAZY_PENDING );
+
+        /* Allocate descriptors matrix */
+        lcDesc = cv::Mat::zeros( lcKey.size(), lcExtract.descriptorSize(), lcExtract.descriptorType() );
+
+        /* Return results */
+        return( true );
+
+    }
+
+/*
+    Source - Keypoints neighbourhood
+ */
+
+    static cv::Rect lc_lazy_crop( lc_Lazy_t const * const lcLazy, std::vector < cv::KeyPoint > const & lcKey, std::vector < int > const & lcGroup ) {
+
+        /* Neighbourhood bounds variables */
+        float lcXmin( lcLazy->image.cols );
+        float lcYmin( lcLazy->image.rows );
+        float lcXmax( 0.0 );
+        float lcYmax( 0.0 );
+
+        /* Description margin variables */
+        float lcMargin( 0.0 );
+
+        /* Pyramid alignment variables - pixels of the deepest octave */
+        int lcAlign( 2 );
+
+        /* Parse keypoints */
+        for ( size_t lcParse( 0 ); lcParse < lcGroup.size(); lcParse ++ ) {
+
+            /* Update bounds */
+            lcXmin = std::min( lcXmin, lcKey[lcGroup[lcParse]].pt.x );
+            lcYmin = std::min( lcYmin, lcKey[lcGroup[lcParse]].pt.y );
+            lcXmax = std::max( lcXmax, lcKey[lcGroup[lcParse]].pt.x );
+            lcYmax = std::max( lcYmax, lcKey[lcGroup[lcParse]].pt.y );
+
+            /* Update margin - descriptor support */
+            lcMargin = std::max( lcMargin, ( float ) ( lcKey[lcGroup[lcParse]].size * LC_LAZY_MARGIN ) );
+
+            /* Update alignment - pyramid built by halving from the neighbourhood origin */
+            lcAlign = std::max( lcAlign, 2 << std::min( std::max( lc_bucket_octave( lcKey[lcGroup[lcParse]] ), 0 ), 16 ) );
+
+        }
+
+        /* Compute neighbourhood - aligned on the pyramid grid, clamped on image */
+        int lcX0( std::max( ( ( int ) floor( lcXmin - lcMargin ) / lcAlign ) * lcAlign, 0 ) );
+        int lcY0( std::max( ( ( int ) floor( lcYmin - lcMargin ) / lcAlign ) * lcAlign, 0 ) );
+        int lcX1( std::min( ( ( ( int ) ceil ( lcXmax + lcMargin ) + lcAlign ) / lcAlign ) * lcAlign, lcLazy->image.cols ) );
+        int lcY1( std::min( ( ( ( int ) ceil ( lcYmax + lcMargin ) + lcAlign ) / lcAlign ) * lcAlign, lcLazy->image.rows ) );
+
+        /* Check neighbourhood - keypoints outside of the image */
+        if ( ( lcX1 <= lcX0 ) || ( lcY1 <= lcY0 ) ) return( cv::Rect() );
+
+        /* Return neighbourhood */
+        return( cv::Rect( lcX0, lcY0, lcX1 - lcX0, lcY1 - lcY0 ) );
+
+    }
+
+/*
+    Source - Neighbourhood coverage
+ */
+
+    static bool lc_lazy_covered( lc_Lazy_t const * const lcLazy, cv::KeyPoint const & lcKey, cv::Rect const & lcCrop ) {
+
+        /* Description margin variables */
+        float lcMargin( lcKey.size * LC_LAZY_MARGIN );
+
+        /* Return descriptor support inclusion - image borders bound the support */
+        return( ( ( lcKey.pt.x - lcMargin >= lcCrop.x ) || ( lcCrop.x == 0 ) ) && ( ( lcKey.pt.x + lcMargin < lcCrop.x + lcCrop.width  ) || ( lcCrop.x + lcCrop.width  == lcLazy->image.cols ) ) &&
+                ( ( lcKey.pt.y - lcMargin >= lcCrop.y ) || ( lcCrop.y == 0 ) ) && ( ( lcKey.pt.y + lcMargin < lcCrop.y + lcCrop.height ) || ( lcCrop.y + lcCrop.height == lcLazy->image.rows ) ) );
+
+    }
+
+/*
+    Source - Neighbourhood description
+ */
+
+    static int lc_lazy_compute( lc_Lazy_t * const lcLazy, std::vector < cv::KeyPoint > & lcKey, cv::DescriptorExtractor const & lcExtract, cv::Rect const & lcRegion, std::vector < int > lcGroup, cv::Rect const & lcCrop, cv::Mat & lcDesc ) {
+
+        /* Neighbourhood keypoints variables */
+        std::vector < cv::KeyPoint > lcLocal;
+
+        /* Neighbourhood descriptors variables */
+        cv::Mat lcLocalDesc;
+
+        /* Row size variables */
+        size_t lcRow( lcDesc.cols * lcDesc.elemSize() );
+
+        /* Described keypoints variables */
+        int lcCount( 0 );
+
+        /* Check neighbourhood */
+        if ( lcCrop.area() <= 0 ) return( 0 );
+
+        /* Gather other pending keypoints of the region covered by the neighbourhood - their description comes at almost no cost */
+        for ( size_t lcParse( 0 ); lcParse < lcKey.size(); lcParse ++ ) {
+
+            /* Check keypoint state, inclusion and coverage */
+            if ( ( lcLazy->state[lcParse] != LC_LAZY_PENDING ) || ( lc_lazy_inside( lcKey[lcParse], lcRegion ) == false ) || ( lc_lazy_covered( lcLazy, lcKey[lcParse], lcCrop ) == false ) ) continue;
+
+            /* Flag keypoint as failed - described ones are flagged below */
+            lcLazy->state[lcParse] = LC_LAZY_FAILED;
+
+            /* Push keypoint */
+            lcGroup.push_back( lcParse );
+
+        }
+
+        /* Shift keypoints in neighbourhood */
+        for ( size_t lcParse( 0 ); lcParse < lcGroup.size(); lcParse ++ ) {
+
+            /* Push keypoint */
+            lcLocal.push_back( lcKey[lcGroup[lcParse]] );
+
+            /* Shift keypoint coordinates */
+            lcLocal.back().pt.x -= lcCrop.x;
+            lcLocal.back().pt.y -= lcCrop.y;
+
+        }
+
+        /* Describe neighbourhood keypoints - removed keypoints keep their order */
+        lcExtract.compute( cv::Mat( lcLazy->image, lcCrop ), lcLocal, lcLocalDesc );
+
+        /* Assign descriptors of kept keypoints */
+        for ( size_t lcParse( 0 ), lcKept( 0 ); ( lcParse < lcGroup.size() ) && ( lcKept < lcLocal.size() ); lcParse ++ ) {
+
+            /* Keypoint reference */
+            cv::KeyPoint & lcPoint( lcKey[lcGroup[lcParse]] );
+
+            /* Check kept keypoint */
+            if ( ( lcLocal[lcKept].pt.x != lcPoint.pt.x - lcCrop.x ) || ( lcLocal[lcKept].pt.y != lcPoint.pt.y - lcCrop.y ) ) continue;
+
+            /* Update keypoint - coordinates restored */
+            lcPoint = cv::KeyPoint( lcPoint.pt, lcLocal[lcKept].size, lcLocal[lcKept].angle, lcLocal[lcKept].response, lcLocal[lcKept].octave, lcLocal[lcKept].class_id );
+
+            /* Copy descriptor */
+            memcpy( lcDesc.ptr < unsigned char > ( lcGroup[lcParse] ), lcLocalDesc.ptr < unsigned char > ( lcKept ), lcRow );
+
+            /* Flag keypoint as described */
+            lcLazy->state[lcGroup[lcParse]] = LC_LAZY_DONE;
+
+            /* Update counters */
+            lcKept ++; lcCount ++;
+
+        }
+
+        /* Return described keypoints */
+        return( lcCount );
+
+    }
+
+/*
+    Source - Region description
+ */
+
+    int lc_lazy_describe( lc_Lazy_t * const lcLazy, std::vector < cv::KeyPoint > & lcKey, cv::DescriptorExtractor const & lcExtract, cv::Rect const & lcRegion, int const lcLimit, cv::Mat & lcDesc ) {
+
+        /* Pending keypoints variables - leading ones and all of them */
+        std::vector < int > lcPending;
+        std::vector < int > lcAll;
+
+        /* Pending keypoints of image cells */
+        std::map < int, std::vector < int > > lcCell;
+
+        /* Cells neighbourhoods area variables */
+        long lcSplit( 0 );
+
+        /* Described keypoints variables */
+        int lcCount( 0 );
+
+        /* Considered keypoints variables */
+        size_t lcBound( lc_lazy_bound( lcKey, lcLimit ) );
+
+        /* Gather pending keypoints of the region */
+        for ( size_t lcParse( 0 ); lcParse < lcKey.size(); lcParse ++ ) {
+
+            /* Check keypoint state and inclusion */
+            if ( ( lcLazy->state[lcParse] != LC_LAZY_PENDING ) || ( lc_lazy_inside( lcKey[lcParse], lcRegion ) == false ) ) continue;
+
+            /* Push pending keypoint */
+            lcAll.push_back( lcParse );
+
+            /* Check leading keypoint */
+            if ( lcParse >= lcBound ) continue;
+
+            /* Push leading pending keypoint */
+            lcPending.push_back( lcParse );
+
+            /* Push pending keypoint in its cell */
+            lcCell[( int ) ( lcKey[lcParse].pt.y / LC_LAZY_CELL ) * ( lcLazy->image.cols / LC_LAZY_CELL + 1 ) + ( int ) ( lcKey[lcParse].pt.x / LC_LAZY_CELL )].push_back( lcParse );
+
+        }
+
+        /* Check pending keypoints */
+        if ( lcPending.size() == 0 ) return( 0 );
+
+        /* Common neighbourhood of the leading pending keypoints */
+        cv::Rect lcCrop( lc_lazy_crop( lcLazy, lcKey, lcPending ) );
+
+        /* Common neighbourhood of all pending keypoints */
+        cv::Rect lcWhole( lc_lazy_crop( lcLazy, lcKey, lcAll ) );
+
+        /* Accumulate cells neighbourhoods area */
+        for ( std::map < int, std::vector < int > >::const_iterator lcParse( lcCell.begin() ); lcParse != lcCell.end(); lcParse ++ ) lcSplit += lc_lazy_crop( lcLazy, lcKey, lcParse->second ).area();
+
+        /* Flag pending keypoints as failed - described ones are flagged below */
+        for ( size_t lcParse( 0 ); lcParse < lcPending.size(); lcParse ++ ) lcLazy->state[lcPending[lcParse]] = LC_LAZY_FAILED;
+
+        /* Check cheapest description - expensive requests describe all pending keypoints at once */
+        if ( std::min( ( long ) lcCrop.area(), lcSplit ) >= LC_LAZY_SPREAD * lcWhole.area() ) {
+
+            /* Describe all pending keypoints on their common neighbourhood */
+            lcCount = lc_lazy_compute( lcLazy, lcKey, lcExtract, lcRegion, lcPending, lcWhole, lcDesc );
+
+        /* Scattered keypoints are described cell by cell */
+        } else if ( lcSplit < lcCrop.area() ) {
+
+            /* Describe cells keypoints on their neighbourhoods */
+            for ( std::map < int, std::vector < int > >::const_iterator lcParse( lcCell.begin() ); lcParse != lcCell.end(); lcParse ++ ) {
+
+                /* Describe cell keypoints */
+                lcCount += lc_lazy_compute( lcLazy, lcKey, lcExtract, lcRegion, lcParse->second, lc_lazy_crop( lcLazy, lcKey, lcParse->second ), lcDesc );
+
+            }
+
+        /* Describe keypoints on their common neighbourhood */
+        } else { lcCount = lc_lazy_compute( lcLazy, lcKey, lcExtract, lcRegion, lcPending, lcCrop, lcDesc ); }
+
+        /* Return described keypoints */
+        return( lcCount );
+
+    }
+
+/*
+    Source - Region keypoints selection
+ */
+
+    void lc_lazy_select( lc_Lazy_t const * const lcLazy, std::vector < cv::KeyPoint > const & lcKey, cv::Rect const & lcRegion, int const lcLimit, std::vector < int > & lcIndex ) {
+
+        /* Considered keypoints variables */
+        size_t lcBound( lc_lazy_bound( lcKey, lcLimit ) );
+
+        /* Reset indexes */
+        lcIndex.clear();
+
+        /* Parse keypoints */
+        for ( size_t lcParse( 0 ); lcParse < lcBound; lcParse ++ ) {
+
+            /* Check keypoint description */
+            if ( ( lcLazy->state.empty() == false ) && ( lcLazy->state[lcParse] != LC_LAZY_DONE ) ) continue;
+
+            /* Check keypoint inclusion */
+            if ( lc_lazy_inside( lcKey[lcParse], lcRegion ) == false ) continue;
+
+            /* Push keypoint index */
+            lcIndex.push_back( lcParse );
+
+        }
+
+    }
+
+/*
+    Source - Descriptors gathering
+ */
+
+    cv::Mat lc_lazy_gather( cv::Mat const & lcDesc, std::vector < int > const & lcIndex ) {
+
+        /* Gathered descriptors variables */
+        cv::Mat lcGather;
+
+        /* Row size variables */
+        size_t lcRow( lcDesc.cols * lcDesc.elemSize() );
+
+        /* Check descriptors */
+        if ( lcDesc.empty() == true ) return( lcGather );
+
+        /* Allocate gathered descriptors */
+        lcGather.create( lcIndex.size(), lcDesc.cols, lcDesc.type() );
+
+        /* Copy descriptors rows */
+        for ( size_t lcParse( 0 ); lcParse < lcIndex.size(); lcParse ++ ) memcpy( lcGather.ptr < unsigned char > ( lcParse ), lcDesc.ptr < unsigned char > ( lcIndex[lcParse] ), lcRow );
+
+        /* Return gathered descriptors */
+        return( lcGather );
+
+    }
+
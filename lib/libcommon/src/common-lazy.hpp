@@ -0,0 +1,199 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-lazy.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Lazy descriptors extraction
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_LAZY__
+    # define __LC_LAZY__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <map>
+    # include <vector>
+    # include <algorithm>
+    # include "common.hpp"
+    # include "common-bucket.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define keypoints states */
+    # define LC_LAZY_PENDING 0
+    # define LC_LAZY_DONE    1
+    # define LC_LAZY_FAILED  2
+
+    /* Define description margin - keypoints sizes */
+    # define LC_LAZY_MARGIN  6.0
+
+    /* Define description cells size - pixels */
+    # define LC_LAZY_CELL    128
+
+    /* Define description spread - neighbourhood ratio describing all keypoints */
+    # define LC_LAZY_SPREAD  0.5
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Lazy_struct
+     *  \brief Lazy descriptors structure
+     *
+     *  Structure that memorizes the description state of the keypoints of an
+     *  image, each keypoint being described at most once, when a region that
+     *  contains it is requested for the first time.
+     *
+     *  \var lc_Lazy_struct::image
+     *  Grayscale image
+     *  \var lc_Lazy_struct::state
+     *  Description state of each keypoint
+     */
+
+    typedef struct lc_Lazy_struct {
+
+        cv::Mat                       image;
+        std::vector < unsigned char > state;
+
+    } lc_Lazy_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Lazy descriptors creation
+     *
+     *  This function prepares the lazy description of the keypoints of the
+     *  provided image, none of them being described. The descriptors matrix is
+     *  allocated, with one zero row per keypoint, according to the provided
+     *  extractor.
+     *
+     *  \param  lcImage     Grayscale image
+     *  \param  lcKey       Keypoints array
+     *  \param  lcExtract   Descriptors extractor
+     *  \param  lcLazy      Lazy descriptors structure
+     *  \param  lcDesc      Matrix receiving the descriptors
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_lazy_create ( cv::Mat const & lcImage, std::vector < cv::KeyPoint > const & lcKey, cv::DescriptorExtractor const & lcExtract, lc_Lazy_t * const lcLazy, cv::Mat & lcDesc );
+
+    /*! \brief Region description
+     *
+     *  This function describes the keypoints of the provided region that are
+     *  not described yet. They are described together on the image
+     *  neighbourhood they cover, extended by a margin covering the descriptors
+     *  support, so that the cost of the description follows the requested area
+     *  instead of the image one. The neighbourhood is aligned on the pixels of
+     *  the deepest octave of its keypoints, so that the downsampled pyramid of
+     *  the extractor samples the same grid as on the whole image. Scattered keypoints are described cell by cell
+     *  when the neighbourhoods of the cells cover a smaller area than the
+     *  common one. Requests whose neighbourhood reaches half of the one of all
+     *  pending keypoints of the region describe all of them, and pending
+     *  keypoints covered by a described neighbourhood are described with it.
+     *  Keypoints are updated as by the extractor, and the ones for which it
+     *  provides no descriptor are flagged as failed and never requested again.
+     *  The request can be limited to the leading keypoints of the array, which
+     *  are the strongest ones of keyfiles sorted by response.
+     *
+     *  \param  lcLazy      Lazy descriptors structure
+     *  \param  lcKey       Keypoints array
+     *  \param  lcExtract   Descriptors extractor
+     *  \param  lcRegion    Image region, the whole image if empty
+     *  \param  lcLimit     Amount of leading keypoints, all if not positive
+     *  \param  lcDesc      Descriptors matrix
+     *
+     *  \return Returns the amount of newly described keypoints
+     */
+
+    int lc_lazy_describe ( lc_Lazy_t * const lcLazy, std::vector < cv::KeyPoint > & lcKey, cv::DescriptorExtractor const & lcExtract, cv::Rect const & lcRegion, int const lcLimit, cv::Mat & lcDesc );
+
+    /*! \brief Region keypoints selection
+     *
+     *  This function gives the indexes of the described keypoints lying in the
+     *  provided region, among the leading keypoints of the array. All keypoints
+     *  are considered as described when the structure is not used.
+     *
+     *  \param  lcLazy      Lazy descriptors structure
+     *  \param  lcKey       Keypoints array
+     *  \param  lcRegion    Image region, the whole image if empty
+     *  \param  lcLimit     Amount of leading keypoints, all if not positive
+     *  \param  lcIndex     Array receiving the keypoints indexes
+     */
+
+    void lc_lazy_select ( lc_Lazy_t const * const lcLazy, std::vector < cv::KeyPoint > const & lcKey, cv::Rect const & lcRegion, int const lcLimit, std::vector < int > & lcIndex );
+
+    /*! \brief Descriptors gathering
+     *
+     *  This function copies the provided rows of a descriptors matrix in a new
+     *  matrix. An empty matrix is left empty.
+     *
+     *  \param  lcDesc      Descriptors matrix
+     *  \param  lcIndex     Rows indexes
+     *
+     *  \return Returns the gathered descriptors matrix
+     */
+
+    cv::Mat lc_lazy_gather ( cv::Mat const & lcDesc, std::vector < int > const & lcIndex );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
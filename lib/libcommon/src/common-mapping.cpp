@@ -0,0 +1,120 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-mapping.hpp"
+
+/*
+    Source - File memory mapping
+ */
+
+    bool lc_map_open( char const * const lcPath, lc_Map_t * const lcMap ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Reset mapping structure */
+        lcMap->handle = -1;
+        lcMap->size   = 0;
+        lcMap->data   = NULL;
+
+        /* Open file descriptor */
+        if ( ( lcMap->handle = open( lcPath, O_RDONLY ) ) < 0 ) return( false );
+
+        /* Retrieve file size */
+        if ( ( fstat( lcMap->handle, & lcStat ) != 0 ) || ( lcStat.st_size <= 0 ) ) {
+
+            /* Release descriptor */
+            lc_map_close( lcMap );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Create memory mapping */
+        lcMap->data = ( char * ) mmap( NULL, lcStat.st_size, PROT_READ, MAP_SHARED, lcMap->handle, 0 );
+
+        /* Check memory mapping */
+        if ( lcMap->data == MAP_FAILED ) {
+
+            /* Reset mapping pointer */
+            lcMap->data = NULL;
+
+            /* Release descriptor */
+            lc_map_close( lcMap );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Assign mapping size */
+        lcMap->size = lcStat.st_size;
+
+        /* Advise sequential access */
+        madvise( lcMap->data, lcMap->size, MADV_SEQUENTIAL );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - File memory unmapping
+ */
+
+    void lc_map_close( lc_Map_t * const lcMap ) {
+
+        /* Release mapping */
+        if ( lcMap->data != NULL ) munmap( lcMap->data, lcMap->size );
+
+        /* Release descriptor */
+        if ( lcMap->handle >= 0 ) close( lcMap->handle );
+
+        /* Reset mapping structure */
+        lcMap->handle = -1;
+        lcMap->size   = 0;
+        lcMap->data   = NULL;
+
+    }
+
@@ -0,0 +1,134 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-mapping.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  File memory mapping interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_MAPPING__
+    # define __LC_MAPPING__
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.hpp"
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Map_struct
+     *  \brief Mapping structure
+     *
+     *  Structure that stores the description of a read-only memory mapping of
+     *  a file. The mapping is shared, so that concurrent processes mapping the
+     *  same file use the same pages of the system cache.
+     *
+     *  \var lc_Map_struct::handle
+     *  File descriptor of the mapped file
+     *  \var lc_Map_struct::size
+     *  Size, in bytes, of the mapped file
+     *  \var lc_Map_struct::data
+     *  Pointer to the first byte of the mapping
+     */
+
+    typedef struct lc_Map_struct {
+
+        int    handle;
+        size_t size;
+        char * data;
+
+    } lc_Map_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief File memory mapping
+     *
+     *  This function maps the entire content of the specified file in memory
+     *  in read-only mode. The kernel is advised of a sequential access. Empty
+     *  files are considered as a failure as no mapping can be created.
+     *
+     *  \param  lcPath  Path of the file to map
+     *  \param  lcMap   Mapping structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_map_open ( char const * const lcPath, lc_Map_t * const lcMap );
+
+    /*! \brief File memory unmapping
+     *
+     *  This function releases the mapping and closes the file descriptor. It
+     *  can be safely called on a structure for which the mapping failed.
+     *
+     *  \param  lcMap   Mapping structure to release
+     */
+
+    void lc_map_close ( lc_Map_t * const lcMap );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,751 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-matchfile.hpp"
+    # include "common-archive.hpp"
+
+/*
+    Source - Matchfile text line exportation
+ */
+
+    static void lc_matchfile_print( lc_Writer_t * const lcWriter, lc_Match_t const & lcMatch ) {
+
+        /* Export match index and coordinates */
+        lc_writer_integer( lcWriter, lcMatch.ai ); lc_writer_char( lcWriter, ' '  );
+        lc_writer_integer( lcWriter, lcMatch.bi ); lc_writer_char( lcWriter, ' '  );
+        lc_writer_float  ( lcWriter, lcMatch.ax ); lc_writer_char( lcWriter, ' '  );
+        lc_writer_float  ( lcWriter, lcMatch.ay ); lc_writer_char( lcWriter, ' '  );
+        lc_writer_float  ( lcWriter, lcMatch.bx ); lc_writer_char( lcWriter, ' '  );
+        lc_writer_float  ( lcWriter, lcMatch.by ); lc_writer_char( lcWriter, '\n' );
+
+    }
+
+/*
+    Source - Matchfile exportation
+ */
+
+    bool lc_matchfile_write( char const * const lcPath, std::vector < lc_Match_t > const & lcMatch, int const lcFormat, uint32_t const lcFlags ) {
+
+        /* Writer variables */
+        lc_Writer_t lcWriter;
+
+        /* Check archive format */
+        if ( lcFormat == LC_FORMAT_ARCHIVE ) {
+
+            /* Archive writer variables */
+            lc_Matchwriter_t lcArchive;
+
+            /* Create archive */
+            if ( lc_matchwriter_archive( lcPath, & lcArchive, LC_ARCHIVE_STEP ) == false ) return( false );
+
+            /* Assign archive flags */
+            lcArchive.flags = lcFlags;
+
+            /* Export matches */
+            lc_matchwriter_chunk( & lcArchive, lcMatch );
+
+            /* Close archive and return state */
+            return( lc_matchwriter_close( & lcArchive ) );
+
+        }
+
+        /* Create output file */
+        if ( lc_writer_open( lcPath, & lcWriter ) == false ) return( false );
+
+        /* Check requested format */
+        if ( lcFormat == LC_FORMAT_BINARY ) {
+
+            /* Binary header variables */
+            lc_Header_t lcHeader( lc_format_header( LC_MATCHFILE_MAGIC, LC_MATCHFILE_LAYOUT, 1, lcMatch.size() ) );
+
+            /* Assign header flags */
+            lcHeader.flags = lcFlags;
+
+            /* Export header and records */
+            lc_writer_raw( & lcWriter, & lcHeader, sizeof( lc_Header_t ) );
+            lc_writer_raw( & lcWriter, lcMatch.data(), lcMatch.size() * sizeof( lc_Match_t ) );
+
+        } else {
+
+            /* Export matches count */
+            lc_writer_integer( & lcWriter, lcMatch.size() );
+
+            /* Export truncation mark */
+            if ( ( lcFlags & LC_MATCHFILE_TRUNCATED ) != 0 ) lc_writer_raw( & lcWriter, " " LC_MATCHFILE_MARK, strlen( " " LC_MATCHFILE_MARK ) );
+
+            /* Terminate count line */
+            lc_writer_char( & lcWriter, '\n' );
+
+            /* Export matches */
+            for ( size_t lcIndex( 0 ); lcIndex < lcMatch.size(); lcIndex ++ ) lc_matchfile_print( & lcWriter, lcMatch[lcIndex] );
+
+        }
+
+        /* Close output file and return state */
+        return( lc_writer_close( & lcWriter ) );
+
+    }
+
+/*
+    Source - Matchfile text line parser
+ */
+
+    static bool lc_matchfile_line( char const * lcLine, char const * const lcStop, void * const lcRecord ) {
+
+        /* Match pointer variables */
+        lc_Match_t * lcMatch( ( lc_Match_t * ) lcRecord );
+
+        /* Index parsing variables */
+        long lcIndexA( 0 ), lcIndexB( 0 );
+
+        /* Parse match index and coordinates */
+        if ( ( lcLine = lc_parse_integer( lcLine, lcStop, & lcIndexA    ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_integer( lcLine, lcStop, & lcIndexB    ) ) == NULL ) return( false );
+
+        /* Check match index range */
+        if ( ( lcIndexA < INT32_MIN ) || ( lcIndexA > INT32_MAX ) || ( lcIndexB < INT32_MIN ) || ( lcIndexB > INT32_MAX ) ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcMatch->ax ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcMatch->ay ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcMatch->bx ) ) == NULL ) return( false );
+        if ( ( lcLine = lc_parse_float  ( lcLine, lcStop, & lcMatch->by ) ) == NULL ) return( false );
+
+        /* Assign match index */
+        lcMatch->ai = lcIndexA;
+        lcMatch->bi = lcIndexB;
+
+        /* Return parsing status */
+        return( true );
+
+    }
+
+/*
+    Source - Matchfile importation
+ */
+
+    bool lc_matchfile_read( char const * const lcPath, std::vector < lc_Match_t > & lcMatch, uint32_t * const lcFlags ) {
+
+        /* Mapping variables */
+        lc_Map_t lcMap;
+
+        /* Returned value variables */
+        bool lcReturn( false );
+
+        /* Reset matches array and flags */
+        lcMatch.clear(); if ( lcFlags != NULL ) * lcFlags = 0;
+
+        /* Map matchfile */
+        if ( lc_map_open( lcPath, & lcMap ) == false ) return( false );
+
+        /* Detect matchfile format */
+        if ( lc_format_detect( & lcMap, LC_MATCHFILE_MAGIC ) == true ) {
+
+            /* Verify binary header */
+            lc_Header_t const * lcHeader( lc_format_check( & lcMap, LC_MATCHFILE_MAGIC, LC_MATCHFILE_LAYOUT ) );
+
+            /* Check binary header */
+            if ( lcHeader != NULL ) {
+
+                /* Records pointer variables */
+                lc_Match_t const * lcRecord( ( lc_Match_t const * ) LC_FORMAT_DATA( lcMap ) );
+
+                /* Copy records */
+                lcMatch.assign( lcRecord, lcRecord + lcHeader->count );
+
+                /* Assign matchfile flags */
+                if ( lcFlags != NULL ) * lcFlags = lcHeader->flags;
+
+                /* Update returned value */
+                lcReturn = true;
+
+            }
+
+        } else if ( lc_format_detect( & lcMap, LC_ARCHIVE_MAGIC ) == true ) {
+
+            /* Verify archive header */
+            lc_Header_t const * lcHeader( lc_archive_check( & lcMap ) );
+
+            /* Check archive header */
+            if ( lcHeader != NULL ) {
+
+                /* Archive description variables */
+                lc_Archive_t const * lcArchive( ( lc_Archive_t const * ) ( lcMap.data + sizeof( lc_Header_t ) ) );
+
+                /* Block position variables */
+                char const * lcBlock( LC_ARCHIVE_DATA( lcMap ) );
+
+                /* Block matches variables */
+                std::vector < lc_Match_t > lcChunk;
+
+                /* Decode archive blocks */
+                while ( ( lcBlock != NULL ) && ( lcMatch.size() < lcHeader->count ) ) {
+
+                    /* Decode block and append its matches */
+                    if ( ( lcBlock = lc_archive_unpack( lcBlock, lcMap.data + lcMap.size, lcArchive->step, lcHeader->count - lcMatch.size(), lcChunk ) ) != NULL ) lcMatch.insert( lcMatch.end(), lcChunk.begin(), lcChunk.end() );
+
+                }
+
+                /* Update returned value */
+                if ( ( lcReturn = ( lcMatch.size() == lcHeader->count ) ) == false ) lcMatch.clear();
+
+                /* Assign archive flags */
+                if ( ( lcReturn == true ) && ( lcFlags != NULL ) ) * lcFlags = lcHeader->flags;
+
+            }
+
+        } else {
+
+            /* Records position variables */
+            char const * lcBody( NULL );
+
+            /* Parse matches count */
+            long lcCount( lc_parse_count( & lcMap, & lcBody ) );
+
+            /* Check matches count */
+            if ( lcCount >= 0 ) {
+
+                /* Parsed records variables */
+                size_t lcFound( 0 );
+
+                /* Allocate matches array */
+                lcMatch.resize( lcCount );
+
+                /* Parse matches in parallel */
+                if ( ( lcReturn = ( lc_parse_records( lcBody, lcMap.data + lcMap.size, lcCount, lcMatch.data(), sizeof( lc_Match_t ), & lc_matchfile_line, & lcFound ) && ( lcFound == ( size_t ) lcCount ) ) ) == false ) lcMatch.clear();
+
+                /* Assign count line flags */
+                if ( ( lcReturn == true ) && ( lcFlags != NULL ) ) * lcFlags = lc_matchfile_mark( lcMap.data, lcMap.data + lcMap.size );
+
+            }
+
+        }
+
+        /* Release mapping */
+        lc_map_close( & lcMap );
+
+        /* Return reading status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Text matchfile flags detection
+ */
+
+    uint32_t lc_matchfile_mark( char const * const lcStart, char const * const lcStop ) {
+
+        /* Mark size variables */
+        size_t lcSize( strlen( LC_MATCHFILE_MARK ) );
+
+        /* Count line end variables */
+        char const * lcEnd( ( char const * ) memchr( lcStart, '\n', lcStop - lcStart ) );
+
+        /* Token position variables */
+        char const * lcToken( NULL );
+
+        /* Count variables */
+        long lcCount( 0 );
+
+        /* Compute count line end */
+        if ( lcEnd == NULL ) lcEnd = lcStop;
+
+        /* Skip count */
+        if ( ( lcToken = lc_parse_integer( lcStart, lcEnd, & lcCount ) ) == NULL ) return( 0 );
+
+        /* Skip blanks */
+        while ( ( lcToken < lcEnd ) && ( ( * lcToken == ' ' ) || ( * lcToken == '\t' ) ) ) lcToken ++;
+
+        /* Compare mark */
+        if ( ( ( size_t ) ( lcEnd - lcToken ) < lcSize ) || ( memcmp( lcToken, LC_MATCHFILE_MARK, lcSize ) != 0 ) ) return( 0 );
+
+        /* Check mark termination - only blanks can follow */
+        for ( lcToken += lcSize; lcToken < lcEnd; lcToken ++ ) if ( ( * lcToken != ' ' ) && ( * lcToken != '\t' ) && ( * lcToken != '\r' ) ) return( 0 );
+
+        /* Return truncation flag */
+        return( LC_MATCHFILE_TRUNCATED );
+
+    }
+
+/*
+    Source - Text matchfile count line composition
+ */
+
+    size_t lc_matchfile_count( char * const lcLine, size_t const lcSize, uint64_t const lcCount, uint32_t const lcFlags, int const lcWidth ) {
+
+        /* Count and mark variables */
+        char lcToken[LC_FORMAT_COUNT + 16] = { 0 };
+
+        /* Compose count and mark */
+        snprintf( lcToken, sizeof( lcToken ), "%llu%s", ( unsigned long long ) lcCount, ( ( lcFlags & LC_MATCHFILE_TRUNCATED ) != 0 ) ? " " LC_MATCHFILE_MARK : "" );
+
+        /* Compose padded count line and return its length */
+        return( snprintf( lcLine, lcSize, "%-*s", lcWidth, lcToken ) );
+
+    }
+
+/*
+    Source - Matchfile reader creation
+ */
+
+    bool lc_matchreader_open( char const * const lcPath, lc_Matchreader_t * const lcReader ) {
+
+        /* Records count variables */
+        long lcCount( -1 );
+
+        /* Reset reader structure */
+        lcReader->format = LC_FORMAT_TEXT;
+        lcReader->flags  = 0;
+        lcReader->count  = 0;
+        lcReader->index  = 0;
+        lcReader->body   = NULL;
+        lcReader->next   = NULL;
+
+        /* Reset archive block */
+        lcReader->step   = 0.0;
+        lcReader->offset = 0;
+        lcReader->block.clear();
+
+        /* Map matchfile */
+        if ( lc_map_open( lcPath, & lcReader->map ) == false ) return( false );
+
+        /* Detect matchfile format */
+        if ( lc_format_detect( & lcReader->map, LC_MATCHFILE_MAGIC ) == true ) {
+
+            /* Verify binary header */
+            lc_Header_t const * lcHeader( lc_format_check( & lcReader->map, LC_MATCHFILE_MAGIC, LC_MATCHFILE_LAYOUT ) );
+
+            /* Check binary header */
+            if ( lcHeader != NULL ) {
+
+                /* Assign binary format and flags */
+                lcReader->format = LC_FORMAT_BINARY;
+                lcReader->flags  = lcHeader->flags;
+
+                /* Assign records position */
+                lcReader->body = LC_FORMAT_DATA( lcReader->map );
+
+                /* Assign records count */
+                lcCount = lcHeader->count;
+
+            }
+
+        } else if ( lc_format_detect( & lcReader->map, LC_ARCHIVE_MAGIC ) == true ) {
+
+            /* Verify archive header */
+            lc_Header_t const * lcHeader( lc_archive_check( & lcReader->map ) );
+
+            /* Check archive header */
+            if ( lcHeader != NULL ) {
+
+                /* Assign archive format and flags */
+                lcReader->format = LC_FORMAT_ARCHIVE;
+                lcReader->flags  = lcHeader->flags;
+
+                /* Assign quantization step */
+                lcReader->step = ( ( lc_Archive_t const * ) ( lcReader->map.data + sizeof( lc_Header_t ) ) )->step;
+
+                /* Assign blocks position */
+                lcReader->body = LC_ARCHIVE_DATA( lcReader->map );
+
+                /* Assign records count */
+                lcCount = lcHeader->count;
+
+            }
+
+        } else {
+
+            /* Parse matches count */
+            lcCount = lc_parse_count( & lcReader->map, & lcReader->body );
+
+            /* Assign count line flags */
+            if ( lcCount >= 0 ) lcReader->flags = lc_matchfile_mark( lcReader->map.data, lcReader->map.data + lcReader->map.size );
+
+        }
+
+        /* Check matches count */
+        if ( lcCount < 0 ) {
+
+            /* Release mapping */
+            lc_map_close( & lcReader->map );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Assign matches count */
+        lcReader->count = lcCount;
+
+        /* Assign reading position */
+        lcReader->next = lcReader->body;
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Matchfile reader chunk
+ */
+
+    bool lc_matchreader_chunk( lc_Matchreader_t * const lcReader, std::vector < lc_Match_t > & lcChunk, size_t const lcSize ) {
+
+        /* Chunk size variables */
+        size_t lcCount( std::min( lcSize, lcReader->count - lcReader->index ) );
+
+        /* Allocate chunk */
+        lcChunk.resize( lcCount );
+
+        /* Check chunk size */
+        if ( lcCount == 0 ) return( true );
+
+        /* Check matchfile format */
+        if ( lcReader->format == LC_FORMAT_DATABASE ) {
+
+            /* Copy matches of the database pair */
+            memcpy( lcChunk.data(), lcReader->block.data() + lcReader->index, lcCount * sizeof( lc_Match_t ) );
+
+        } else if ( lcReader->format == LC_FORMAT_BINARY ) {
+
+            /* Copy records */
+            memcpy( lcChunk.data(), lcReader->next, lcCount * sizeof( lc_Match_t ) );
+
+            /* Update reading position */
+            lcReader->next += lcCount * sizeof( lc_Match_t );
+
+        } else if ( lcReader->format == LC_FORMAT_ARCHIVE ) {
+
+            /* Chunk filling variables */
+            size_t lcFill( 0 );
+
+            /* Fill chunk from archive blocks */
+            while ( lcFill < lcCount ) {
+
+                /* Copy size variables */
+                size_t lcCopy( 0 );
+
+                /* Check block consumption */
+                if ( lcReader->offset == lcReader->block.size() ) {
+
+                    /* Decode next block */
+                    if ( ( lcReader->next == NULL ) || ( ( lcReader->next = lc_archive_unpack( lcReader->next, lcReader->map.data + lcReader->map.size, lcReader->step, lcReader->count - lcReader->index - lcFill, lcReader->block ) ) == NULL ) || ( lcReader->block.empty() == true ) ) {
+
+                        /* Reset chunk */
+                        lcChunk.clear();
+
+                        /* Send message */
+                        return( false );
+
+                    }
+
+                    /* Reset block offset */
+                    lcReader->offset = 0;
+
+                }
+
+                /* Compute copy size */
+                lcCopy = std::min( lcCount - lcFill, lcReader->block.size() - lcReader->offset );
+
+                /* Copy block matches */
+                memcpy( lcChunk.data() + lcFill, lcReader->block.data() + lcReader->offset, lcCopy * sizeof( lc_Match_t ) );
+
+                /* Update offset and filling */
+                lcReader->offset += lcCopy;
+                lcFill           += lcCopy;
+
+            }
+
+        } else {
+
+            /* Lines count variables */
+            size_t lcFound( 0 );
+
+            /* Search chunk end */
+            char const * lcStop( lc_parse_skip( lcReader->next, lcReader->map.data + lcReader->map.size, lcCount, & lcFound ) );
+
+            /* Parse chunk in parallel */
+            if ( ( lcFound != lcCount ) || ( lc_parse_records( lcReader->next, lcStop, lcCount, lcChunk.data(), sizeof( lc_Match_t ), & lc_matchfile_line, & lcFound ) == false ) ) {
+
+                /* Reset chunk */
+                lcChunk.clear();
+
+                /* Send message */
+                return( false );
+
+            }
+
+            /* Update reading position */
+            lcReader->next = lcStop;
+
+        }
+
+        /* Update reading index */
+        lcReader->index += lcCount;
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Matchfile reader rewind
+ */
+
+    void lc_matchreader_rewind( lc_Matchreader_t * const lcReader ) {
+
+        /* Reset reading position and index */
+        lcReader->next  = lcReader->body;
+        lcReader->index = 0;
+
+        /* Reset archive block - database pairs are kept in memory */
+        lcReader->offset = 0;
+        if ( lcReader->format != LC_FORMAT_DATABASE ) lcReader->block.clear();
+
+    }
+
+/*
+    Source - Matchfile reader closure
+ */
+
+    void lc_matchreader_close( lc_Matchreader_t * const lcReader ) {
+
+        /* Release mapping */
+        lc_map_close( & lcReader->map );
+
+        /* Reset reader structure */
+        lcReader->count = 0;
+        lcReader->index = 0;
+        lcReader->body  = NULL;
+        lcReader->next  = NULL;
+
+        /* Release archive block */
+        lcReader->offset = 0;
+        lcReader->block.clear();
+
+    }
+
+/*
+    Source - Matchfile writer creation
+ */
+
+    bool lc_matchwriter_open( char const * const lcPath, lc_Matchwriter_t * const lcWriter, int const lcFormat ) {
+
+        /* Reset writer structure */
+        lcWriter->format = lcFormat;
+        lcWriter->flags  = 0;
+        lcWriter->count  = 0;
+        lcWriter->step   = 0.0;
+
+        /* Reset pending archive block */
+        lcWriter->block.clear();
+
+        /* Create matchfile */
+        if ( lc_writer_open( lcPath, & lcWriter->writer ) == false ) return( false );
+
+        /* Check matchfile format */
+        if ( lcFormat == LC_FORMAT_BINARY ) {
+
+            /* Binary header variables */
+            lc_Header_t lcHeader( lc_format_header( LC_MATCHFILE_MAGIC, LC_MATCHFILE_LAYOUT, 1, 0 ) );
+
+            /* Export placeholder header */
+            lc_writer_raw( & lcWriter->writer, & lcHeader, sizeof( lc_Header_t ) );
+
+        } else {
+
+            /* Export placeholder count line */
+            for ( int lcIndex( 0 ); lcIndex < LC_FORMAT_COUNT; lcIndex ++ ) lc_writer_char( & lcWriter->writer, ' ' );
+
+            /* Export count line end */
+            lc_writer_char( & lcWriter->writer, '\n' );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Matchfile archive writer creation
+ */
+
+    bool lc_matchwriter_archive( char const * const lcPath, lc_Matchwriter_t * const lcWriter, float const lcStep ) {
+
+        /* Archive description variables */
+        lc_Archive_t lcArchive = { lcStep, LC_ARCHIVE_BLOCK, { 0 } };
+
+        /* Placeholder header variables */
+        lc_Header_t lcHeader( lc_format_header( LC_ARCHIVE_MAGIC, LC_ARCHIVE_LAYOUT, 1, 0 ) );
+
+        /* Check quantization step */
+        if ( ( lcStep > 0.0 ) == false ) return( false );
+
+        /* Reset writer structure */
+        lcWriter->format = LC_FORMAT_ARCHIVE;
+        lcWriter->flags  = 0;
+        lcWriter->count  = 0;
+        lcWriter->step   = lcStep;
+
+        /* Reset pending archive block */
+        lcWriter->block.clear();
+
+        /* Create archive */
+        if ( lc_writer_open( lcPath, & lcWriter->writer ) == false ) return( false );
+
+        /* Export placeholder header and archive description */
+        lc_writer_raw( & lcWriter->writer, & lcHeader , sizeof( lc_Header_t  ) );
+        lc_writer_raw( & lcWriter->writer, & lcArchive, sizeof( lc_Archive_t ) );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Matchfile writer chunk
+ */
+
+    void lc_matchwriter_chunk( lc_Matchwriter_t * const lcWriter, std::vector < lc_Match_t > const & lcChunk ) {
+
+        /* Check matchfile format */
+        if ( lcWriter->format == LC_FORMAT_DATABASE ) {
+
+            /* Append matches to the database pair */
+            lcWriter->block.insert( lcWriter->block.end(), lcChunk.begin(), lcChunk.end() );
+
+        } else if ( lcWriter->format == LC_FORMAT_BINARY ) {
+
+            /* Export records */
+            lc_writer_raw( & lcWriter->writer, lcChunk.data(), lcChunk.size() * sizeof( lc_Match_t ) );
+
+        } else if ( lcWriter->format == LC_FORMAT_ARCHIVE ) {
+
+            /* Append matches to pending block */
+            lcWriter->block.insert( lcWriter->block.end(), lcChunk.begin(), lcChunk.end() );
+
+            /* Export complete blocks */
+            while ( lcWriter->block.size() >= LC_ARCHIVE_BLOCK ) {
+
+                /* Export block */
+                if ( lc_archive_pack( & lcWriter->writer, lcWriter->block.data(), LC_ARCHIVE_BLOCK, lcWriter->step ) == false ) lcWriter->writer.valid = false;
+
+                /* Remove exported matches */
+                lcWriter->block.erase( lcWriter->block.begin(), lcWriter->block.begin() + LC_ARCHIVE_BLOCK );
+
+            }
+
+        } else {
+
+            /* Export matches */
+            for ( size_t lcIndex( 0 ); lcIndex < lcChunk.size(); lcIndex ++ ) lc_matchfile_print( & lcWriter->writer, lcChunk[lcIndex] );
+
+        }
+
+        /* Update matches count */
+        lcWriter->count += lcChunk.size();
+
+    }
+
+/*
+    Source - Matchfile writer closure
+ */
+
+    bool lc_matchwriter_close( lc_Matchwriter_t * const lcWriter ) {
+
+        /* Check matchfile format */
+        if ( lcWriter->format == LC_FORMAT_DATABASE ) {
+
+            /* Send message - matches are kept for the database insertion */
+            return( true );
+
+        } else if ( lcWriter->format == LC_FORMAT_BINARY ) {
+
+            /* Binary header variables */
+            lc_Header_t lcHeader( lc_format_header( LC_MATCHFILE_MAGIC, LC_MATCHFILE_LAYOUT, 1, lcWriter->count ) );
+
+            /* Assign header flags */
+            lcHeader.flags = lcWriter->flags;
+
+            /* Update header */
+            lc_writer_patch( & lcWriter->writer, 0, & lcHeader, sizeof( lc_Header_t ) );
+
+        } else if ( lcWriter->format == LC_FORMAT_ARCHIVE ) {
+
+            /* Archive header variables */
+            lc_Header_t lcHeader( lc_format_header( LC_ARCHIVE_MAGIC, LC_ARCHIVE_LAYOUT, 1, lcWriter->count ) );
+
+            /* Export last block */
+            if ( lcWriter->block.empty() == false ) {
+
+                /* Export block */
+                if ( lc_archive_pack( & lcWriter->writer, lcWriter->block.data(), lcWriter->block.size(), lcWriter->step ) == false ) lcWriter->writer.valid = false;
+
+                /* Release pending block */
+                lcWriter->block.clear();
+
+            }
+
+            /* Assign header flags */
+            lcHeader.flags = lcWriter->flags;
+
+            /* Update header */
+            lc_writer_patch( & lcWriter->writer, 0, & lcHeader, sizeof( lc_Header_t ) );
+
+        } else {
+
+            /* Count line variables */
+            char lcCount[LC_FORMAT_COUNT + 1] = { 0 };
+
+            /* Compose padded count and mark - the placeholder width cannot be exceeded */
+            if ( lc_matchfile_count( lcCount, sizeof( lcCount ), lcWriter->count, lcWriter->flags, LC_FORMAT_COUNT ) > LC_FORMAT_COUNT ) lcWriter->writer.valid = false;
+
+            /* Update count line */
+            lc_writer_patch( & lcWriter->writer, 0, lcCount, LC_FORMAT_COUNT );
+
+        }
+
+        /* Close matchfile and return state */
+        return( lc_writer_close( & lcWriter->writer ) );
+
+    }
+
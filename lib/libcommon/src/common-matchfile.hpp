@@ -0,0 +1,384 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-matchfile.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Matches file interface
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_MATCHFILE__
+    # define __LC_MATCHFILE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <fstream>
+    # include <algorithm>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-parser.hpp"
+    # include "common-writer.hpp"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define binary matchfile format */
+    # define LC_MATCHFILE_MAGIC     "FSMATBIN"
+    # define LC_MATCHFILE_LAYOUT    "iffiff"
+
+    /* Define matchfile flags - matching stopped before completion */
+    # define LC_MATCHFILE_TRUNCATED 1
+
+    /* Define text matchfile truncation mark - follows the count */
+    # define LC_MATCHFILE_MARK      "truncated"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Match_struct
+     *  \brief Match structure
+     *  
+     *  Structure that stores the description of a match between two keypoints.
+     *  The structure is also the record of binary matchfiles.
+     *  
+     *  \var lc_Match_struct::ai
+     *  Index of the first keypoint in the keypoints list
+     *  \var lc_Match_struct::ax
+     *  Position x of the keypoint on the first image
+     *  \var lc_Match_struct::ay 
+     *  Position y of the keypoint on the first image
+     *  \var lc_Match_struct::bi 
+     *  Index of the second keypoint in the keypoints list
+     *  \var lc_Match_struct::bx
+     *  Position x of the keypoint on the second image
+     *  \var lc_Match_struct::by 
+     *  Position y of the keypoint on the second image
+     */
+
+    typedef struct lc_Match_struct {
+
+        int32_t ai;
+        float   ax;
+        float   ay;
+        int32_t bi;
+        float   bx;
+        float   by;
+
+    } lc_Match_t;
+
+    /*! \struct lc_Matchreader_struct
+     *  \brief Matchfile reader structure
+     *
+     *  Structure that stores the state of a matchfile read by chunks. The file
+     *  is mapped in memory and only the current chunk of matches is stored in
+     *  memory by the caller.
+     *
+     *  \var lc_Matchreader_struct::map
+     *  Mapping of the matchfile
+     *  \var lc_Matchreader_struct::format
+     *  Format of the matchfile
+     *  \var lc_Matchreader_struct::flags
+     *  Flags of the matchfile (LC_MATCHFILE_TRUNCATED)
+     *  \var lc_Matchreader_struct::count
+     *  Amount of matches stored in the matchfile
+     *  \var lc_Matchreader_struct::index
+     *  Amount of matches already read
+     *  \var lc_Matchreader_struct::body
+     *  Position of the first match
+     *  \var lc_Matchreader_struct::next
+     *  Position of the next match, or archive block, to read
+     *  \var lc_Matchreader_struct::step
+     *  Quantization step of archives
+     *  \var lc_Matchreader_struct::offset
+     *  Amount of matches of the decoded archive block already read
+     *  \var lc_Matchreader_struct::block
+     *  Matches of the decoded archive block, or of the database pair
+     */
+
+    typedef struct lc_Matchreader_struct {
+
+        lc_Map_t     map;
+        int          format;
+        uint32_t     flags;
+        size_t       count;
+        size_t       index;
+        char const * body;
+        char const * next;
+        float        step;
+        size_t       offset;
+
+        std::vector < lc_Match_t > block;
+
+    } lc_Matchreader_t;
+
+    /*! \struct lc_Matchwriter_struct
+     *  \brief Matchfile writer structure
+     *
+     *  Structure that stores the state of a matchfile written by chunks. As
+     *  the matches count is only known at the end, a placeholder is written
+     *  and updated on closure. In text format, the count line is padded with
+     *  spaces to a fixed width for this purpose. The flags are stored on
+     *  closure, in the header or in the count line.
+     *
+     *  \var lc_Matchwriter_struct::writer
+     *  Buffered writer of the matchfile
+     *  \var lc_Matchwriter_struct::format
+     *  Format of the matchfile
+     *  \var lc_Matchwriter_struct::flags
+     *  Flags of the matchfile (LC_MATCHFILE_TRUNCATED)
+     *  \var lc_Matchwriter_struct::count
+     *  Amount of matches already written
+     *  \var lc_Matchwriter_struct::step
+     *  Quantization step of archives
+     *  \var lc_Matchwriter_struct::block
+     *  Matches waiting for the completion of an archive block, or for the
+     *  insertion of the database pair
+     */
+
+    typedef struct lc_Matchwriter_struct {
+
+        lc_Writer_t writer;
+        int         format;
+        uint32_t    flags;
+        size_t      count;
+        float       step;
+
+        std::vector < lc_Match_t > block;
+
+    } lc_Matchwriter_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Matchfile exportation
+     *
+     *  This function exports the provided matches in the specified file using
+     *  the text or binary format. The text format stores the matches count on
+     *  the first line followed by one match per line as "ai bi ax ay bx by".
+     *  The binary format stores a header followed by packed match records.
+     *  The archive format stores compressed blocks of quantized matches using
+     *  the default quantization step.
+     *
+     *  The flags are stored in the header of binary files and archives. In
+     *  the text format, the LC_MATCHFILE_TRUNCATED flag is stored as the
+     *  LC_MATCHFILE_MARK word following the count on the first line. As the
+     *  count parser stops after the count, readers ignore the mark.
+     *
+     *  \param  lcPath      Path of the matchfile
+     *  \param  lcMatch     Matches to export
+     *  \param  lcFormat    Matchfile format (LC_FORMAT_TEXT, LC_FORMAT_BINARY or
+     *                      LC_FORMAT_ARCHIVE)
+     *  \param  lcFlags     Matchfile flags (LC_MATCHFILE_TRUNCATED)
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchfile_write ( char const * const lcPath, std::vector < lc_Match_t > const & lcMatch, int const lcFormat, uint32_t const lcFlags );
+
+    /*! \brief Matchfile importation
+     *
+     *  This function imports the matches stored in the specified file. The
+     *  format of the file is automatically detected. Binary matchfiles are
+     *  mapped in memory and their records are copied without parsing. Matches
+     *  archives are decoded block by block.
+     *
+     *  \param  lcPath      Path of the matchfile
+     *  \param  lcMatch     Array receiving the imported matches
+     *  \param  lcFlags     Pointer receiving the matchfile flags, or NULL
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchfile_read ( char const * const lcPath, std::vector < lc_Match_t > & lcMatch, uint32_t * const lcFlags );
+
+    /*! \brief Text matchfile flags detection
+     *
+     *  This function searches the truncation mark on the count line of a text
+     *  matchfile. The count line is the first line of the provided text.
+     *
+     *  \param  lcStart     Text start position
+     *  \param  lcStop      Text stop position (excluded)
+     *
+     *  \return Returns the flags stored on the count line
+     */
+
+    uint32_t lc_matchfile_mark ( char const * const lcStart, char const * const lcStop );
+
+    /*! \brief Text matchfile count line composition
+     *
+     *  This function composes the count line of a text matchfile, without its
+     *  line end. The count is followed by the truncation mark if requested by
+     *  the flags, and the line is padded with spaces to the provided width.
+     *
+     *  \param  lcLine      Buffer receiving the count line
+     *  \param  lcSize      Size of the buffer, in bytes
+     *  \param  lcCount     Matches count
+     *  \param  lcFlags     Matchfile flags (LC_MATCHFILE_TRUNCATED)
+     *  \param  lcWidth     Padded width of the count line
+     *
+     *  \return Returns the length of the complete count line, which exceeds
+     *  the buffer size minus one if the line is truncated
+     */
+
+    size_t lc_matchfile_count ( char * const lcLine, size_t const lcSize, uint64_t const lcCount, uint32_t const lcFlags, int const lcWidth );
+
+    /*! \brief Matchfile reader creation
+     *
+     *  This function maps the specified matchfile, detects its format and
+     *  reads its matches count and flags. The matches are then obtained by
+     *  chunks using the \b lc_matchreader_chunk function.
+     *
+     *  \param  lcPath      Path of the matchfile
+     *  \param  lcReader    Reader structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchreader_open ( char const * const lcPath, lc_Matchreader_t * const lcReader );
+
+    /*! \brief Matchfile reader chunk
+     *
+     *  This function reads the next chunk of matches. The chunk array is
+     *  resized to the amount of read matches, which is zero once the whole
+     *  file is read.
+     *
+     *  \param  lcReader    Reader structure
+     *  \param  lcChunk     Array receiving the chunk of matches
+     *  \param  lcSize      Maximum amount of matches of the chunk
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchreader_chunk ( lc_Matchreader_t * const lcReader, std::vector < lc_Match_t > & lcChunk, size_t const lcSize );
+
+    /*! \brief Matchfile reader rewind
+     *
+     *  This function sets the reader back on the first match of the file,
+     *  allowing multiple passes on the matches.
+     *
+     *  \param  lcReader    Reader structure
+     */
+
+    void lc_matchreader_rewind ( lc_Matchreader_t * const lcReader );
+
+    /*! \brief Matchfile reader closure
+     *
+     *  This function releases the mapping of the matchfile.
+     *
+     *  \param  lcReader    Reader structure
+     */
+
+    void lc_matchreader_close ( lc_Matchreader_t * const lcReader );
+
+    /*! \brief Matchfile writer creation
+     *
+     *  This function creates the specified matchfile and writes the header,
+     *  or the count line, with a placeholder count. The flags of the writer
+     *  are reset and can be assigned before the closure.
+     *
+     *  \param  lcPath      Path of the matchfile
+     *  \param  lcWriter    Writer structure to initialize
+     *  \param  lcFormat    Matchfile format (LC_FORMAT_TEXT or LC_FORMAT_BINARY)
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchwriter_open ( char const * const lcPath, lc_Matchwriter_t * const lcWriter, int const lcFormat );
+
+    /*! \brief Matchfile archive writer creation
+     *
+     *  This function creates the specified matches archive and writes its
+     *  header with a placeholder count. The matches given to the writer are
+     *  gathered in blocks that are compressed as they are completed.
+     *
+     *  \param  lcPath      Path of the archive
+     *  \param  lcWriter    Writer structure to initialize
+     *  \param  lcStep      Quantization step, in pixels, of the coordinates
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_matchwriter_archive ( char const * const lcPath, lc_Matchwriter_t * const lcWriter, float const lcStep );
+
+    /*! \brief Matchfile writer chunk
+     *
+     *  This function appends the provided chunk of matches to the matchfile.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcChunk     Chunk of matches to write
+     */
+
+    void lc_matchwriter_chunk ( lc_Matchwriter_t * const lcWriter, std::vector < lc_Match_t > const & lcChunk );
+
+    /*! \brief Matchfile writer closure
+     *
+     *  This function updates the matches count, and the flags for binary files
+     *  and archives, of the file and closes it.
+     *
+     *  \param  lcWriter    Writer structure
+     *
+     *  \return Returns true if every write succeeded, false otherwise
+     */
+
+    bool lc_matchwriter_close ( lc_Matchwriter_t * const lcWriter );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
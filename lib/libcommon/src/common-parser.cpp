@@ -0,0 +1,441 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-parser.hpp"
+
+/*
+    Source - Exact powers of ten
+ */
+
+    static double const lc_parse_power[11] = {
+
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+
+    };
+
+/*
+    Source - Conversion locale
+ */
+
+    static locale_t lc_parse_locale( void ) {
+
+        /* C locale variables - created once, shared by the threads */
+        static locale_t const lcLocale( newlocale( LC_ALL_MASK, "C", ( locale_t ) 0 ) );
+
+        /* Return C locale */
+        return( lcLocale );
+
+    }
+
+/*
+    Source - Blank characters detection
+ */
+
+    static inline bool lc_parse_blank( char const lcChar ) {
+
+        /* Return blank detection */
+        return( ( lcChar == ' ' ) || ( lcChar == '\t' ) || ( lcChar == '\r' ) );
+
+    }
+
+/*
+    Source - Integer token parser
+ */
+
+    char const * lc_parse_integer( char const * lcStart, char const * const lcStop, long * const lcValue ) {
+
+        /* Parsing variables */
+        long lcParse( 0 );
+        bool lcSign ( false );
+
+        /* Token start variables */
+        char const * lcToken( NULL );
+
+        /* Skip leading blanks */
+        while ( ( lcStart < lcStop ) && ( lc_parse_blank( * lcStart ) == true ) ) lcStart ++;
+
+        /* Parse sign */
+        if ( ( lcStart < lcStop ) && ( ( * lcStart == '-' ) || ( * lcStart == '+' ) ) ) lcSign = ( * ( lcStart ++ ) == '-' );
+
+        /* Parse digits */
+        for ( lcToken = lcStart; ( lcStart < lcStop ) && ( * lcStart >= '0' ) && ( * lcStart <= '9' ); lcStart ++ ) {
+
+            /* Check long range before accumulation */
+            if ( lcParse > ( LONG_MAX - ( * lcStart - '0' ) ) / 10 ) return( NULL );
+
+            /* Accumulate digit */
+            lcParse = lcParse * 10 + ( * lcStart - '0' );
+
+        }
+
+        /* Check token */
+        if ( lcStart == lcToken ) return( NULL );
+
+        /* Assign parsed value */
+        * lcValue = lcSign ? - lcParse : lcParse;
+
+        /* Return token end */
+        return( lcStart );
+
+    }
+
+/*
+    Source - Floating point token parser
+ */
+
+    char const * lc_parse_float( char const * lcStart, char const * const lcStop, float * const lcValue ) {
+
+        /* Parsing variables */
+        uint64_t lcMantissa( 0 );
+        long     lcExponent( 0 );
+        long     lcExplicit( 0 );
+        int      lcDigits  ( 0 );
+        bool     lcSign    ( false );
+        bool     lcExact   ( true  );
+        bool     lcFound   ( false );
+
+        /* Conversion variables */
+        double lcParse( 0.0 );
+
+        /* Token variables */
+        char const * lcToken( NULL );
+
+        /* Skip leading blanks */
+        while ( ( lcStart < lcStop ) && ( lc_parse_blank( * lcStart ) == true ) ) lcStart ++;
+
+        /* Keep token start */
+        lcToken = lcStart;
+
+        /* Parse sign */
+        if ( ( lcStart < lcStop ) && ( ( * lcStart == '-' ) || ( * lcStart == '+' ) ) ) lcSign = ( * ( lcStart ++ ) == '-' );
+
+        /* Parse integer part */
+        for ( ; ( lcStart < lcStop ) && ( * lcStart >= '0' ) && ( * lcStart <= '9' ); lcStart ++, lcFound = true ) {
+
+            /* Check significant digits capacity */
+            if ( lcDigits < 19 ) {
+
+                /* Accumulate digit */
+                if ( ( lcMantissa = lcMantissa * 10 + ( * lcStart - '0' ) ) != 0 ) lcDigits ++;
+
+            } else {
+
+                /* Update exponent and exactness */
+                lcExponent ++; if ( * lcStart != '0' ) lcExact = false;
+
+            }
+
+        }
+
+        /* Parse fractional part */
+        if ( ( lcStart < lcStop ) && ( * lcStart == '.' ) ) {
+
+            /* Parse fractional digits */
+            for ( lcStart ++; ( lcStart < lcStop ) && ( * lcStart >= '0' ) && ( * lcStart <= '9' ); lcStart ++, lcFound = true ) {
+
+                /* Check significant digits capacity */
+                if ( lcDigits < 19 ) {
+
+                    /* Accumulate digit */
+                    if ( ( lcMantissa = lcMantissa * 10 + ( * lcStart - '0' ) ) != 0 ) lcDigits ++;
+
+                    /* Update exponent */
+                    lcExponent --;
+
+                } else if ( * lcStart != '0' ) {
+
+                    /* Update exactness */
+                    lcExact = false;
+
+                }
+
+            }
+
+        }
+
+        /* Parse explicit exponent */
+        if ( ( lcFound == true ) && ( lcStart < lcStop ) && ( ( * lcStart == 'e' ) || ( * lcStart == 'E' ) ) ) {
+
+            /* Parse exponent value - exponents beyond the long range are rejected */
+            if ( ( lcStart = lc_parse_integer( lcStart + 1, lcStop, & lcExplicit ) ) == NULL ) return( NULL );
+
+            /* Clamp and apply exponent */
+            lcExponent += ( lcExplicit > 9999 ) ? 9999 : ( ( lcExplicit < -9999 ) ? -9999 : lcExplicit );
+
+        }
+
+        /* Check token termination */
+        if ( ( lcStart < lcStop ) && ( lc_parse_blank( * lcStart ) == false ) ) lcFound = false;
+
+        /* Select conversion method */
+        if ( ( lcFound == true ) && ( lcExact == true ) && ( lcMantissa <= ( uint64_t( 1 ) << 24 ) ) && ( lcExponent >= -10 ) && ( lcExponent <= 10 ) ) {
+
+            /* Exact conversion of mantissa */
+            lcParse = ( double ) lcMantissa;
+
+            /* Apply exponent - single precision operands, no double rounding */
+            lcParse = ( lcExponent < 0 ) ? lcParse / lc_parse_power[-lcExponent] : lcParse * lc_parse_power[lcExponent];
+
+            /* Assign parsed value */
+            * lcValue = ( float ) ( lcSign ? - lcParse : lcParse );
+
+        } else {
+
+            /* Token buffer variables */
+            char lcBuffer[LC_PARSE_TOKEN] = { 0 };
+
+            /* Token end variables */
+            char * lcEnd( NULL );
+
+            /* Search token end */
+            for ( lcStart = lcToken; ( lcStart < lcStop ) && ( lc_parse_blank( * lcStart ) == false ); lcStart ++ );
+
+            /* Check token length and conversion locale */
+            if ( ( lcStart == lcToken ) || ( lcStart - lcToken >= LC_PARSE_TOKEN ) || ( lc_parse_locale() == ( locale_t ) 0 ) ) return( NULL );
+
+            /* Copy token */
+            memcpy( lcBuffer, lcToken, lcStart - lcToken );
+
+            /* Standard conversion - decimal point independent of the locale */
+            * lcValue = strtof_l( lcBuffer, & lcEnd, lc_parse_locale() );
+
+            /* Check conversion */
+            if ( lcEnd != lcBuffer + ( lcStart - lcToken ) ) return( NULL );
+
+        }
+
+        /* Return token end */
+        return( lcStart );
+
+    }
+
+/*
+    Source - Records count parser
+ */
+
+    long lc_parse_count( lc_Map_t const * const lcMap, char const ** const lcBody ) {
+
+        /* Parsing variables */
+        long lcCount( -1 );
+
+        /* Line boundary variables */
+        char const * lcStop( lcMap->data + lcMap->size );
+        char const * lcLine( ( char const * ) memchr( lcMap->data, '\n', lcMap->size ) );
+
+        /* Compute first line end */
+        if ( lcLine != NULL ) lcStop = lcLine;
+
+        /* Parse records count */
+        if ( lc_parse_integer( lcMap->data, lcStop, & lcCount ) == NULL ) return( -1 );
+
+        /* Assign records position */
+        * lcBody = ( lcLine != NULL ) ? lcLine + 1 : lcStop;
+
+        /* Return records count */
+        return( lcCount );
+
+    }
+
+/*
+    Source - Non-empty lines detection
+ */
+
+    static inline bool lc_parse_filled( char const * lcLine, char const * const lcStop ) {
+
+        /* Search non-blank character */
+        while ( ( lcLine < lcStop ) && ( lc_parse_blank( * lcLine ) == true ) ) lcLine ++;
+
+        /* Return detection */
+        return( lcLine < lcStop );
+
+    }
+
+/*
+    Source - Records lines skipping
+ */
+
+    char const * lc_parse_skip( char const * lcStart, char const * const lcStop, size_t const lcCount, size_t * const lcFound ) {
+
+        /* Line end variables */
+        char const * lcNext( NULL );
+
+        /* Reset lines count */
+        * lcFound = 0;
+
+        /* Skip lines */
+        while ( ( lcStart < lcStop ) && ( * lcFound < lcCount ) ) {
+
+            /* Search line end */
+            if ( ( lcNext = ( char const * ) memchr( lcStart, '\n', lcStop - lcStart ) ) == NULL ) lcNext = lcStop;
+
+            /* Count non-empty lines */
+            if ( lc_parse_filled( lcStart, lcNext ) == true ) ( * lcFound ) ++;
+
+            /* Next line */
+            lcStart = ( lcNext < lcStop ) ? lcNext + 1 : lcStop;
+
+        }
+
+        /* Return position */
+        return( lcStart );
+
+    }
+
+/*
+    Source - Records parallel parser
+ */
+
+    bool lc_parse_records( char const * const lcStart, char const * const lcStop, size_t const lcCount, void * const lcRecord, size_t const lcSize, lc_Parser_t const lcParser, size_t * const lcFound ) {
+
+        /* Chunks count variables */
+        long lcChunks( 1 );
+
+        /* Parsing status variables */
+        bool lcReturn( true );
+
+        /* Compute chunks count */
+        # ifdef __OPENMP__
+        lcChunks = omp_get_max_threads() * 4;
+        # endif
+
+        /* Limit chunks count according to text size */
+        if ( ( long ) ( ( lcStop - lcStart ) / LC_PARSE_CHUNK ) + 1 < lcChunks ) lcChunks = ( lcStop - lcStart ) / LC_PARSE_CHUNK + 1;
+
+        /* Chunks boundaries and first record index */
+        std::vector < char const * > lcBound( lcChunks + 1, lcStop );
+        std::vector < size_t       > lcFirst( lcChunks + 1, 0      );
+
+        /* Assign first boundary */
+        lcBound[0] = lcStart;
+
+        /* Compute chunks boundaries on lines ends */
+        for ( long lcChunk( 1 ); lcChunk < lcChunks; lcChunk ++ ) {
+
+            /* Approximated boundary */
+            char const * lcApprox( lcStart + ( ( lcStop - lcStart ) / lcChunks ) * lcChunk );
+
+            /* Line end variables */
+            char const * lcLine( NULL );
+
+            /* Ensure boundaries ordering */
+            if ( lcApprox < lcBound[lcChunk - 1] ) lcApprox = lcBound[lcChunk - 1];
+
+            /* Search line end */
+            lcLine = ( char const * ) memchr( lcApprox, '\n', lcStop - lcApprox );
+
+            /* Assign boundary */
+            lcBound[lcChunk] = ( lcLine != NULL ) ? lcLine + 1 : lcStop;
+
+        }
+
+        /* Count chunks records */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic )
+        # endif
+        for ( long lcChunk = 0; lcChunk < lcChunks; lcChunk ++ ) {
+
+            /* Line boundaries variables */
+            char const * lcLine( lcBound[lcChunk] );
+            char const * lcNext( NULL );
+
+            /* Parse chunk lines */
+            while ( lcLine < lcBound[lcChunk + 1] ) {
+
+                /* Search line end */
+                if ( ( lcNext = ( char const * ) memchr( lcLine, '\n', lcBound[lcChunk + 1] - lcLine ) ) == NULL ) lcNext = lcBound[lcChunk + 1];
+
+                /* Count non-empty lines */
+                if ( lc_parse_filled( lcLine, lcNext ) == true ) lcFirst[lcChunk + 1] ++;
+
+                /* Next line */
+                lcLine = lcNext + 1;
+
+            }
+
+        }
+
+        /* Compute chunks first record index */
+        for ( long lcChunk( 0 ); lcChunk < lcChunks; lcChunk ++ ) lcFirst[lcChunk + 1] += lcFirst[lcChunk];
+
+        /* Assign parsed records count */
+        * lcFound = ( lcFirst[lcChunks] < lcCount ) ? lcFirst[lcChunks] : lcCount;
+
+        /* Parse chunks records */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic ) reduction( && : lcReturn )
+        # endif
+        for ( long lcChunk = 0; lcChunk < lcChunks; lcChunk ++ ) {
+
+            /* Record index variables */
+            size_t lcIndex( lcFirst[lcChunk] );
+
+            /* Line boundaries variables */
+            char const * lcLine( lcBound[lcChunk] );
+            char const * lcNext( NULL );
+
+            /* Parse chunk lines */
+            while ( ( lcLine < lcBound[lcChunk + 1] ) && ( lcIndex < lcCount ) ) {
+
+                /* Search line end */
+                if ( ( lcNext = ( char const * ) memchr( lcLine, '\n', lcBound[lcChunk + 1] - lcLine ) ) == NULL ) lcNext = lcBound[lcChunk + 1];
+
+                /* Parse non-empty lines */
+                if ( lc_parse_filled( lcLine, lcNext ) == true ) {
+
+                    /* Parse record */
+                    if ( lcParser( lcLine, lcNext, ( char * ) lcRecord + ( lcIndex ++ ) * lcSize ) == false ) lcReturn = false;
+
+                }
+
+                /* Next line */
+                lcLine = lcNext + 1;
+
+            }
+
+        }
+
+        /* Return parsing status */
+        return( lcReturn );
+
+    }
+
@@ -0,0 +1,195 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-parser.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Text files parallel parser
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_PARSER__
+    # define __LC_PARSER__
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.hpp"
+    # include "common-mapping.hpp"
+    # include <stdint.h>
+    # include <stdlib.h>
+    # include <limits.h>
+    # include <locale.h>
+    # ifdef __OPENMP__
+    # include <omp.h>
+    # endif
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define minimum chunk size */
+    # define LC_PARSE_CHUNK     ( 1 << 20 )
+
+    /* Define fallback token size */
+    # define LC_PARSE_TOKEN     64
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+    /*! \brief Record line parser
+     *
+     *  Type of the functions used to parse one record line of a text file.
+     *  The function parses the line starting at lcLine and stopping at lcStop
+     *  (excluded) and stores the result in the record pointed by lcRecord.
+     *  It returns true on success, false otherwise.
+     */
+
+    typedef bool ( * lc_Parser_t ) ( char const * lcLine, char const * const lcStop, void * const lcRecord );
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Integer token parser
+     *
+     *  This function parses the integer token that follows the provided
+     *  position, skipping leading blanks. The parsing is independent of the
+     *  locale. Tokens whose value exceeds the range of long integers are
+     *  rejected.
+     *
+     *  \param  lcStart     Parsing start position
+     *  \param  lcStop      Parsing stop position (excluded)
+     *  \param  lcValue     Pointer to the variable receiving the integer
+     *
+     *  \return Returns the position following the token, NULL on failure
+     */
+
+    char const * lc_parse_integer ( char const * lcStart, char const * const lcStop, long * const lcValue );
+
+    /*! \brief Floating point token parser
+     *
+     *  This function parses the floating point token that follows the provided
+     *  position, skipping leading blanks. The parsing is independent of the
+     *  locale. Tokens whose mantissa and power of ten are both exact single
+     *  precision values are directly converted, which is correctly rounded,
+     *  the others being delegated to the standard library using the C locale.
+     *
+     *  \param  lcStart     Parsing start position
+     *  \param  lcStop      Parsing stop position (excluded)
+     *  \param  lcValue     Pointer to the variable receiving the value
+     *
+     *  \return Returns the position following the token, NULL on failure
+     */
+
+    char const * lc_parse_float ( char const * lcStart, char const * const lcStop, float * const lcValue );
+
+    /*! \brief Records count parser
+     *
+     *  This function parses the records count found on the first line of the
+     *  suite text files. The position of the second line, where the records
+     *  start, is returned through lcBody.
+     *
+     *  \param  lcMap       Mapping of the text file
+     *  \param  lcBody      Pointer receiving the position of the records
+     *
+     *  \return Returns the records count, -1 on failure
+     */
+
+    long lc_parse_count ( lc_Map_t const * const lcMap, char const ** const lcBody );
+
+    /*! \brief Records lines skipping
+     *
+     *  This function searches the position that follows the specified amount
+     *  of non-empty lines. The amount of lines actually found is returned
+     *  through lcFound, which is smaller than the requested count only when
+     *  the end of the text is reached.
+     *
+     *  \param  lcStart     Position of the first record line
+     *  \param  lcStop      End of the text (excluded)
+     *  \param  lcCount     Amount of non-empty lines to skip
+     *  \param  lcFound     Pointer receiving the amount of skipped lines
+     *
+     *  \return Returns the position following the last skipped line
+     */
+
+    char const * lc_parse_skip ( char const * lcStart, char const * const lcStop, size_t const lcCount, size_t * const lcFound );
+
+    /*! \brief Records parallel parser
+     *
+     *  This function parses the records of a text file, one record per line,
+     *  into the provided pre-allocated array. The text is split in chunks at
+     *  lines boundaries. The non-empty lines of each chunk are counted to
+     *  obtain the index of the first record of each chunk before the chunks
+     *  are parsed in parallel. Lines that follow the expected records count
+     *  are ignored. When the text holds less records than expected, only the
+     *  available records are parsed and their amount is returned through
+     *  lcFound, leaving the decision to the caller.
+     *
+     *  \param  lcStart     Position of the first record line
+     *  \param  lcStop      End of the text (excluded)
+     *  \param  lcCount     Expected records count
+     *  \param  lcRecord    Pointer to the records array
+     *  \param  lcSize      Size, in bytes, of one record
+     *  \param  lcParser    Record line parser
+     *  \param  lcFound     Pointer receiving the amount of parsed records
+     *
+     *  \return Returns true if the found records are parsed, false otherwise
+     */
+
+    bool lc_parse_records ( char const * const lcStart, char const * const lcStop, size_t const lcCount, void * const lcRecord, size_t const lcSize, lc_Parser_t const lcParser, size_t * const lcFound );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
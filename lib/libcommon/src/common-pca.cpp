@@ -0,0 +1,232 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-pca.hpp"
+
+/*
+    Source - Principal components learning
+ */
+
+    bool lc_pca_learn( cv::Mat const & lcSample, lc_Pca_t * const lcPca ) {
+
+        /* Check learning descriptors */
+        if ( ( lcSample.rows < 2 ) || ( lcSample.type() != CV_32FC1 ) ) return( false );
+
+        /* Compute principal components */
+        cv::PCA lcAnalysis( lcSample, cv::Mat(), CV_PCA_DATA_AS_ROW );
+
+        /* Assign mean descriptor and components */
+        lcPca->mean  = lcAnalysis.mean.clone();
+        lcPca->basis = lcAnalysis.eigenvectors.clone();
+
+        /* Assign components variances as a row */
+        lcPca->variance = cv::Mat( 1, lcAnalysis.eigenvalues.rows, CV_32FC1, lcAnalysis.eigenvalues.ptr < float > () ).clone();
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Retained variance
+ */
+
+    double lc_pca_retained( lc_Pca_t const * const lcPca, int const lcDimension ) {
+
+        /* Accumulation variables */
+        double lcKept ( 0.0 );
+        double lcTotal( 0.0 );
+
+        /* Accumulate components variances */
+        for ( int lcParse( 0 ); lcParse < lcPca->variance.cols; lcParse ++ ) {
+
+            /* Accumulate total variance */
+            lcTotal += lcPca->variance.ptr < float > ( 0 )[lcParse];
+
+            /* Accumulate retained variance */
+            if ( lcParse < lcDimension ) lcKept += lcPca->variance.ptr < float > ( 0 )[lcParse];
+
+        }
+
+        /* Return retained fraction */
+        return( ( lcTotal > 0.0 ) ? lcKept / lcTotal : 0.0 );
+
+    }
+
+/*
+    Source - Descriptors projection
+ */
+
+    void lc_pca_project( lc_Pca_t const * const lcPca, cv::Mat const & lcDesc, float const lcScale, int const lcDimension, cv::Mat & lcProject ) {
+
+        /* Components amount variables */
+        int lcCount( ( ( lcDimension > 0 ) && ( lcDimension < lcPca->basis.rows ) ) ? lcDimension : lcPca->basis.rows );
+
+        /* Floating point descriptors variables */
+        cv::Mat lcFloat;
+
+        /* Convert descriptors in floating point - quantization scale removed */
+        lcDesc.convertTo( lcFloat, CV_32F, ( lcScale > 0.0 ) ? 1.0 / lcScale : 1.0 );
+
+        /* Create projected descriptors matrix */
+        lcProject.create( lcDesc.rows, lcCount, CV_32FC1 );
+
+        /* Project descriptors */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( static )
+        # endif
+        for ( int lcParse = 0; lcParse < lcFloat.rows; lcParse ++ ) {
+
+            /* Centered descriptor variables */
+            std::vector < float > lcCenter( lcFloat.cols );
+
+            /* Center descriptor */
+            for ( int lcComp( 0 ); lcComp < lcFloat.cols; lcComp ++ ) lcCenter[lcComp] = lcFloat.ptr < float > ( lcParse )[lcComp] - lcPca->mean.ptr < float > ( 0 )[lcComp];
+
+            /* Compute components coordinates */
+            for ( int lcAxis( 0 ); lcAxis < lcCount; lcAxis ++ ) {
+
+                /* Component pointer variables */
+                float const * lcBasis( lcPca->basis.ptr < float > ( lcAxis ) );
+
+                /* Accumulation variables */
+                float lcDot( 0.0 );
+
+                /* Accumulate coordinate */
+                for ( int lcComp( 0 ); lcComp < lcFloat.cols; lcComp ++ ) lcDot += lcCenter[lcComp] * lcBasis[lcComp];
+
+                /* Assign coordinate */
+                lcProject.ptr < float > ( lcParse )[lcAxis] = lcDot;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Basis exportation
+ */
+
+    bool lc_pca_write( char const * const lcPath, lc_Pca_t const * const lcPca, int const lcDimension ) {
+
+        /* Components amount variables */
+        int lcCount( ( ( lcDimension > 0 ) && ( lcDimension < lcPca->basis.rows ) ) ? lcDimension : lcPca->basis.rows );
+
+        /* Header variables */
+        lc_Header_t lcHeader( lc_format_header( LC_PCA_MAGIC, LC_PCA_LAYOUT, lcPca->mean.cols, lcCount + 2 ) );
+
+        /* Writer variables */
+        lc_Writer_t lcWriter;
+
+        /* Assign components amount */
+        lcHeader.flags = lcCount;
+
+        /* Create basis file */
+        if ( lc_writer_open( lcPath, & lcWriter ) == false ) return( false );
+
+        /* Write header */
+        lc_writer_raw( & lcWriter, & lcHeader, sizeof( lc_Header_t ) );
+
+        /* Write mean descriptor and variances */
+        lc_writer_raw( & lcWriter, lcPca->mean.ptr < float > ( 0 ), lcHeader.size );
+        lc_writer_raw( & lcWriter, lcPca->variance.ptr < float > ( 0 ), lcHeader.size );
+
+        /* Write components */
+        for ( int lcParse( 0 ); lcParse < lcCount; lcParse ++ ) lc_writer_raw( & lcWriter, lcPca->basis.ptr < float > ( lcParse ), lcHeader.size );
+
+        /* Close basis file */
+        return( lc_writer_close( & lcWriter ) );
+
+    }
+
+/*
+    Source - Basis importation
+ */
+
+    bool lc_pca_read( char const * const lcPath, lc_Pca_t * const lcPca ) {
+
+        /* Mapping variables */
+        lc_Map_t lcMap;
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( NULL );
+
+        /* Records pointer variables */
+        float * lcRecord( NULL );
+
+        /* Reading status variables */
+        bool lcRead( false );
+
+        /* Map basis file */
+        if ( lc_map_open( lcPath, & lcMap ) == false ) return( false );
+
+        /* Verify header */
+        if ( ( lcHeader = lc_format_check( & lcMap, LC_PCA_MAGIC, LC_PCA_LAYOUT ) ) != NULL ) {
+
+            /* Verify components amount against records count */
+            if ( ( lcHeader->flags > 0 ) && ( lcHeader->flags <= lcHeader->width ) && ( lcHeader->count == ( uint64_t ) lcHeader->flags + 2 ) ) {
+
+                /* Assign records pointer */
+                lcRecord = ( float * ) LC_FORMAT_DATA( lcMap );
+
+                /* Copy mean descriptor, variances and components - the mapping is released */
+                lcPca->mean     = cv::Mat( 1, lcHeader->width, CV_32FC1, lcRecord ).clone();
+                lcPca->variance = cv::Mat( 1, lcHeader->width, CV_32FC1, lcRecord + lcHeader->width ).clone();
+                lcPca->basis    = cv::Mat( lcHeader->flags, lcHeader->width, CV_32FC1, lcRecord + 2 * lcHeader->width ).clone();
+
+                /* Update reading status */
+                lcRead = true;
+
+            }
+
+        }
+
+        /* Unmap basis file */
+        lc_map_close( & lcMap );
+
+        /* Send message */
+        return( lcRead );
+
+    }
+
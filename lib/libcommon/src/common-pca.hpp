@@ -0,0 +1,192 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-pca.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Descriptors principal components projection
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_PCA__
+    # define __LC_PCA__
+
+/* 
+    Header - Includes
+ */
+
+    # include <vector>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-writer.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define basis file format */
+    # define LC_PCA_MAGIC  "FSPCABAS"
+    # define LC_PCA_LAYOUT "f"
+
+    /* Define default learning sample size */
+    # define LC_PCA_SAMPLE 65536
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Pca_struct
+     *  \brief Principal components basis structure
+     *
+     *  Structure that stores a principal components basis learned on a sample
+     *  of descriptors. The components are sorted by decreasing variance. The
+     *  variances of all components are kept, so that the variance retained by
+     *  any amount of leading components can be computed.
+     *
+     *  \var lc_Pca_struct::mean
+     *  Mean descriptor, one row
+     *  \var lc_Pca_struct::basis
+     *  Principal components, one row per component
+     *  \var lc_Pca_struct::variance
+     *  Variances of all components, one row
+     */
+
+    typedef struct lc_Pca_struct {
+
+        cv::Mat mean;
+        cv::Mat basis;
+        cv::Mat variance;
+
+    } lc_Pca_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Principal components learning
+     *
+     *  This function learns the principal components basis of the provided
+     *  floating point descriptors using the OpenCV PCA. All components are
+     *  kept.
+     *
+     *  \param  lcSample    Learning descriptors matrix (CV_32F)
+     *  \param  lcPca       Basis structure
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_pca_learn ( cv::Mat const & lcSample, lc_Pca_t * const lcPca );
+
+    /*! \brief Retained variance
+     *
+     *  This function returns the fraction of the total variance retained by
+     *  the provided amount of leading components.
+     *
+     *  \param  lcPca       Basis structure
+     *  \param  lcDimension Amount of leading components
+     *
+     *  \return Returns the retained fraction of variance
+     */
+
+    double lc_pca_retained ( lc_Pca_t const * const lcPca, int const lcDimension );
+
+    /*! \brief Descriptors projection
+     *
+     *  This function projects the provided descriptors on the leading
+     *  components of the basis. Quantized descriptors are brought back to
+     *  their floating point values using their scale before projection. The
+     *  projected descriptors are floating point ones.
+     *
+     *  \param  lcPca       Basis structure
+     *  \param  lcDesc      Descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcScale     Descriptors quantization scale, zero if not quantized
+     *  \param  lcDimension Amount of leading components, all if not positive
+     *  \param  lcProject   Matrix receiving the projected descriptors
+     */
+
+    void lc_pca_project ( lc_Pca_t const * const lcPca, cv::Mat const & lcDesc, float const lcScale, int const lcDimension, cv::Mat & lcProject );
+
+    /*! \brief Basis exportation
+     *
+     *  This function writes the leading components of the basis in a binary
+     *  file. The records are the mean descriptor, the variances of all
+     *  components and the written components, the header flags storing the
+     *  amount of written components.
+     *
+     *  \param  lcPath      Path of the basis file
+     *  \param  lcPca       Basis structure
+     *  \param  lcDimension Amount of written components, all if not positive
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_pca_write ( char const * const lcPath, lc_Pca_t const * const lcPca, int const lcDimension );
+
+    /*! \brief Basis importation
+     *
+     *  This function reads a basis file. The basis is copied so that the file
+     *  mapping is released.
+     *
+     *  \param  lcPath      Path of the basis file
+     *  \param  lcPca       Basis structure
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_pca_read ( char const * const lcPath, lc_Pca_t * const lcPca );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
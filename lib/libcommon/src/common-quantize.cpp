@@ -0,0 +1,207 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-quantize.hpp"
+
+/*
+    Source - Descriptors components mode
+ */
+
+    int lc_quantize_mode( int const lcType ) {
+
+        /* Select components mode */
+        switch ( lcType ) {
+
+            /* Return components mode */
+            case ( CV_32FC1 ) : return( LC_QUANTIZE_FLOAT    );
+            case ( CV_8UC1  ) : return( LC_QUANTIZE_UNSIGNED );
+            case ( CV_8SC1  ) : return( LC_QUANTIZE_SIGNED   );
+
+        }
+
+        /* Unsupported type */
+        return( -1 );
+
+    }
+
+/*
+    Source - Descriptors matrix type
+ */
+
+    int lc_quantize_type( int const lcMode ) {
+
+        /* Select matrix type */
+        switch ( lcMode ) {
+
+            /* Return matrix type */
+            case ( LC_QUANTIZE_FLOAT    ) : return( CV_32FC1 );
+            case ( LC_QUANTIZE_UNSIGNED ) : return( CV_8UC1  );
+            case ( LC_QUANTIZE_SIGNED   ) : return( CV_8SC1  );
+
+        }
+
+        /* Unknown mode */
+        return( -1 );
+
+    }
+
+/*
+    Source - Descriptors components layout
+ */
+
+    char const * lc_quantize_layout( int const lcMode ) {
+
+        /* Select layout string */
+        switch ( lcMode ) {
+
+            /* Return layout string */
+            case ( LC_QUANTIZE_FLOAT    ) : return( "f" );
+            case ( LC_QUANTIZE_UNSIGNED ) : return( "B" );
+            case ( LC_QUANTIZE_SIGNED   ) : return( "b" );
+
+        }
+
+        /* Unknown mode */
+        return( NULL );
+
+    }
+
+/*
+    Source - Descriptors quantization
+ */
+
+    bool lc_quantize( cv::Mat const & lcDesc, cv::Mat & lcQuant, int const lcMode, float const lcScale ) {
+
+        /* Saturation range variables */
+        float lcLow ( lcMode == LC_QUANTIZE_SIGNED ? INT8_MIN : 0 );
+        float lcHigh( lcMode == LC_QUANTIZE_SIGNED ? INT8_MAX : UINT8_MAX );
+
+        /* Check parameters */
+        if ( ( lcDesc.type() != CV_32FC1 ) || ( lcScale <= 0.0 ) || ( ( lcMode != LC_QUANTIZE_UNSIGNED ) && ( lcMode != LC_QUANTIZE_SIGNED ) ) ) return( false );
+
+        /* Allocate quantized matrix */
+        lcQuant.create( lcDesc.rows, lcDesc.cols, lc_quantize_type( lcMode ) );
+
+        /* Quantize descriptors */
+        for ( int lcRow( 0 ); lcRow < lcDesc.rows; lcRow ++ ) {
+
+            /* Row pointers variables */
+            float const * lcSource( lcDesc.ptr < float > ( lcRow ) );
+            uint8_t     * lcTarget( lcQuant.ptr < uint8_t > ( lcRow ) );
+
+            /* Quantize components */
+            for ( int lcCol( 0 ); lcCol < lcDesc.cols; lcCol ++ ) {
+
+                /* Scale, round and saturate component */
+                float lcValue( std::min( std::max( std::floor( lcSource[lcCol] * lcScale + 0.5f ), lcLow ), lcHigh ) );
+
+                /* Assign component - signed values are stored in two's complement */
+                lcTarget[lcCol] = ( lcMode == LC_QUANTIZE_SIGNED ) ? ( uint8_t ) ( int8_t ) lcValue : ( uint8_t ) lcValue;
+
+            }
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Quantization scale estimation
+ */
+
+    float lc_quantize_scale( cv::Mat const & lcDesc, int const lcMode ) {
+
+        /* Components maximum variables */
+        float lcMaximum( 0.0 );
+
+        /* Check parameters */
+        if ( ( lcDesc.type() != CV_32FC1 ) || ( ( lcMode != LC_QUANTIZE_UNSIGNED ) && ( lcMode != LC_QUANTIZE_SIGNED ) ) ) return( 0.0 );
+
+        /* Search components maximum magnitude */
+        for ( int lcRow( 0 ); lcRow < lcDesc.rows; lcRow ++ ) {
+
+            /* Row pointer variables */
+            float const * lcSource( lcDesc.ptr < float > ( lcRow ) );
+
+            /* Update maximum */
+            for ( int lcCol( 0 ); lcCol < lcDesc.cols; lcCol ++ ) lcMaximum = std::max( lcMaximum, std::fabs( lcSource[lcCol] ) );
+
+        }
+
+        /* Check maximum - null descriptors have no scale */
+        if ( ( lcMaximum > 0.0 ) == false ) return( 0.0 );
+
+        /* Return scale mapping the maximum on the largest symmetric quantized value */
+        return( ( lcMode == LC_QUANTIZE_SIGNED ? INT8_MAX : UINT8_MAX ) / lcMaximum );
+
+    }
+
+/*
+    Source - Quantization recall
+ */
+
+    double lc_quantize_recall( cv::Mat const & lcQuery, cv::Mat const & lcTrain, cv::Mat const & lcQQuery, cv::Mat const & lcQTrain ) {
+
+        /* Matches variables */
+        std::vector < cv::DMatch > lcFloat;
+        std::vector < cv::DMatch > lcQuant;
+
+        /* Retrieved neighbours variables */
+        size_t lcFound( 0 );
+
+        /* Search floating point and quantized neighbours */
+        lc_brute_match( lcQuery , lcTrain , lcFloat );
+        lc_brute_match( lcQQuery, lcQTrain, lcQuant );
+
+        /* Check matches consistency */
+        if ( ( lcFloat.empty() == true ) || ( lcFloat.size() != lcQuant.size() ) ) return( 0.0 );
+
+        /* Count retrieved neighbours */
+        for ( size_t lcParse( 0 ); lcParse < lcFloat.size(); lcParse ++ ) if ( lcFloat[lcParse].trainIdx == lcQuant[lcParse].trainIdx ) lcFound ++;
+
+        /* Return recall */
+        return( ( double ) lcFound / lcFloat.size() );
+
+    }
+
@@ -0,0 +1,183 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-quantize.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Descriptors quantization
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_QUANTIZE__
+    # define __LC_QUANTIZE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <vector>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include "common-brute.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define descriptors components modes */
+    # define LC_QUANTIZE_FLOAT    0
+    # define LC_QUANTIZE_UNSIGNED 1
+    # define LC_QUANTIZE_SIGNED   2
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Descriptors components mode
+     *
+     *  This function returns the components mode corresponding to the type
+     *  of the provided descriptors matrix.
+     *
+     *  \param  lcType      Descriptors matrix type
+     *
+     *  \return Returns the components mode, -1 for unsupported types
+     */
+
+    int lc_quantize_mode ( int const lcType );
+
+    /*! \brief Descriptors matrix type
+     *
+     *  This function returns the descriptors matrix type of the provided
+     *  components mode.
+     *
+     *  \param  lcMode      Components mode
+     *
+     *  \return Returns the matrix type, -1 for unknown modes
+     */
+
+    int lc_quantize_type ( int const lcMode );
+
+    /*! \brief Descriptors components layout
+     *
+     *  This function returns the binary layout string describing a component
+     *  of the provided mode, as used in the suite binary headers.
+     *
+     *  \param  lcMode      Components mode
+     *
+     *  \return Returns the layout string, NULL for unknown modes
+     */
+
+    char const * lc_quantize_layout ( int const lcMode );
+
+    /*! \brief Descriptors quantization
+     *
+     *  This function converts floating point descriptors in 8 bits integer
+     *  descriptors. Each component is multiplied by the scale, rounded and
+     *  saturated to the range of the quantized type. The same scale has to be
+     *  used for all the descriptors of a dataset so that quantized distances
+     *  remain comparable : they are the floating point distances multiplied
+     *  by the scale, up to the rounding.
+     *
+     *  \param  lcDesc      Floating point descriptors matrix (CV_32F)
+     *  \param  lcQuant     Matrix receiving the quantized descriptors
+     *  \param  lcMode      Quantized components mode, signed or unsigned
+     *  \param  lcScale     Quantization scale
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_quantize ( cv::Mat const & lcDesc, cv::Mat & lcQuant, int const lcMode, float const lcScale );
+
+    /*! \brief Quantization scale estimation
+     *
+     *  This function computes the quantization scale that maps the largest
+     *  component magnitude of the provided descriptors on the largest value
+     *  of the quantized type, 255 for unsigned and 127 for signed components.
+     *  Computed on a reference set of descriptors, it gives the dataset scale
+     *  of \b lc_quantize without saturation of the reference set.
+     *
+     *  \param  lcDesc      Floating point descriptors matrix (CV_32F)
+     *  \param  lcMode      Quantized components mode, signed or unsigned
+     *
+     *  \return Returns the quantization scale, zero on failure or for null
+     *  descriptors
+     */
+
+    float lc_quantize_scale ( cv::Mat const & lcDesc, int const lcMode );
+
+    /*! \brief Quantization recall
+     *
+     *  This function measures the accuracy of quantized matching against the
+     *  floating point matching. The exact nearest neighbour of each query is
+     *  searched using both representations and the fraction of queries for
+     *  which the quantized search retrieves the floating point neighbour is
+     *  returned.
+     *
+     *  \param  lcQuery     Floating point query descriptors
+     *  \param  lcTrain     Floating point train descriptors
+     *  \param  lcQQuery    Quantized query descriptors
+     *  \param  lcQTrain    Quantized train descriptors
+     *
+     *  \return Returns the recall, in [0,1]
+     */
+
+    double lc_quantize_recall ( cv::Mat const & lcQuery, cv::Mat const & lcTrain, cv::Mat const & lcQQuery, cv::Mat const & lcQTrain );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,283 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-sketch.hpp"
+
+/*
+    Source - Population count
+ */
+
+    static inline uint32_t lc_sketch_count( uint64_t lcWord ) {
+
+        /* Count bits by pairs, nibbles and bytes */
+        lcWord = lcWord - ( ( lcWord >> 1 ) & 0x5555555555555555ULL );
+        lcWord = ( lcWord & 0x3333333333333333ULL ) + ( ( lcWord >> 2 ) & 0x3333333333333333ULL );
+        lcWord = ( lcWord + ( lcWord >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+
+        /* Sum bytes counts */
+        return( ( lcWord * 0x0101010101010101ULL ) >> 56 );
+
+    }
+
+/*
+    Source - Descriptor component
+ */
+
+    static inline float lc_sketch_component( cv::Mat const & lcDesc, int const lcRow, int const lcComp ) {
+
+        /* Return component according to descriptors type */
+        switch ( lcDesc.depth() ) {
+
+            case ( CV_8U ) : return( lcDesc.ptr < unsigned char > ( lcRow )[lcComp] );
+            case ( CV_8S ) : return( lcDesc.ptr < signed char   > ( lcRow )[lcComp] );
+
+        }
+
+        /* Return floating point component */
+        return( lcDesc.ptr < float > ( lcRow )[lcComp] );
+
+    }
+
+/*
+    Source - Descriptor encoding
+ */
+
+    static void lc_sketch_encode( cv::Mat const & lcDesc, int const lcRow, std::vector < float > const & lcMedian, int const lcWords, uint64_t * const lcCode ) {
+
+        /* Reset sketch words */
+        std::fill( lcCode, lcCode + lcWords, 0 );
+
+        /* Set bits of components above median */
+        for ( int lcComp( 0 ); lcComp < lcDesc.cols; lcComp ++ ) {
+
+            /* Set component bit */
+            if ( lc_sketch_component( lcDesc, lcRow, lcComp ) > lcMedian[lcComp] ) lcCode[lcComp >> 6] |= ( uint64_t ) 1 << ( lcComp & 63 );
+
+        }
+
+    }
+
+/*
+    Source - Squared distance
+ */
+
+    template < typename T >
+    static inline float lc_sketch_distance( T const * const lcA, T const * const lcB, int const lcDimension ) {
+
+        /* Accumulation variables */
+        float lcSum( 0.0 );
+
+        /* Accumulate squared components */
+        for ( int lcComp( 0 ); lcComp < lcDimension; lcComp ++ ) lcSum += ( ( float ) lcA[lcComp] - lcB[lcComp] ) * ( ( float ) lcA[lcComp] - lcB[lcComp] );
+
+        /* Return squared distance */
+        return( lcSum );
+
+    }
+
+/*
+    Source - Shortlist ranking
+ */
+
+    template < typename T >
+    static void lc_sketch_rank( cv::Mat const & lcQuery, int const lcRow, cv::Mat const & lcTrain, std::vector < uint32_t > const & lcList, std::vector < std::pair < float, uint32_t > > & lcRank ) {
+
+        /* Reset ranking */
+        lcRank.resize( lcList.size() );
+
+        /* Compute exact distances of shortlist */
+        for ( size_t lcParse( 0 ); lcParse < lcList.size(); lcParse ++ ) {
+
+            /* Assign candidate distance */
+            lcRank[lcParse] = std::make_pair( lc_sketch_distance( lcQuery.ptr < T > ( lcRow ), lcTrain.ptr < T > ( lcList[lcParse] ), lcQuery.cols ), lcList[lcParse] );
+
+        }
+
+    }
+
+/*
+    Source - Binary sketches building
+ */
+
+    void lc_sketch_build( cv::Mat const & lcTrain, lc_Sketch_t * const lcSketch ) {
+
+        /* Dimension values variables */
+        std::vector < float > lcValue( lcTrain.rows );
+
+        /* Assign sketch size */
+        lcSketch->words = ( lcTrain.cols + 63 ) / 64;
+
+        /* Reset medians */
+        lcSketch->median.assign( lcTrain.cols, 0.0 );
+
+        /* Compute dimensions medians */
+        for ( int lcComp( 0 ); ( lcComp < lcTrain.cols ) && ( lcTrain.rows > 0 ); lcComp ++ ) {
+
+            /* Gather dimension values */
+            for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) lcValue[lcParse] = lc_sketch_component( lcTrain, lcParse, lcComp );
+
+            /* Select median value */
+            std::nth_element( lcValue.begin(), lcValue.begin() + lcTrain.rows / 2, lcValue.end() );
+
+            /* Assign dimension median */
+            lcSketch->median[lcComp] = lcValue[lcTrain.rows / 2];
+
+        }
+
+        /* Create sketches */
+        lcSketch->code.resize( ( size_t ) lcTrain.rows * lcSketch->words );
+
+        /* Encode train descriptors */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( static )
+        # endif
+        for ( int lcParse = 0; lcParse < lcTrain.rows; lcParse ++ ) {
+
+            /* Encode descriptor */
+            lc_sketch_encode( lcTrain, lcParse, lcSketch->median, lcSketch->words, lcSketch->code.data() + ( size_t ) lcParse * lcSketch->words );
+
+        }
+
+    }
+
+/*
+    Source - Prefiltered nearest neighbours search
+ */
+
+    void lc_sketch_knn( lc_Sketch_t const * const lcSketch, cv::Mat const & lcTrain, cv::Mat const & lcQuery, int const lcShortlist, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK ) {
+
+        /* Sketch size variables */
+        int lcWords( lcSketch->words );
+
+        /* Reset neighbours array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check descriptors */
+        if ( ( lcTrain.rows == 0 ) || ( lcK < 1 ) ) return;
+
+        /* Search queries neighbours */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic, 64 )
+        # endif
+        for ( int lcParse = 0; lcParse < lcQuery.rows; lcParse ++ ) {
+
+            /* Query sketch variables */
+            std::vector < uint64_t > lcCode( lcWords );
+
+            /* Hamming distances variables */
+            std::vector < uint16_t > lcHamming( lcTrain.rows );
+
+            /* Hamming distances histogram */
+            std::vector < uint32_t > lcCount( lcWords * 64 + 1, 0 );
+
+            /* Shortlist variables */
+            std::vector < uint32_t > lcList;
+
+            /* Ranking variables */
+            std::vector < std::pair < float, uint32_t > > lcRank;
+
+            /* Shortlist size variables - never less than neighbours */
+            uint32_t lcSize( std::min( std::max( lcShortlist, lcK ), lcTrain.rows ) );
+
+            /* Selection threshold variables */
+            uint32_t lcLimit( 0 );
+            uint32_t lcBelow( 0 );
+
+            /* Encode query descriptor */
+            lc_sketch_encode( lcQuery, lcParse, lcSketch->median, lcWords, lcCode.data() );
+
+            /* Compute hamming distances */
+            for ( int lcIndex( 0 ); lcIndex < lcTrain.rows; lcIndex ++ ) {
+
+                /* Train sketch variables */
+                uint64_t const * lcTrainCode( lcSketch->code.data() + ( size_t ) lcIndex * lcWords );
+
+                /* Hamming distance variables */
+                uint16_t lcDistance( 0 );
+
+                /* Accumulate words population counts */
+                for ( int lcWord( 0 ); lcWord < lcWords; lcWord ++ ) lcDistance += lc_sketch_count( lcCode[lcWord] ^ lcTrainCode[lcWord] );
+
+                /* Assign and count distance */
+                lcCount[lcHamming[lcIndex] = lcDistance] ++;
+
+            }
+
+            /* Search selection threshold - distances below threshold all enter the shortlist */
+            while ( lcBelow + lcCount[lcLimit] < lcSize ) lcBelow += lcCount[lcLimit ++];
+
+            /* Gather shortlist - threshold distance completes the shortlist */
+            for ( int lcIndex( 0 ); ( lcIndex < lcTrain.rows ) && ( lcList.size() < lcSize ); lcIndex ++ ) {
+
+                /* Push candidate below threshold */
+                if ( lcHamming[lcIndex] < lcLimit ) lcList.push_back( lcIndex );
+
+                /* Push candidate at threshold while room remains */
+                else if ( ( lcHamming[lcIndex] == lcLimit ) && ( lcBelow < lcSize ) ) lcList.push_back( lcIndex ), lcBelow ++;
+
+            }
+
+            /* Rank shortlist according to descriptors type */
+            switch ( lcQuery.depth() ) {
+
+                case ( CV_8U ) : lc_sketch_rank < unsigned char > ( lcQuery, lcParse, lcTrain, lcList, lcRank ); break;
+                case ( CV_8S ) : lc_sketch_rank < signed char   > ( lcQuery, lcParse, lcTrain, lcList, lcRank ); break;
+                default        : lc_sketch_rank < float         > ( lcQuery, lcParse, lcTrain, lcList, lcRank ); break;
+
+            }
+
+            /* Select nearest candidates */
+            std::partial_sort( lcRank.begin(), lcRank.begin() + std::min( ( size_t ) lcK, lcRank.size() ), lcRank.end() );
+
+            /* Export neighbours */
+            for ( size_t lcIndex( 0 ); lcIndex < std::min( ( size_t ) lcK, lcRank.size() ); lcIndex ++ ) {
+
+                /* Push neighbour */
+                lcMatch[lcParse].push_back( cv::DMatch( lcParse, lcRank[lcIndex].second, std::sqrt( lcRank[lcIndex].first ) ) );
+
+            }
+
+        }
+
+    }
+
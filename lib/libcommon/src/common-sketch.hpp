@@ -0,0 +1,150 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-sketch.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Binary sketches prefiltered search
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_SKETCH__
+    # define __LC_SKETCH__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <vector>
+    # include <algorithm>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define default shortlist size */
+    # define LC_SKETCH_SHORTLIST 32
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Sketch_struct
+     *  \brief Binary sketches structure
+     *
+     *  Structure that stores the binary sketches of a set of descriptors. The
+     *  sketch of a descriptor holds one bit per component, set when the
+     *  component is above the median of its dimension, packed in 64 bits
+     *  words.
+     *
+     *  \var lc_Sketch_struct::words
+     *  Amount of 64 bits words of a sketch
+     *  \var lc_Sketch_struct::median
+     *  Median of each dimension
+     *  \var lc_Sketch_struct::code
+     *  Sketches words, descriptor after descriptor
+     */
+
+    typedef struct lc_Sketch_struct {
+
+        int                      words;
+        std::vector < float    > median;
+        std::vector < uint64_t > code;
+
+    } lc_Sketch_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Binary sketches building
+     *
+     *  This function computes the median of each dimension of the provided
+     *  train descriptors and encodes their binary sketches.
+     *
+     *  \param  lcTrain     Train descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcSketch    Sketches structure
+     */
+
+    void lc_sketch_build ( cv::Mat const & lcTrain, lc_Sketch_t * const lcSketch );
+
+    /*! \brief Prefiltered nearest neighbours search
+     *
+     *  This function searches, for each query descriptor, the nearest train
+     *  descriptors in two stages. The query is encoded against the medians of
+     *  the train descriptors and the hamming distances of its sketch to the
+     *  train sketches, obtained by population counts, give the shortlist of
+     *  the train descriptors of lowest hamming distances. Only the shortlist
+     *  is then ranked according to the exact euclidean distance. Queries are
+     *  searched in parallel.
+     *
+     *  The neighbours of each query are sorted by increasing distance, the
+     *  distances being euclidean and expressed in the units of the
+     *  descriptors components, as with \b lc_brute_knn.
+     *
+     *  \param  lcSketch    Sketches of the train descriptors
+     *  \param  lcTrain     Train descriptors matrix
+     *  \param  lcQuery     Query descriptors matrix, of the train type
+     *  \param  lcShortlist Amount of train descriptors ranked for each query
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     *  \param  lcK         Amount of neighbours
+     */
+
+    void lc_sketch_knn ( lc_Sketch_t const * const lcSketch, cv::Mat const & lcTrain, cv::Mat const & lcQuery, int const lcShortlist, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,450 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-store.hpp"
+
+/*
+    Source - Positioned writing
+ */
+
+    static bool lc_store_write( int const lcHandle, void const * const lcData, size_t const lcSize, uint64_t const lcOffset ) {
+
+        /* Written bytes variables */
+        size_t lcWritten( 0 );
+
+        /* Write requested bytes */
+        while ( lcWritten < lcSize ) {
+
+            /* Write call variables */
+            ssize_t lcCall( pwrite( lcHandle, ( char const * ) lcData + lcWritten, lcSize - lcWritten, lcOffset + lcWritten ) );
+
+            /* Check write call - interrupted calls are repeated */
+            if ( lcCall >= 0 ) lcWritten += lcCall; else if ( errno != EINTR ) return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - File header preparation
+ */
+
+    static bool lc_store_header( int const lcHandle, char const * const lcMagic, char const * const lcLayout, lc_Header_t * const lcHeader ) {
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Retrieve file size */
+        if ( fstat( lcHandle, & lcStat ) != 0 ) return( false );
+
+        /* Check file creation */
+        if ( lcStat.st_size == 0 ) {
+
+            /* Create header */
+            * lcHeader = lc_format_header( lcMagic, lcLayout, 1, 0 );
+
+            /* Export header */
+            return( lc_store_write( lcHandle, lcHeader, sizeof( lc_Header_t ), 0 ) );
+
+        }
+
+        /* Read header */
+        if ( pread( lcHandle, lcHeader, sizeof( lc_Header_t ), 0 ) != sizeof( lc_Header_t ) ) return( false );
+
+        /* Verify header */
+        return( ( strncmp( lcHeader->magic, lcMagic, LC_FORMAT_MAGIC ) == 0 ) && ( strncmp( lcHeader->layout, lcLayout, LC_FORMAT_LAYOUT ) == 0 ) && ( lcHeader->version == LC_FORMAT_VERSION ) );
+
+    }
+
+/*
+    Source - Store image appending
+ */
+
+    bool lc_store_append( char const * const lcPath, uint32_t const lcImage, std::vector < cv::KeyPoint > const & lcKey, cv::Mat const & lcDesc, float const lcScale ) {
+
+        /* Index path variables */
+        std::string lcIndexPath( std::string( lcPath ) + LC_STORE_INDEX );
+
+        /* Entry variables */
+        lc_Image_t lcEntry = { lcKey.size(), ( uint32_t ) lcDesc.cols, lcImage };
+
+        /* Entry layout variables */
+        uint64_t lcRecord( sizeof( lc_Image_t ) );
+        uint64_t lcMatrix( LC_STORE_ALIGNED( lcRecord + lcKey.size() * sizeof( lc_Key_t ) ) );
+
+        /* Descriptors components variables */
+        int    lcMode( lc_quantize_mode( lcDesc.type() ) );
+        size_t lcSize( lcDesc.elemSize() );
+
+        /* Entry buffer variables */
+        std::vector < char > lcBuffer( lcMatrix + lcKey.size() * lcEntry.width * lcSize, 0 );
+
+        /* Headers variables */
+        lc_Header_t lcHeader;
+        lc_Header_t lcIndexHeader;
+
+        /* File status variables */
+        struct stat lcStat;
+
+        /* Descriptors variables */
+        int lcData ( -1 );
+        int lcIndex( -1 );
+
+        /* Appending status variables */
+        bool lcReturn( false );
+
+        /* Check descriptors matrix */
+        if ( ( lcMode < 0 ) || ( ( size_t ) lcDesc.rows != lcKey.size() ) ) return( false );
+
+        /* Compose entry head */
+        memcpy( lcBuffer.data(), & lcEntry, sizeof( lc_Image_t ) );
+
+        /* Compose keypoints records */
+        for ( size_t lcParse( 0 ); lcParse < lcKey.size(); lcParse ++ ) {
+
+            /* Record variables */
+            lc_Key_t lcKeyRecord = { lcKey[lcParse].pt.x, lcKey[lcParse].pt.y, lcKey[lcParse].size, lcKey[lcParse].angle, lcKey[lcParse].response, lcKey[lcParse].octave };
+
+            /* Copy record */
+            memcpy( lcBuffer.data() + lcRecord + lcParse * sizeof( lc_Key_t ), & lcKeyRecord, sizeof( lc_Key_t ) );
+
+        }
+
+        /* Compose descriptors rows */
+        for ( int lcRow( 0 ); lcRow < lcDesc.rows; lcRow ++ ) memcpy( lcBuffer.data() + lcMatrix + lcRow * lcEntry.width * lcSize, lcDesc.ptr < uint8_t > ( lcRow ), lcEntry.width * lcSize );
+
+        /* Open or create data and index files */
+        if ( ( lcData = open( lcPath, O_RDWR | O_CREAT, 0644 ) ) < 0 ) return( false );
+
+        /* Lock store */
+        if ( flock( lcData, LOCK_EX ) == 0 ) {
+
+            /* Open or create index file */
+            if ( ( lcIndex = open( lcIndexPath.c_str(), O_RDWR | O_CREAT, 0644 ) ) >= 0 ) {
+
+                /* Prepare headers and retrieve data size */
+                if ( ( lc_store_header( lcData , LC_STORE_MAGIC , LC_STORE_LAYOUT, & lcHeader      ) == true ) &&
+                     ( lc_store_header( lcIndex, LC_STORE_IMAGIC, LC_STORE_ILAYOU, & lcIndexHeader ) == true ) && ( fstat( lcData, & lcStat ) == 0 ) ) {
+
+                    /* Fix descriptors components on first image */
+                    if ( lcHeader.count == 0 ) lcHeader.flags = lcMode, lcHeader.scale = ( lcMode != LC_QUANTIZE_FLOAT ) ? lcScale : 0.0;
+
+                    /* Entry offset variables */
+                    uint64_t lcOffset( LC_STORE_ALIGNED( ( uint64_t ) lcStat.st_size ) );
+
+                    /* Check descriptors components consistency with the store */
+                    if ( ( lcHeader.flags != ( uint32_t ) lcMode ) || ( ( lcMode != LC_QUANTIZE_FLOAT ) && ( ( lcScale <= 0.0 ) || ( lcHeader.scale != lcScale ) ) ) ) {
+
+                        /* Refuse image */
+                        lcReturn = false;
+
+                    /* Export entry - the index is updated once the entry is complete */
+                    } else if ( ( lcReturn = lc_store_write( lcData, lcBuffer.data(), lcBuffer.size(), lcOffset ) ) == true ) {
+
+                        /* Check index capacity */
+                        if ( lcImage >= lcIndexHeader.count ) {
+
+                            /* Compute enlarged capacity */
+                            lcIndexHeader.count = std::max( std::max( ( uint64_t ) lcImage + 1, lcIndexHeader.count * 2 ), ( uint64_t ) LC_STORE_SLOTS );
+
+                            /* Enlarge index - new slots are zeroed */
+                            lcReturn = ( ftruncate( lcIndex, sizeof( lc_Header_t ) + lcIndexHeader.count * sizeof( uint64_t ) ) == 0 ) && lc_store_write( lcIndex, & lcIndexHeader, sizeof( lc_Header_t ), 0 );
+
+                        }
+
+                        /* Update index slot */
+                        if ( lcReturn == true ) lcReturn = lc_store_write( lcIndex, & lcOffset, sizeof( uint64_t ), sizeof( lc_Header_t ) + lcImage * sizeof( uint64_t ) );
+
+                        /* Update images count */
+                        if ( lcReturn == true ) lcHeader.count ++, lcReturn = lc_store_write( lcData, & lcHeader, sizeof( lc_Header_t ), 0 );
+
+                    }
+
+                }
+
+                /* Close index file */
+                close( lcIndex );
+
+            }
+
+            /* Unlock store */
+            flock( lcData, LOCK_UN );
+
+        }
+
+        /* Close data file */
+        close( lcData );
+
+        /* Return appending status */
+        return( lcReturn );
+
+    }
+
+/*
+    Source - Store opening
+ */
+
+    bool lc_store_open( char const * const lcPath, lc_Store_t * const lcStore ) {
+
+        /* Index path variables */
+        std::string lcIndexPath( std::string( lcPath ) + LC_STORE_INDEX );
+
+        /* Reset data mapping */
+        lcStore->data.handle = -1;
+        lcStore->data.size   = 0;
+        lcStore->data.data   = NULL;
+
+        /* Map index file - mapped first, its slots only refer to complete entries */
+        if ( lc_map_open( lcIndexPath.c_str(), & lcStore->index ) == false ) return( false );
+
+        /* Verify index header and map data file */
+        if ( ( lc_format_check( & lcStore->index, LC_STORE_IMAGIC, LC_STORE_ILAYOU ) == NULL ) || ( lc_map_open( lcPath, & lcStore->data ) == false ) ) {
+
+            /* Release mappings */
+            lc_store_close( lcStore );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Verify data header */
+        if ( lc_format_check( & lcStore->data, LC_STORE_MAGIC, LC_STORE_LAYOUT ) == NULL ) {
+
+            /* Release mappings */
+            lc_store_close( lcStore );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Advise random access - images are read by identifier */
+        madvise( lcStore->data.data, lcStore->data.size, MADV_RANDOM );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Store closure
+ */
+
+    void lc_store_close( lc_Store_t * const lcStore ) {
+
+        /* Release mappings */
+        lc_map_close( & lcStore->data  );
+        lc_map_close( & lcStore->index );
+
+    }
+
+/*
+    Source - Store image reading
+ */
+
+    bool lc_store_read( lc_Store_t const * const lcStore, uint32_t const lcImage, std::vector < cv::KeyPoint > & lcKey, cv::Mat & lcDesc ) {
+
+        /* Index slots variables */
+        uint64_t const * lcSlot( ( uint64_t const * ) ( lcStore->index.data + sizeof( lc_Header_t ) ) );
+
+        /* Entry variables */
+        lc_Image_t const * lcEntry( NULL );
+
+        /* Entry layout variables */
+        uint64_t lcOffset( 0 );
+        uint64_t lcMatrix( 0 );
+
+        /* Records pointer variables */
+        lc_Key_t const * lcRecord( NULL );
+
+        /* Descriptors components variables */
+        int lcType( lc_quantize_type( ( ( lc_Header_t const * ) lcStore->data.data )->flags ) );
+
+        /* Reset outputs */
+        lcKey.clear(); lcDesc = cv::Mat();
+
+        /* Check components type and index slot */
+        if ( lcType < 0 ) return( false );
+
+        /* Check index slot */
+        if ( lcImage >= ( lcStore->index.size - sizeof( lc_Header_t ) ) / sizeof( uint64_t ) ) return( false );
+
+        /* Check entry offset */
+        if ( ( ( lcOffset = lcSlot[lcImage] ) == 0 ) || ( lcOffset + sizeof( lc_Image_t ) > lcStore->data.size ) ) return( false );
+
+        /* Assign entry pointer */
+        lcEntry = ( lc_Image_t const * ) ( lcStore->data.data + lcOffset );
+
+        /* Compute descriptors offset */
+        lcMatrix = LC_STORE_ALIGNED( lcOffset + sizeof( lc_Image_t ) + lcEntry->count * sizeof( lc_Key_t ) );
+
+        /* Check entry consistency */
+        if ( ( lcEntry->image != lcImage ) || ( lcMatrix + lcEntry->count * lcEntry->width * ( lcType == CV_32FC1 ? sizeof( float ) : sizeof( uint8_t ) ) > lcStore->data.size ) ) return( false );
+
+        /* Assign records pointer */
+        lcRecord = ( lc_Key_t const * ) ( lcEntry + 1 );
+
+        /* Allocate keypoints array */
+        lcKey.resize( lcEntry->count );
+
+        /* Convert records to keypoints */
+        for ( size_t lcIndex( 0 ); lcIndex < lcKey.size(); lcIndex ++ ) {
+
+            /* Assign keypoint parameters */
+            lcKey[lcIndex] = cv::KeyPoint( cv::Point2f( lcRecord[lcIndex].x, lcRecord[lcIndex].y ), lcRecord[lcIndex].size, lcRecord[lcIndex].angle, lcRecord[lcIndex].response, lcRecord[lcIndex].octave );
+
+        }
+
+        /* Assign matrix header on mapped rows */
+        lcDesc = cv::Mat( lcEntry->count, lcEntry->width, lcType, lcStore->data.data + lcMatrix );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Store quantization scale
+ */
+
+    float lc_store_scale( lc_Store_t const * const lcStore ) {
+
+        /* Return data header scale */
+        return( ( ( lc_Header_t const * ) lcStore->data.data )->scale );
+
+    }
+
+/*
+    Source - Store index capacity
+ */
+
+    uint32_t lc_store_slots( lc_Store_t const * const lcStore ) {
+
+        /* Return amount of index slots */
+        return( ( lcStore->index.size - sizeof( lc_Header_t ) ) / sizeof( uint64_t ) );
+
+    }
+
+/*
+    Source - Store floating point descriptors
+ */
+
+    void lc_store_float( lc_Store_t const * const lcStore, cv::Mat const & lcDesc, cv::Mat & lcFloat ) {
+
+        /* Convert quantized descriptors */
+        if ( lcDesc.type() == CV_32FC1 ) lcFloat = lcDesc; else lcDesc.convertTo( lcFloat, CV_32FC1, 1.0 / lc_store_scale( lcStore ) );
+
+    }
+
+/*
+    Source - Store descriptors sampling
+ */
+
+    bool lc_store_sample( lc_Store_t const * const lcStore, uint64_t const lcCount, cv::Mat & lcSample, uint64_t * const lcTotal ) {
+
+        /* Store variables */
+        uint32_t lcSlots( lc_store_slots( lcStore ) );
+
+        /* Image variables */
+        std::vector < cv::KeyPoint > lcKey;
+        cv::Mat lcDesc;
+        cv::Mat lcFloat;
+
+        /* Dimensions variables */
+        uint64_t lcSize  ( 0 );
+        uint64_t lcGlobal( 0 );
+        int      lcWidth ( -1 );
+
+        /* Reset descriptors count */
+        ( * lcTotal ) = 0;
+
+        /* Count descriptors and verify their size */
+        for ( uint32_t lcImage( 0 ); lcImage < lcSlots; lcImage ++ ) {
+
+            /* Read image descriptors */
+            if ( ( lc_store_read( lcStore, lcImage, lcKey, lcDesc ) == false ) || ( lcDesc.rows == 0 ) ) continue;
+
+            /* Verify descriptors size */
+            if ( ( lcWidth >= 0 ) && ( lcDesc.cols != lcWidth ) ) return( false );
+
+            /* Update dimensions */
+            lcWidth = lcDesc.cols, ( * lcTotal ) += lcDesc.rows;
+
+        }
+
+        /* Check descriptors */
+        if ( ( * lcTotal ) == 0 ) return( false );
+
+        /* Compute sample size */
+        lcSize = std::min( lcCount, * lcTotal );
+
+        /* Create sample matrix */
+        lcSample.create( lcSize, lcWidth, CV_32FC1 );
+
+        /* Compose sample */
+        for ( uint32_t lcImage( 0 ), lcRow( 0 ); lcImage < lcSlots; lcImage ++ ) {
+
+            /* Read image descriptors */
+            if ( lc_store_read( lcStore, lcImage, lcKey, lcDesc ) == false ) continue;
+
+            /* Convert descriptors */
+            lc_store_float( lcStore, lcDesc, lcFloat );
+
+            /* Select descriptors */
+            for ( int lcParse( 0 ); lcParse < lcFloat.rows; lcParse ++, lcGlobal ++ ) {
+
+                /* Copy selected descriptor */
+                if ( ( lcGlobal * lcSize ) / ( * lcTotal ) != ( ( lcGlobal + 1 ) * lcSize ) / ( * lcTotal ) ) memcpy( lcSample.ptr < float > ( lcRow ++ ), lcFloat.ptr < float > ( lcParse ), lcWidth * sizeof( float ) );
+
+            }
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
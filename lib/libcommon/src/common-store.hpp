@@ -0,0 +1,282 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-store.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Dataset features store
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_STORE__
+    # define __LC_STORE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <string>
+    # include <cerrno>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-keyfile.hpp"
+    # include "common-quantize.hpp"
+    # include <stdint.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <sys/file.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define store files format */
+    # define LC_STORE_MAGIC     "FSFEASTO"
+    # define LC_STORE_LAYOUT    "fffffi"
+    # define LC_STORE_IMAGIC    "FSFEAIDX"
+    # define LC_STORE_ILAYOU    "ii"
+
+    /* Define index files extension */
+    # define LC_STORE_INDEX     ".idx"
+
+    /* Define entries alignment */
+    # define LC_STORE_ALIGN     64
+
+    /* Define minimal index capacity */
+    # define LC_STORE_SLOTS     1024
+
+/* 
+    Header - Preprocessor macros
+ */
+
+    /* Align offset on entries alignment */
+    # define LC_STORE_ALIGNED(o) ( ( ( o ) + LC_STORE_ALIGN - 1 ) & ~ ( uint64_t ) ( LC_STORE_ALIGN - 1 ) )
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Image_struct
+     *  \brief Store entry structure
+     *
+     *  Structure that starts each entry of the store data file. It is followed
+     *  by the keypoints records and, on the next aligned offset, by the rows of
+     *  the descriptors matrix. Entries start on aligned offsets.
+     *
+     *  \var lc_Image_struct::count
+     *  Amount of keypoints of the image
+     *  \var lc_Image_struct::width
+     *  Amount of components of the descriptors
+     *  \var lc_Image_struct::image
+     *  Identifier of the image
+     */
+
+    typedef struct lc_Image_struct {
+
+        uint64_t count;
+        uint32_t width;
+        uint32_t image;
+
+    } lc_Image_t;
+
+    /*! \struct lc_Store_struct
+     *  \brief Store structure
+     *
+     *  Structure that stores the mappings of an opened features store. The
+     *  store is made of an append-only data file, holding the keypoints and
+     *  descriptors of all the images of a dataset, and of an index file that
+     *  associates each image identifier to the offset of its entry. Both files
+     *  are mapped read-only and shared, so that concurrent processes use a
+     *  single copy of the store in the system cache.
+     *
+     *  \var lc_Store_struct::data
+     *  Mapping of the data file
+     *  \var lc_Store_struct::index
+     *  Mapping of the index file
+     */
+
+    typedef struct lc_Store_struct {
+
+        lc_Map_t data;
+        lc_Map_t index;
+
+    } lc_Store_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Store image appending
+     *
+     *  This function appends the keypoints and descriptors of an image to the
+     *  specified store, creating it if required. The store is exclusively
+     *  locked during the operation so that concurrent detection processes can
+     *  feed the same store. Appending an image identifier already present
+     *  supersedes its previous entry.
+     *
+     *  The components mode and the quantization scale of the descriptors are
+     *  fixed by the first appended image, being stored in the data file header
+     *  flags and scale. Images with different components or scale are refused.
+     *
+     *  \param  lcPath      Path of the store data file
+     *  \param  lcImage     Identifier of the image
+     *  \param  lcKey       Keypoints of the image
+     *  \param  lcDesc      Descriptors matrix (CV_32F, CV_8U or CV_8S), one row
+     *                      per keypoint
+     *  \param  lcScale     Quantization scale, ignored for CV_32F matrix
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_store_append ( char const * const lcPath, uint32_t const lcImage, std::vector < cv::KeyPoint > const & lcKey, cv::Mat const & lcDesc, float const lcScale );
+
+    /*! \brief Store opening
+     *
+     *  This function maps the index and data files of the specified store and
+     *  verifies their headers against the store formats. Images appended after
+     *  the opening are not visible through the store structure.
+     *
+     *  \param  lcPath      Path of the store data file
+     *  \param  lcStore     Store structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_store_open ( char const * const lcPath, lc_Store_t * const lcStore );
+
+    /*! \brief Store closure
+     *
+     *  This function releases the mappings of the store.
+     *
+     *  \param  lcStore     Store structure
+     */
+
+    void lc_store_close ( lc_Store_t * const lcStore );
+
+    /*! \brief Store image reading
+     *
+     *  This function retrieves the keypoints and descriptors of the specified
+     *  image. The keypoints are converted while the descriptors matrix points
+     *  to the mapped rows : it has to be considered as read-only and is valid
+     *  as long as the store is opened.
+     *
+     *  \param  lcStore     Store structure
+     *  \param  lcImage     Identifier of the image
+     *  \param  lcKey       Array receiving the keypoints
+     *  \param  lcDesc      Matrix receiving the descriptors
+     *
+     *  \return Returns true if the image is found, false otherwise
+     */
+
+    bool lc_store_read ( lc_Store_t const * const lcStore, uint32_t const lcImage, std::vector < cv::KeyPoint > & lcKey, cv::Mat & lcDesc );
+
+    /*! \brief Store quantization scale
+     *
+     *  This function returns the quantization scale of the descriptors of the
+     *  store.
+     *
+     *  \param  lcStore     Store structure
+     *
+     *  \return Returns the quantization scale, zero for floating point
+     *  descriptors
+     */
+
+    float lc_store_scale ( lc_Store_t const * const lcStore );
+
+    /*! \brief Store index capacity
+     *
+     *  This function returns the amount of slots of the store index. Every
+     *  image identifier of the store is lower than this amount, allowing the
+     *  images of the store to be enumerated using \b lc_store_read.
+     *
+     *  \param  lcStore     Store structure
+     *
+     *  \return Returns the amount of index slots
+     */
+
+    uint32_t lc_store_slots ( lc_Store_t const * const lcStore );
+
+    /*! \brief Store floating point descriptors
+     *
+     *  This function provides the floating point form of descriptors read from
+     *  the store. Quantized descriptors are converted using the store scale,
+     *  floating point ones are left as is, sharing the mapped rows.
+     *
+     *  \param  lcStore     Store structure
+     *  \param  lcDesc      Descriptors matrix read from the store
+     *  \param  lcFloat     Matrix receiving the floating point descriptors
+     */
+
+    void lc_store_float ( lc_Store_t const * const lcStore, cv::Mat const & lcDesc, cv::Mat & lcFloat );
+
+    /*! \brief Store descriptors sampling
+     *
+     *  This function composes a training sample of the floating point
+     *  descriptors of the store. Descriptors are taken with a regular stride
+     *  over all the images, so that each image contributes in proportion to
+     *  its amount of descriptors. All the descriptors are taken if the store
+     *  holds less than the requested amount.
+     *
+     *  \param  lcStore     Store structure
+     *  \param  lcCount     Maximum amount of sampled descriptors
+     *  \param  lcSample    Matrix receiving the sampled descriptors (CV_32F)
+     *  \param  lcTotal     Receives the amount of descriptors of the store
+     *
+     *  \return Returns true on success, false if the store holds no
+     *  descriptors or descriptors of different sizes
+     */
+
+    bool lc_store_sample ( lc_Store_t const * const lcStore, uint64_t const lcCount, cv::Mat & lcSample, uint64_t * const lcTotal );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
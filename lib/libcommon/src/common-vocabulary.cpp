@@ -0,0 +1,434 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-vocabulary.hpp"
+
+/*
+    Source - Level offset
+ */
+
+    static uint64_t lc_vocabulary_level( int const lcBranch, int const lcLevel ) {
+
+        /* Offset variables */
+        uint64_t lcOffset( 0 );
+        uint64_t lcWidth ( 1 );
+
+        /* Accumulate sizes of the previous levels */
+        for ( int lcParse( 1 ); lcParse < lcLevel; lcParse ++ ) lcOffset += ( lcWidth *= lcBranch );
+
+        /* Return level offset */
+        return( lcOffset );
+
+    }
+
+/*
+    Source - Node splitting
+ */
+
+    static void lc_vocabulary_split( cv::Mat const & lcData, float const * const lcParent, int const lcLevel, uint64_t const lcIndex, lc_Vocabulary_t * const lcVocabulary ) {
+
+        /* Tree variables */
+        int lcBranch( lcVocabulary->branch );
+        int lcWidth ( lcVocabulary->node.cols );
+
+        /* Children offset variables */
+        uint64_t lcFirst( lc_vocabulary_level( lcBranch, lcLevel ) + lcIndex * lcBranch );
+
+        /* Clustering variables */
+        cv::Mat lcCenter;
+        std::vector < int > lcLabel;
+
+        /* Cluster node descriptors */
+        if ( lcData.rows > 0 ) lc_kmeans( lcData, lcBranch, LC_KMEANS_ITERATION, lcCenter, & lcLabel );
+
+        /* Assign children centers */
+        for ( int lcChild( 0 ); lcChild < lcBranch; lcChild ++ ) {
+
+            /* Center source variables - missing children repeat a center, never selected */
+            float const * lcSource( lcCenter.rows == 0 ? lcParent : lcCenter.ptr < float > ( std::min( lcChild, lcCenter.rows - 1 ) ) );
+
+            /* Copy child center */
+            memcpy( lcVocabulary->node.ptr < float > ( lcFirst + lcChild ), lcSource, lcWidth * sizeof( float ) );
+
+        }
+
+        /* Check tree depth */
+        if ( lcLevel >= lcVocabulary->depth ) return;
+
+        /* Split children */
+        for ( int lcChild( 0 ); lcChild < lcBranch; lcChild ++ ) {
+
+            /* Child descriptors variables */
+            cv::Mat lcChildData( std::count( lcLabel.begin(), lcLabel.end(), lcChild ), lcWidth, CV_32FC1 );
+
+            /* Gather child descriptors */
+            for ( int lcParse( 0 ), lcRow( 0 ); lcParse < lcData.rows; lcParse ++ ) {
+
+                /* Copy descriptor */
+                if ( lcLabel[lcParse] == lcChild ) memcpy( lcChildData.ptr < float > ( lcRow ++ ), lcData.ptr < float > ( lcParse ), lcWidth * sizeof( float ) );
+
+            }
+
+            /* Split child */
+            lc_vocabulary_split( lcChildData, lcVocabulary->node.ptr < float > ( lcFirst + lcChild ), lcLevel + 1, lcIndex * lcBranch + lcChild, lcVocabulary );
+
+        }
+
+    }
+
+/*
+    Source - Vocabulary tree training
+ */
+
+    bool lc_vocabulary_train( cv::Mat const & lcSample, int const lcBranch, int const lcDepth, lc_Vocabulary_t * const lcVocabulary ) {
+
+        /* Check training descriptors and tree shape */
+        if ( ( lcSample.rows == 0 ) || ( lcBranch < 2 ) || ( lcBranch > 0xFFFF ) || ( lcDepth < 1 ) || ( std::pow( ( double ) lcBranch, lcDepth ) > UINT32_MAX ) ) return( false );
+
+        /* Assign tree shape */
+        lcVocabulary->branch = lcBranch;
+        lcVocabulary->depth  = lcDepth;
+
+        /* Create nodes matrix */
+        lcVocabulary->node.create( lc_vocabulary_level( lcBranch, lcDepth + 1 ), lcSample.cols, CV_32FC1 );
+
+        /* Split tree root */
+        lc_vocabulary_split( lcSample, NULL, 1, 0, lcVocabulary );
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Vocabulary size
+ */
+
+    uint32_t lc_vocabulary_words( lc_Vocabulary_t const * const lcVocabulary ) {
+
+        /* Return amount of leaves */
+        return( lc_vocabulary_level( lcVocabulary->branch, lcVocabulary->depth + 1 ) - lc_vocabulary_level( lcVocabulary->branch, lcVocabulary->depth ) );
+
+    }
+
+/*
+    Source - Descriptors quantization on visual words
+ */
+
+    void lc_vocabulary_quantize( lc_Vocabulary_t const * const lcVocabulary, cv::Mat const & lcDesc, std::vector < uint32_t > & lcWord ) {
+
+        /* Tree variables */
+        int lcBranch( lcVocabulary->branch );
+        int lcWidth ( lcVocabulary->node.cols );
+
+        /* Allocate words array */
+        lcWord.resize( lcDesc.rows );
+
+        /* Process descriptors */
+        # ifdef __OPENMP__
+        # pragma omp parallel for
+        # endif
+        for ( int lcParse = 0; lcParse < lcDesc.rows; lcParse ++ ) {
+
+            /* Descriptor pointer variables */
+            float const * lcRow( lcDesc.ptr < float > ( lcParse ) );
+
+            /* Descent variables */
+            uint64_t lcIndex( 0 );
+
+            /* Descend tree levels */
+            for ( int lcLevel( 1 ); lcLevel <= lcVocabulary->depth; lcLevel ++ ) {
+
+                /* Children offset variables */
+                uint64_t lcFirst( lc_vocabulary_level( lcBranch, lcLevel ) + lcIndex * lcBranch );
+
+                /* Selection variables */
+                float lcBest( HUGE_VALF );
+                int   lcNear( 0 );
+
+                /* Search nearest child */
+                for ( int lcChild( 0 ); lcChild < lcBranch; lcChild ++ ) {
+
+                    /* Center pointer variables */
+                    float const * lcCenter( lcVocabulary->node.ptr < float > ( lcFirst + lcChild ) );
+
+                    /* Distance variables */
+                    float lcDist( 0.0 );
+
+                    /* Accumulate squared differences */
+                    for ( int lcComp( 0 ); lcComp < lcWidth; lcComp ++ ) lcDist += ( lcRow[lcComp] - lcCenter[lcComp] ) * ( lcRow[lcComp] - lcCenter[lcComp] );
+
+                    /* Update nearest child */
+                    if ( lcDist < lcBest ) lcBest = lcDist, lcNear = lcChild;
+
+                }
+
+                /* Descend on nearest child */
+                lcIndex = lcIndex * lcBranch + lcNear;
+
+            }
+
+            /* Assign visual word */
+            lcWord[lcParse] = lcIndex;
+
+        }
+
+    }
+
+/*
+    Source - Vocabulary exportation
+ */
+
+    bool lc_vocabulary_write( char const * const lcPath, lc_Vocabulary_t const * const lcVocabulary ) {
+
+        /* Header variables */
+        lc_Header_t lcHeader( lc_format_header( LC_VOCABULARY_MAGIC, LC_VOCABULARY_LAYOUT, lcVocabulary->node.cols, lcVocabulary->node.rows ) );
+
+        /* Writer variables */
+        lc_Writer_t lcWriter;
+
+        /* Assign tree shape */
+        lcHeader.flags = ( lcVocabulary->depth << 16 ) | lcVocabulary->branch;
+
+        /* Create vocabulary file */
+        if ( lc_writer_open( lcPath, & lcWriter ) == false ) return( false );
+
+        /* Write header */
+        lc_writer_raw( & lcWriter, & lcHeader, sizeof( lc_Header_t ) );
+
+        /* Write nodes centers */
+        for ( int lcParse( 0 ); lcParse < lcVocabulary->node.rows; lcParse ++ ) lc_writer_raw( & lcWriter, lcVocabulary->node.ptr < float > ( lcParse ), lcHeader.size );
+
+        /* Close vocabulary file */
+        return( lc_writer_close( & lcWriter ) );
+
+    }
+
+/*
+    Source - Vocabulary importation
+ */
+
+    bool lc_vocabulary_read( char const * const lcPath, lc_Vocabulary_t * const lcVocabulary ) {
+
+        /* Mapping variables */
+        lc_Map_t lcMap;
+
+        /* Header pointer variables */
+        lc_Header_t const * lcHeader( NULL );
+
+        /* Reading status variables */
+        bool lcRead( false );
+
+        /* Map vocabulary file */
+        if ( lc_map_open( lcPath, & lcMap ) == false ) return( false );
+
+        /* Verify header */
+        if ( ( lcHeader = lc_format_check( & lcMap, LC_VOCABULARY_MAGIC, LC_VOCABULARY_LAYOUT ) ) != NULL ) {
+
+            /* Assign tree shape */
+            lcVocabulary->branch = lcHeader->flags & 0xFFFF;
+            lcVocabulary->depth  = lcHeader->flags >> 16;
+
+            /* Verify tree shape against nodes count */
+            if ( ( lcVocabulary->branch >= 2 ) && ( lcVocabulary->depth >= 1 ) && ( lcVocabulary->depth <= 32 ) && ( lc_vocabulary_level( lcVocabulary->branch, lcVocabulary->depth + 1 ) == lcHeader->count ) ) {
+
+                /* Copy nodes centers - the mapping is released */
+                lcVocabulary->node = cv::Mat( lcHeader->count, lcHeader->width, CV_32FC1, LC_FORMAT_DATA( lcMap ) ).clone();
+
+                /* Update reading status */
+                lcRead = true;
+
+            }
+
+        }
+
+        /* Unmap vocabulary file */
+        lc_map_close( & lcMap );
+
+        /* Send message */
+        return( lcRead );
+
+    }
+
+/*
+    Source - Images similarity ranking
+ */
+
+    void lc_vocabulary_rank( std::vector < std::vector < uint32_t > > const & lcWord, uint32_t const lcWords, int const lcK, std::vector < std::vector < std::pair < float, int > > > & lcRank ) {
+
+        /* Images variables */
+        int lcImages( lcWord.size() );
+
+        /* Images vectors variables - visual word and weight */
+        std::vector < std::vector < std::pair < uint32_t, float > > > lcVector( lcImages );
+
+        /* Inverted file variables - image and weight */
+        std::vector < uint64_t > lcOffset( lcWords + 1, 0 );
+        std::vector < std::pair < int, float > > lcPosting;
+
+        /* Reset ranking array */
+        lcRank.assign( lcImages, std::vector < std::pair < float, int > > () );
+
+        /* Compute terms frequencies */
+        for ( int lcImage( 0 ); lcImage < lcImages; lcImage ++ ) {
+
+            /* Sorted words variables */
+            std::vector < uint32_t > lcSorted( lcWord[lcImage] );
+
+            /* Sort image words */
+            std::sort( lcSorted.begin(), lcSorted.end() );
+
+            /* Count words occurrences */
+            for ( size_t lcParse( 0 ); lcParse < lcSorted.size(); lcParse ++ ) {
+
+                /* Check word boundary */
+                if ( ( lcParse == 0 ) || ( lcSorted[lcParse] != lcSorted[lcParse - 1] ) ) {
+
+                    /* Push word */
+                    lcVector[lcImage].push_back( std::make_pair( lcSorted[lcParse], 0.0f ) );
+
+                    /* Update documents frequency */
+                    lcOffset[lcSorted[lcParse] + 1] ++;
+
+                }
+
+                /* Update term frequency */
+                lcVector[lcImage].back().second += 1.0 / lcSorted.size();
+
+            }
+
+        }
+
+        /* Weight and normalize images vectors */
+        for ( int lcImage( 0 ); lcImage < lcImages; lcImage ++ ) {
+
+            /* Norm variables */
+            double lcNorm( 0.0 );
+
+            /* Weight terms frequencies by inverse documents frequencies */
+            for ( size_t lcParse( 0 ); lcParse < lcVector[lcImage].size(); lcParse ++ ) {
+
+                /* Compute term weight */
+                lcVector[lcImage][lcParse].second *= std::log( ( double ) lcImages / lcOffset[lcVector[lcImage][lcParse].first + 1] );
+
+                /* Accumulate squared norm */
+                lcNorm += lcVector[lcImage][lcParse].second * lcVector[lcImage][lcParse].second;
+
+            }
+
+            /* Normalize vector */
+            if ( lcNorm > 0.0 ) for ( size_t lcParse( 0 ); lcParse < lcVector[lcImage].size(); lcParse ++ ) lcVector[lcImage][lcParse].second /= std::sqrt( lcNorm );
+
+        }
+
+        /* Compute inverted lists offsets */
+        for ( uint32_t lcParse( 0 ); lcParse < lcWords; lcParse ++ ) lcOffset[lcParse + 1] += lcOffset[lcParse];
+
+        /* Allocate postings */
+        lcPosting.resize( lcOffset[lcWords] );
+
+        /* Fill inverted lists - offsets are shifted back by the filling */
+        for ( int lcImage( 0 ); lcImage < lcImages; lcImage ++ ) {
+
+            /* Push image postings */
+            for ( size_t lcParse( 0 ); lcParse < lcVector[lcImage].size(); lcParse ++ ) lcPosting[lcOffset[lcVector[lcImage][lcParse].first] ++] = std::make_pair( lcImage, lcVector[lcImage][lcParse].second );
+
+        }
+
+        /* Restore inverted lists offsets */
+        for ( uint32_t lcParse( lcWords ); lcParse > 0; lcParse -- ) lcOffset[lcParse] = lcOffset[lcParse - 1];
+
+        /* Restore first list offset */
+        lcOffset[0] = 0;
+
+        /* Rank images */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic )
+        # endif
+        for ( int lcImage = 0; lcImage < lcImages; lcImage ++ ) {
+
+            /* Similarity accumulation variables */
+            std::vector < float > lcScore( lcImages, 0.0 );
+            std::vector < char  > lcSeen ( lcImages, 0 );
+            std::vector < int   > lcTouch;
+
+            /* Candidates variables */
+            std::vector < std::pair < float, int > > lcCandidate;
+
+            /* Accumulate similarities through inverted lists */
+            for ( size_t lcParse( 0 ); lcParse < lcVector[lcImage].size(); lcParse ++ ) {
+
+                /* Word variables */
+                uint32_t lcTerm( lcVector[lcImage][lcParse].first );
+
+                /* Visit word postings */
+                for ( uint64_t lcPost( lcOffset[lcTerm] ); lcPost < lcOffset[lcTerm + 1]; lcPost ++ ) {
+
+                    /* Posting image variables */
+                    int lcOther( lcPosting[lcPost].first );
+
+                    /* Discard image itself */
+                    if ( lcOther == lcImage ) continue;
+
+                    /* Register touched image */
+                    if ( lcSeen[lcOther] == 0 ) lcSeen[lcOther] = 1, lcTouch.push_back( lcOther );
+
+                    /* Accumulate similarity */
+                    lcScore[lcOther] += lcVector[lcImage][lcParse].second * lcPosting[lcPost].second;
+
+                }
+
+            }
+
+            /* Compose candidates - negated similarities sort by decreasing similarity */
+            for ( size_t lcParse( 0 ); lcParse < lcTouch.size(); lcParse ++ ) lcCandidate.push_back( std::make_pair( - lcScore[lcTouch[lcParse]], lcTouch[lcParse] ) );
+
+            /* Select most similar images */
+            std::partial_sort( lcCandidate.begin(), lcCandidate.begin() + std::min( ( size_t ) lcK, lcCandidate.size() ), lcCandidate.end() );
+
+            /* Export ranking */
+            for ( int lcParse( 0 ); ( lcParse < lcK ) && ( lcParse < ( int ) lcCandidate.size() ); lcParse ++ ) lcRank[lcImage].push_back( std::make_pair( - lcCandidate[lcParse].first, lcCandidate[lcParse].second ) );
+
+        }
+
+    }
+
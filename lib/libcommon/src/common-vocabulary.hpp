@@ -0,0 +1,223 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-vocabulary.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Vocabulary tree image retrieval
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_VOCABULARY__
+    # define __LC_VOCABULARY__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <vector>
+    # include <cstring>
+    # include <utility>
+    # include <algorithm>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include "common-format.hpp"
+    # include "common-mapping.hpp"
+    # include "common-writer.hpp"
+    # include "common-kmeans.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define vocabulary file format */
+    # define LC_VOCABULARY_MAGIC    "FSVOCTRE"
+    # define LC_VOCABULARY_LAYOUT   "f"
+
+    /* Define default tree branching factor */
+    # define LC_VOCABULARY_BRANCH   10
+
+    /* Define default tree depth */
+    # define LC_VOCABULARY_DEPTH    5
+
+    /* Define default training sample size */
+    # define LC_VOCABULARY_SAMPLE   262144
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Vocabulary_struct
+     *  \brief Vocabulary tree structure
+     *
+     *  Structure that stores a hierarchical k-means vocabulary tree. The tree
+     *  is complete : each node has exactly branch children and the leaves,
+     *  found at the depth level, are the visual words. The centers of the
+     *  nodes are stored level by level, the root excepted, the children of
+     *  the node of index i in its level being found at indexes i * branch + c
+     *  in the next level.
+     *
+     *  \var lc_Vocabulary_struct::branch
+     *  Branching factor of the tree
+     *  \var lc_Vocabulary_struct::depth
+     *  Amount of levels of the tree, the root excepted
+     *  \var lc_Vocabulary_struct::node
+     *  Matrix of the nodes centers, one row per node
+     */
+
+    typedef struct lc_Vocabulary_struct {
+
+        int     branch;
+        int     depth;
+        cv::Mat node;
+
+    } lc_Vocabulary_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Vocabulary tree training
+     *
+     *  This function builds the vocabulary tree of the provided descriptors.
+     *  The descriptors are clustered in branch centers, the descriptors of
+     *  each center being recursively clustered until the requested depth.
+     *  Nodes without enough descriptors are completed by copies of their
+     *  parent or siblings centers, which are never selected.
+     *
+     *  \param  lcSample    Training descriptors matrix (CV_32F)
+     *  \param  lcBranch    Branching factor of the tree
+     *  \param  lcDepth     Depth of the tree
+     *  \param  lcVocabulary Vocabulary structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_vocabulary_train ( cv::Mat const & lcSample, int const lcBranch, int const lcDepth, lc_Vocabulary_t * const lcVocabulary );
+
+    /*! \brief Vocabulary size
+     *
+     *  This function returns the amount of visual words of the vocabulary,
+     *  that is the amount of leaves of the tree.
+     *
+     *  \param  lcVocabulary Vocabulary structure
+     *
+     *  \return Returns the amount of visual words
+     */
+
+    uint32_t lc_vocabulary_words ( lc_Vocabulary_t const * const lcVocabulary );
+
+    /*! \brief Descriptors quantization on visual words
+     *
+     *  This function assigns each descriptor to a visual word by descending
+     *  the tree, the nearest child being selected at each level. Descriptors
+     *  are processed in parallel.
+     *
+     *  \param  lcVocabulary Vocabulary structure
+     *  \param  lcDesc      Descriptors matrix (CV_32F)
+     *  \param  lcWord      Array receiving the visual word of each descriptor
+     */
+
+    void lc_vocabulary_quantize ( lc_Vocabulary_t const * const lcVocabulary, cv::Mat const & lcDesc, std::vector < uint32_t > & lcWord );
+
+    /*! \brief Vocabulary exportation
+     *
+     *  This function writes the vocabulary tree in the specified file. The
+     *  header flags store the branching factor, in the low 16 bits, and the
+     *  depth of the tree.
+     *
+     *  \param  lcPath      Path of the vocabulary file
+     *  \param  lcVocabulary Vocabulary structure
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_vocabulary_write ( char const * const lcPath, lc_Vocabulary_t const * const lcVocabulary );
+
+    /*! \brief Vocabulary importation
+     *
+     *  This function reads the vocabulary tree stored in the specified file.
+     *
+     *  \param  lcPath      Path of the vocabulary file
+     *  \param  lcVocabulary Vocabulary structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_vocabulary_read ( char const * const lcPath, lc_Vocabulary_t * const lcVocabulary );
+
+    /*! \brief Images similarity ranking
+     *
+     *  This function ranks, for each image, the most similar other images.
+     *  Each image is described by the TF-IDF vector of its visual words : the
+     *  frequency of a word in the image is weighted by the logarithm of the
+     *  inverse of the fraction of images containing it, and the vector is
+     *  normalized. The vectors are stored in an inverted file, so that the
+     *  cosine similarity of an image with all the others is accumulated by
+     *  visiting only the images that share at least one word with it. Images
+     *  are processed in parallel.
+     *
+     *  \param  lcWord      Array of the visual words of each image
+     *  \param  lcWords     Amount of visual words of the vocabulary
+     *  \param  lcK         Amount of similar images per image
+     *  \param  lcRank      Array receiving, for each image, the similarity and
+     *                      index of its most similar images, by decreasing
+     *                      similarity
+     */
+
+    void lc_vocabulary_rank ( std::vector < std::vector < uint32_t > > const & lcWord, uint32_t const lcWords, int const lcK, std::vector < std::vector < std::pair < float, int > > > & lcRank );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
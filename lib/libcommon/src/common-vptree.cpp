@@ -0,0 +1,296 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-vptree.hpp"
+
+/*
+    Source - Partial squared distance
+ */
+
+    static inline float lc_vptree_distance( float const * const lcA, float const * const lcB, int const lcDimension, float const lcBound ) {
+
+        /* Accumulation variables */
+        float lcSum( 0.0 );
+
+        /* Component variables */
+        int lcParse( 0 );
+
+        /* Accumulate components by blocks */
+        while ( lcParse < lcDimension ) {
+
+            /* Block end variables */
+            int lcEnd( std::min( lcParse + LC_VPTREE_BLOCK, lcDimension ) );
+
+            /* Accumulate block components */
+            for ( ; lcParse < lcEnd; lcParse ++ ) lcSum += ( lcA[lcParse] - lcB[lcParse] ) * ( lcA[lcParse] - lcB[lcParse] );
+
+            /* Abandon distance beyond bound */
+            if ( lcSum >= lcBound ) return( lcSum );
+
+        }
+
+        /* Return squared distance */
+        return( lcSum );
+
+    }
+
+/*
+    Source - Neighbours insertion
+ */
+
+    static inline void lc_vptree_insert( float const lcScore, uint32_t const lcRow, float * const lcBest, int64_t * const lcNear, int const lcK ) {
+
+        /* Insertion position variables */
+        int lcPosition( lcK - 1 );
+
+        /* Check neighbour candidate */
+        if ( lcScore >= lcBest[lcK - 1] ) return;
+
+        /* Shift farther neighbours */
+        while ( ( lcPosition > 0 ) && ( lcScore < lcBest[lcPosition - 1] ) ) {
+
+            /* Shift neighbour */
+            lcBest[lcPosition] = lcBest[lcPosition - 1];
+            lcNear[lcPosition] = lcNear[lcPosition - 1];
+
+            /* Update position */
+            lcPosition --;
+
+        }
+
+        /* Insert neighbour */
+        lcBest[lcPosition] = lcScore;
+        lcNear[lcPosition] = lcRow;
+
+    }
+
+/*
+    Source - Node splitting
+ */
+
+    static void lc_vptree_split( cv::Mat const & lcData, uint32_t const lcBegin, uint32_t const lcEnd, lc_Vptree_t * const lcTree ) {
+
+        /* Node variables */
+        lc_Vpnode_t lcNode = { lcBegin, lcEnd - lcBegin, 0, 0.0 };
+
+        /* Node index variables */
+        size_t lcSelf( lcTree->node.size() );
+
+        /* Median position variables */
+        uint32_t lcMedian( lcBegin + 1 + ( lcEnd - lcBegin - 1 ) / 2 );
+
+        /* Distances variables */
+        std::vector < std::pair < float, uint32_t > > lcDistance;
+
+        /* Push node */
+        lcTree->node.push_back( lcNode );
+
+        /* Check leaf */
+        if ( lcNode.count <= LC_VPTREE_LEAF ) return;
+
+        /* Move middle descriptor in vantage position */
+        std::swap( lcTree->index[lcBegin], lcTree->index[( lcBegin + lcEnd ) / 2] );
+
+        /* Compute distances to vantage point */
+        for ( uint32_t lcParse( lcBegin + 1 ); lcParse < lcEnd; lcParse ++ ) {
+
+            /* Push descriptor distance */
+            lcDistance.push_back( std::make_pair( std::sqrt( lc_vptree_distance( lcData.ptr < float > ( lcTree->index[lcBegin] ), lcData.ptr < float > ( lcTree->index[lcParse] ), lcData.cols, INFINITY ) ), lcTree->index[lcParse] ) );
+
+        }
+
+        /* Partition descriptors at median distance */
+        std::nth_element( lcDistance.begin(), lcDistance.begin() + ( lcMedian - lcBegin - 1 ), lcDistance.end() );
+
+        /* Reorder range descriptors */
+        for ( uint32_t lcParse( lcBegin + 1 ); lcParse < lcEnd; lcParse ++ ) lcTree->index[lcParse] = lcDistance[lcParse - lcBegin - 1].second;
+
+        /* Assign median radius */
+        lcTree->node[lcSelf].radius = lcDistance[lcMedian - lcBegin - 1].first;
+
+        /* Split inside child */
+        lc_vptree_split( lcData, lcBegin + 1, lcMedian, lcTree );
+
+        /* Assign outside child index */
+        lcTree->node[lcSelf].outside = lcTree->node.size();
+
+        /* Split outside child */
+        lc_vptree_split( lcData, lcMedian, lcEnd, lcTree );
+
+    }
+
+/*
+    Source - Node visit
+ */
+
+    static void lc_vptree_visit( lc_Vptree_t const * const lcTree, float const * const lcQuery, uint32_t const lcIndex, float * const lcBest, int64_t * const lcNear, int const lcK ) {
+
+        /* Node variables */
+        lc_Vpnode_t const * lcNode( & lcTree->node[lcIndex] );
+
+        /* Dimension variables */
+        int lcDimension( lcTree->data.cols );
+
+        /* Distance variables */
+        float lcDistance( 0.0 );
+
+        /* Check leaf */
+        if ( lcNode->outside == 0 ) {
+
+            /* Scan leaf descriptors - distances abandoned beyond farthest neighbour */
+            for ( uint32_t lcParse( lcNode->begin ); lcParse < lcNode->begin + lcNode->count; lcParse ++ ) {
+
+                /* Insert descriptor */
+                lc_vptree_insert( lc_vptree_distance( lcQuery, lcTree->data.ptr < float > ( lcParse ), lcDimension, lcBest[lcK - 1] ), lcParse, lcBest, lcNear, lcK );
+
+            }
+
+        } else {
+
+            /* Compute complete distance to vantage point */
+            lcDistance = lc_vptree_distance( lcQuery, lcTree->data.ptr < float > ( lcNode->begin ), lcDimension, INFINITY );
+
+            /* Insert vantage point */
+            lc_vptree_insert( lcDistance, lcNode->begin, lcBest, lcNear, lcK );
+
+            /* Compute euclidean distance */
+            lcDistance = std::sqrt( lcDistance );
+
+            /* Check query side */
+            if ( lcDistance < lcNode->radius ) {
+
+                /* Visit inside child */
+                lc_vptree_visit( lcTree, lcQuery, lcIndex + 1, lcBest, lcNear, lcK );
+
+                /* Visit outside child - pruned by triangle inequality */
+                if ( lcDistance + std::sqrt( lcBest[lcK - 1] ) >= lcNode->radius ) lc_vptree_visit( lcTree, lcQuery, lcNode->outside, lcBest, lcNear, lcK );
+
+            } else {
+
+                /* Visit outside child */
+                lc_vptree_visit( lcTree, lcQuery, lcNode->outside, lcBest, lcNear, lcK );
+
+                /* Visit inside child - pruned by triangle inequality */
+                if ( lcDistance - std::sqrt( lcBest[lcK - 1] ) <= lcNode->radius ) lc_vptree_visit( lcTree, lcQuery, lcIndex + 1, lcBest, lcNear, lcK );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Vantage-point tree building
+ */
+
+    void lc_vptree_build( cv::Mat const & lcTrain, lc_Vptree_t * const lcTree ) {
+
+        /* Floating point descriptors variables */
+        cv::Mat lcData;
+
+        /* Convert descriptors in floating point */
+        lcTrain.convertTo( lcData, CV_32F );
+
+        /* Reset tree */
+        lcTree->node.clear();
+
+        /* Initialize descriptors order */
+        lcTree->index.resize( lcTrain.rows );
+
+        /* Assign descriptors order */
+        for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) lcTree->index[lcParse] = lcParse;
+
+        /* Split tree root */
+        if ( lcTrain.rows > 0 ) lc_vptree_split( lcData, 0, lcTrain.rows, lcTree );
+
+        /* Create reordered descriptors matrix */
+        lcTree->data.create( lcTrain.rows, lcTrain.cols, CV_32FC1 );
+
+        /* Reorder descriptors - nodes descriptors are contiguous */
+        for ( int lcParse( 0 ); lcParse < lcTrain.rows; lcParse ++ ) memcpy( lcTree->data.ptr < float > ( lcParse ), lcData.ptr < float > ( lcTree->index[lcParse] ), lcTrain.cols * sizeof( float ) );
+
+    }
+
+/*
+    Source - Vantage-point tree exact search
+ */
+
+    void lc_vptree_knn( lc_Vptree_t const * const lcTree, cv::Mat const & lcQuery, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK ) {
+
+        /* Floating point queries variables */
+        cv::Mat lcData;
+
+        /* Reset neighbours array */
+        lcMatch.assign( lcQuery.rows, std::vector < cv::DMatch > () );
+
+        /* Check tree and neighbours amount */
+        if ( ( lcTree->node.empty() == true ) || ( lcK < 1 ) ) return;
+
+        /* Convert queries in floating point */
+        lcQuery.convertTo( lcData, CV_32F );
+
+        /* Search queries neighbours */
+        # ifdef __OPENMP__
+        # pragma omp parallel for schedule( dynamic, 64 )
+        # endif
+        for ( int lcParse = 0; lcParse < lcData.rows; lcParse ++ ) {
+
+            /* Neighbours variables */
+            std::vector < float   > lcBest( lcK, INFINITY );
+            std::vector < int64_t > lcNear( lcK, -1 );
+
+            /* Search from tree root */
+            lc_vptree_visit( lcTree, lcData.ptr < float > ( lcParse ), 0, lcBest.data(), lcNear.data(), lcK );
+
+            /* Export neighbours */
+            for ( int lcIndex( 0 ); ( lcIndex < lcK ) && ( lcNear[lcIndex] >= 0 ); lcIndex ++ ) {
+
+                /* Push neighbour */
+                lcMatch[lcParse].push_back( cv::DMatch( lcParse, lcTree->index[lcNear[lcIndex]], std::sqrt( lcBest[lcIndex] ) ) );
+
+            }
+
+        }
+
+    }
+
@@ -0,0 +1,182 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-vptree.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Vantage-point tree exact search
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_VPTREE__
+    # define __LC_VPTREE__
+
+/* 
+    Header - Includes
+ */
+
+    # include <cmath>
+    # include <vector>
+    # include <algorithm>
+    # include <stdint.h>
+    # include "common.hpp"
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define maximum amount of descriptors of a leaf */
+    # define LC_VPTREE_LEAF  16
+
+    /* Define partial distance block - components accumulated between abandon checks */
+    # define LC_VPTREE_BLOCK 16
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Vpnode_struct
+     *  \brief Vantage-point tree node structure
+     *
+     *  Structure of a node of the vantage-point tree. A node covers a range of
+     *  consecutive rows of the tree descriptors, its vantage point being the
+     *  first one. The descriptors of the range that are within the radius of
+     *  the vantage point are in the inside child, which immediately follows
+     *  the node, the others being in the outside child. A leaf has no child
+     *  and its descriptors are scanned.
+     *
+     *  \var lc_Vpnode_struct::begin
+     *  First row of the node descriptors range
+     *  \var lc_Vpnode_struct::count
+     *  Amount of descriptors of the range
+     *  \var lc_Vpnode_struct::outside
+     *  Index of the outside child node, zero for leaves
+     *  \var lc_Vpnode_struct::radius
+     *  Median distance of the range descriptors to the vantage point
+     */
+
+    typedef struct lc_Vpnode_struct {
+
+        uint32_t begin;
+        uint32_t count;
+        uint32_t outside;
+        float    radius;
+
+    } lc_Vpnode_t;
+
+    /*! \struct lc_Vptree_struct
+     *  \brief Vantage-point tree structure
+     *
+     *  Structure that stores a vantage-point tree. The nodes are stored in a
+     *  flat array in depth-first order and the descriptors are converted in
+     *  floating point and reordered so that the descriptors of each node are
+     *  contiguous in memory.
+     *
+     *  \var lc_Vptree_struct::node
+     *  Nodes array, the root being the first node
+     *  \var lc_Vptree_struct::data
+     *  Reordered floating point descriptors
+     *  \var lc_Vptree_struct::index
+     *  Original row of each reordered descriptor
+     */
+
+    typedef struct lc_Vptree_struct {
+
+        std::vector < lc_Vpnode_t > node;
+        cv::Mat                     data;
+        std::vector < uint32_t >    index;
+
+    } lc_Vptree_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Vantage-point tree building
+     *
+     *  This function builds the vantage-point tree of the provided train
+     *  descriptors. The vantage point of a node is the middle descriptor of
+     *  its range and the range is split at the median distance to the vantage
+     *  point. Ranges of at most LC_VPTREE_LEAF descriptors are leaves.
+     *
+     *  \param  lcTrain     Train descriptors matrix (CV_32F, CV_8U or CV_8S)
+     *  \param  lcTree      Tree structure
+     */
+
+    void lc_vptree_build ( cv::Mat const & lcTrain, lc_Vptree_t * const lcTree );
+
+    /*! \brief Vantage-point tree exact search
+     *
+     *  This function searches, for each query descriptor, the exact nearest
+     *  train descriptors through the vantage-point tree. A child is visited
+     *  only if the triangle inequality allows it to contain a descriptor
+     *  nearer than the current farthest neighbour, the child on the side of
+     *  the query being visited first. The distances to the leaves descriptors
+     *  are abandoned as soon as the partial sum exceeds the distance of the
+     *  current farthest neighbour. Queries are searched in parallel.
+     *
+     *  The neighbours of each query are sorted by increasing distance, the
+     *  distances being euclidean and expressed in the units of the
+     *  descriptors components, as with \b lc_brute_knn.
+     *
+     *  \param  lcTree      Tree structure
+     *  \param  lcQuery     Query descriptors matrix, of the train type
+     *  \param  lcMatch     Array receiving the neighbours of each query
+     *  \param  lcK         Amount of neighbours
+     */
+
+    void lc_vptree_knn ( lc_Vptree_t const * const lcTree, cv::Mat const & lcQuery, std::vector < std::vector < cv::DMatch > > & lcMatch, int const lcK );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
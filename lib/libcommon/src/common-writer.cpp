@@ -0,0 +1,556 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-writer.hpp"
+
+/*
+    Source - Powers of ten
+ */
+
+    static double const lc_writer_power[56] = {
+
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+        1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22, 1e23,
+        1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31,
+        1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39,
+        1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46, 1e47,
+        1e48, 1e49, 1e50, 1e51, 1e52, 1e53, 1e54, 1e55
+
+    };
+
+/*
+    Source - Scaling by a power of ten
+ */
+
+    static inline double lc_writer_scale( double const lcValue, int const lcPower ) {
+
+        /* Return scaled value */
+        return( ( lcPower < 0 ) ? lcValue / lc_writer_power[-lcPower] : lcValue * lc_writer_power[lcPower] );
+
+    }
+
+/*
+    Source - Buffer capacity control
+ */
+
+    static inline void lc_writer_reserve( lc_Writer_t * const lcWriter, size_t const lcSize ) {
+
+        /* Flush buffer if required */
+        if ( lcWriter->fill + lcSize > LC_WRITER_BUFFER ) lc_writer_flush( lcWriter );
+
+    }
+
+/*
+    Source - Digits formatting
+ */
+
+    static char * lc_writer_digits( char * lcToken, uint64_t lcDigits, int const lcCount ) {
+
+        /* Write digits from the last one */
+        for ( int lcIndex( lcCount - 1 ); lcIndex >= 0; lcIndex --, lcDigits /= 10 ) lcToken[lcIndex] = '0' + ( lcDigits % 10 );
+
+        /* Return token end */
+        return( lcToken + lcCount );
+
+    }
+
+/*
+    Source - Significant digits formatting
+ */
+
+    static size_t lc_writer_format( char * const lcToken, bool const lcSign, uint64_t lcDigits, int lcCount, int const lcExponent, int const lcPrecision ) {
+
+        /* Token position variables */
+        char * lcWrite( lcToken );
+
+        /* Remove trailing zeros */
+        while ( ( lcCount > 1 ) && ( ( lcDigits % 10 ) == 0 ) ) lcDigits /= 10, lcCount --;
+
+        /* Write sign */
+        if ( lcSign == true ) * ( lcWrite ++ ) = '-';
+
+        /* Select representation */
+        if ( ( lcExponent < -4 ) || ( lcExponent >= lcPrecision ) ) {
+
+            /* Write leading digit */
+            lcWrite = lc_writer_digits( lcWrite, lcDigits / ( uint64_t ) lc_writer_power[lcCount - 1], 1 );
+
+            /* Write remaining digits */
+            if ( lcCount > 1 ) * ( lcWrite ++ ) = '.', lcWrite = lc_writer_digits( lcWrite, lcDigits, lcCount - 1 );
+
+            /* Write exponent sign */
+            * ( lcWrite ++ ) = 'e'; * ( lcWrite ++ ) = ( lcExponent < 0 ) ? '-' : '+';
+
+            /* Write exponent - two digits cover single precision range */
+            lcWrite = lc_writer_digits( lcWrite, lcExponent < 0 ? - lcExponent : lcExponent, 2 );
+
+        } else if ( lcExponent < 0 ) {
+
+            /* Write leading zeros */
+            * ( lcWrite ++ ) = '0'; * ( lcWrite ++ ) = '.';
+
+            /* Write fractional zeros */
+            for ( int lcIndex( -1 ); lcIndex > lcExponent; lcIndex -- ) * ( lcWrite ++ ) = '0';
+
+            /* Write digits */
+            lcWrite = lc_writer_digits( lcWrite, lcDigits, lcCount );
+
+        } else if ( lcCount <= lcExponent + 1 ) {
+
+            /* Write digits */
+            lcWrite = lc_writer_digits( lcWrite, lcDigits, lcCount );
+
+            /* Write trailing zeros */
+            for ( int lcIndex( lcCount ); lcIndex <= lcExponent; lcIndex ++ ) * ( lcWrite ++ ) = '0';
+
+        } else {
+
+            /* Write integer part digits */
+            lcWrite = lc_writer_digits( lcWrite, lcDigits / ( uint64_t ) lc_writer_power[lcCount - lcExponent - 1], lcExponent + 1 );
+
+            /* Write decimal point */
+            * ( lcWrite ++ ) = '.';
+
+            /* Write fractional part digits */
+            lcWrite = lc_writer_digits( lcWrite, lcDigits, lcCount - lcExponent - 1 );
+
+        }
+
+        /* Return token size */
+        return( lcWrite - lcToken );
+
+    }
+
+/*
+    Source - Writer descriptor and buffer creation
+ */
+
+    static bool lc_writer_create( char const * const lcPath, lc_Writer_t * const lcWriter, int const lcFlags ) {
+
+        /* Reset writer structure */
+        lcWriter->handle = -1;
+        lcWriter->fill   = 0;
+        lcWriter->valid  = false;
+        lcWriter->data   = NULL;
+
+        /* Create file descriptor */
+        if ( ( lcWriter->handle = open( lcPath, lcFlags, 0644 ) ) < 0 ) return( false );
+
+        /* Allocate writer buffer */
+        if ( ( lcWriter->data = ( char * ) malloc( LC_WRITER_BUFFER ) ) == NULL ) {
+
+            /* Release descriptor */
+            lc_writer_close( lcWriter );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Update writer state */
+        lcWriter->valid = true;
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Writer creation
+ */
+
+    bool lc_writer_open( char const * const lcPath, lc_Writer_t * const lcWriter ) {
+
+        /* Create or truncate file */
+        return( lc_writer_create( lcPath, lcWriter, O_WRONLY | O_CREAT | O_TRUNC ) );
+
+    }
+
+/*
+    Source - Writer creation in append mode
+ */
+
+    bool lc_writer_append( char const * const lcPath, lc_Writer_t * const lcWriter ) {
+
+        /* Open existing file - O_APPEND is avoided as it breaks positioned writes */
+        if ( lc_writer_create( lcPath, lcWriter, O_WRONLY ) == false ) return( false );
+
+        /* Move to file end */
+        if ( lseek( lcWriter->handle, 0, SEEK_END ) < 0 ) {
+
+            /* Release writer */
+            lcWriter->valid = false; lc_writer_close( lcWriter );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - Writer closure
+ */
+
+    bool lc_writer_close( lc_Writer_t * const lcWriter ) {
+
+        /* Flush remaining bytes */
+        if ( lcWriter->data != NULL ) lc_writer_flush( lcWriter );
+
+        /* Release descriptor */
+        if ( ( lcWriter->handle >= 0 ) && ( close( lcWriter->handle ) != 0 ) ) lcWriter->valid = false;
+
+        /* Release buffer */
+        free( lcWriter->data );
+
+        /* Reset writer structure */
+        lcWriter->handle = -1;
+        lcWriter->fill   = 0;
+        lcWriter->data   = NULL;
+
+        /* Return writer state */
+        return( lcWriter->valid );
+
+    }
+
+/*
+    Source - Writer buffer flush
+ */
+
+    bool lc_writer_flush( lc_Writer_t * const lcWriter ) {
+
+        /* Written bytes variables */
+        size_t lcWritten( 0 );
+
+        /* Write buffer content */
+        while ( ( lcWriter->valid == true ) && ( lcWritten < lcWriter->fill ) ) {
+
+            /* Write call variables */
+            ssize_t lcCall( write( lcWriter->handle, lcWriter->data + lcWritten, lcWriter->fill - lcWritten ) );
+
+            /* Check write call */
+            if ( lcCall < 0 ) {
+
+                /* Update writer state - interrupted calls are repeated */
+                if ( errno != EINTR ) lcWriter->valid = false;
+
+            } else {
+
+                /* Update written bytes */
+                lcWritten += lcCall;
+
+            }
+
+        }
+
+        /* Reset buffer */
+        lcWriter->fill = 0;
+
+        /* Return writer state */
+        return( lcWriter->valid );
+
+    }
+
+/*
+    Source - Writer in-place update
+ */
+
+    bool lc_writer_patch( lc_Writer_t * const lcWriter, off_t const lcOffset, void const * const lcData, size_t const lcSize ) {
+
+        /* Flush buffer */
+        if ( lc_writer_flush( lcWriter ) == false ) return( false );
+
+        /* Overwrite bytes */
+        if ( pwrite( lcWriter->handle, lcData, lcSize, lcOffset ) != ( ssize_t ) lcSize ) lcWriter->valid = false;
+
+        /* Return writer state */
+        return( lcWriter->valid );
+
+    }
+
+/*
+    Source - File range copy
+ */
+
+    bool lc_writer_copy( lc_Writer_t * const lcWriter, int const lcHandle, off_t lcOffset, size_t lcSize ) {
+
+        /* Copy method variables - in-kernel copy, then sendfile, then buffer */
+        int lcMethod( 0 );
+
+        /* Flush buffer */
+        if ( lc_writer_flush( lcWriter ) == false ) return( false );
+
+        /* Copy range */
+        while ( ( lcWriter->valid == true ) && ( lcSize > 0 ) ) {
+
+            /* Copy call variables */
+            ssize_t lcCall( -1 );
+
+            /* Switch on copy method */
+            if ( lcMethod == 0 ) {
+
+                /* Copy range in kernel - shares extents on capable filesystems */
+                lcCall = copy_file_range( lcHandle, & lcOffset, lcWriter->handle, NULL, lcSize, 0 );
+
+            } else if ( lcMethod == 1 ) {
+
+                /* Copy range through page cache */
+                lcCall = sendfile( lcWriter->handle, lcHandle, & lcOffset, lcSize );
+
+            } else if ( ( lcCall = pread( lcHandle, lcWriter->data, std::min( lcSize, ( size_t ) LC_WRITER_BUFFER ), lcOffset ) ) > 0 ) {
+
+                /* Send read bytes through the buffer */
+                lcWriter->fill = lcCall; lc_writer_flush( lcWriter );
+
+                /* Update reading offset */
+                lcOffset += lcCall;
+
+            }
+
+            /* Check copy call */
+            if ( lcCall > 0 ) {
+
+                /* Update remaining size */
+                lcSize -= lcCall;
+
+            } else if ( lcCall == 0 ) {
+
+                /* Update writer state - truncated source */
+                lcWriter->valid = false;
+
+            } else if ( errno != EINTR ) {
+
+                /* Fall back on next method - unsupported calls or file systems */
+                if ( ( lcMethod < 2 ) && ( ( errno == ENOSYS ) || ( errno == EXDEV ) || ( errno == EINVAL ) || ( errno == EOPNOTSUPP ) ) ) lcMethod ++; else lcWriter->valid = false;
+
+            }
+
+        }
+
+        /* Return writer state */
+        return( lcWriter->valid );
+
+    }
+
+/*
+    Source - Raw bytes writer
+ */
+
+    void lc_writer_raw( lc_Writer_t * const lcWriter, void const * const lcData, size_t const lcSize ) {
+
+        /* Check block size */
+        if ( lcSize <= LC_WRITER_BUFFER ) {
+
+            /* Ensure buffer capacity */
+            lc_writer_reserve( lcWriter, lcSize );
+
+            /* Copy bytes in buffer */
+            memcpy( lcWriter->data + lcWriter->fill, lcData, lcSize );
+
+            /* Update buffer size */
+            lcWriter->fill += lcSize;
+
+        } else {
+
+            /* Block position variables */
+            char const * lcBlock( ( char const * ) lcData );
+
+            /* Written bytes variables */
+            size_t lcWritten( 0 );
+
+            /* Flush buffer */
+            lc_writer_flush( lcWriter );
+
+            /* Write block directly */
+            while ( ( lcWriter->valid == true ) && ( lcWritten < lcSize ) ) {
+
+                /* Write call variables */
+                ssize_t lcCall( write( lcWriter->handle, lcBlock + lcWritten, lcSize - lcWritten ) );
+
+                /* Check write call */
+                if ( lcCall < 0 ) {
+
+                    /* Update writer state - interrupted calls are repeated */
+                    if ( errno != EINTR ) lcWriter->valid = false;
+
+                } else {
+
+                    /* Update written bytes */
+                    lcWritten += lcCall;
+
+                }
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Character writer
+ */
+
+    void lc_writer_char( lc_Writer_t * const lcWriter, char const lcChar ) {
+
+        /* Ensure buffer capacity */
+        lc_writer_reserve( lcWriter, 1 );
+
+        /* Write character */
+        lcWriter->data[lcWriter->fill ++] = lcChar;
+
+    }
+
+/*
+    Source - Integer writer
+ */
+
+    void lc_writer_integer( lc_Writer_t * const lcWriter, long const lcValue ) {
+
+        /* Absolute value variables */
+        unsigned long lcAbsolute( lcValue < 0 ? 0UL - ( unsigned long ) lcValue : ( unsigned long ) lcValue );
+
+        /* Digits count variables */
+        int lcCount( 1 );
+
+        /* Ensure buffer capacity */
+        lc_writer_reserve( lcWriter, LC_WRITER_TOKEN );
+
+        /* Write sign */
+        if ( lcValue < 0 ) lcWriter->data[lcWriter->fill ++] = '-';
+
+        /* Count digits */
+        for ( unsigned long lcParse( lcAbsolute ); lcParse >= 10; lcParse /= 10 ) lcCount ++;
+
+        /* Write digits */
+        lcWriter->fill = lc_writer_digits( lcWriter->data + lcWriter->fill, lcAbsolute, lcCount ) - lcWriter->data;
+
+    }
+
+/*
+    Source - Floating point writer
+ */
+
+    void lc_writer_float( lc_Writer_t * const lcWriter, float const lcValue ) {
+
+        /* Absolute value variables */
+        double lcAbsolute( std::fabs( lcValue ) );
+
+        /* Decimal exponent variables */
+        int lcExponent( 0 );
+
+        /* Precision variables - denormals may round-trip with less than six digits */
+        int lcLower( lcAbsolute < FLT_MIN ? 1 : 6 );
+
+        /* Token variables */
+        char * lcToken( NULL );
+        size_t lcSize ( 0 );
+
+        /* Ensure buffer capacity */
+        lc_writer_reserve( lcWriter, LC_WRITER_TOKEN );
+
+        /* Assign token position */
+        lcToken = lcWriter->data + lcWriter->fill;
+
+        /* Check special values */
+        if ( ( lcAbsolute == 0.0 ) || ( std::isfinite( lcValue ) == false ) ) {
+
+            /* Standard representation of zeros, infinites and undefined values */
+            lcWriter->fill += snprintf( lcToken, LC_WRITER_TOKEN, "%g", lcValue );
+
+            /* Abort formatting */
+            return;
+
+        }
+
+        /* Estimate decimal exponent */
+        lcExponent = std::floor( std::log10( lcAbsolute ) );
+
+        /* Search shortest round-trip precision */
+        for ( int lcPrecision( lcLower ); lcPrecision <= 9; lcPrecision ++ ) {
+
+            /* Exponent variables */
+            int lcPower( lcExponent );
+
+            /* Parsing check variables */
+            float lcCheck( 0.0 );
+
+            /* Compute significant digits */
+            uint64_t lcDigits( std::llround( lc_writer_scale( lcAbsolute, lcPrecision - 1 - lcPower ) ) );
+
+            /* Correct exponent estimation */
+            if ( lcDigits >= ( uint64_t ) lc_writer_power[lcPrecision] ) {
+
+                /* Recompute significant digits */
+                lcDigits = std::llround( lc_writer_scale( lcAbsolute, lcPrecision - 1 - ( ++ lcPower ) ) );
+
+            } else if ( lcDigits < ( uint64_t ) lc_writer_power[lcPrecision - 1] ) {
+
+                /* Recompute significant digits */
+                lcDigits = std::llround( lc_writer_scale( lcAbsolute, lcPrecision - 1 - ( -- lcPower ) ) );
+
+            }
+
+            /* Format significant digits */
+            lcSize = lc_writer_format( lcToken, lcValue < 0.0f, lcDigits, lcPrecision, lcPower, lcPrecision );
+
+            /* Check round-trip */
+            if ( ( lc_parse_float( lcToken, lcToken + lcSize, & lcCheck ) != NULL ) && ( lcCheck == lcValue ) ) {
+
+                /* Validate token */
+                lcWriter->fill += lcSize;
+
+                /* Abort search */
+                return;
+
+            }
+
+        }
+
+        /* Standard representation - nine digits always round-trip */
+        lcWriter->fill += snprintf( lcToken, LC_WRITER_TOKEN, "%.9g", lcValue );
+
+    }
+
@@ -0,0 +1,258 @@
+/*
+ * feature-suite libcommon - feature-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-writer.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Buffered files writer
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_WRITER__
+    # define __LC_WRITER__
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.hpp"
+    # include "common-parser.hpp"
+    # include <cstdio>
+    # include <cerrno>
+    # include <cmath>
+    # include <cfloat>
+    # include <stdint.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <algorithm>
+    # include <sys/sendfile.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define writer buffer size */
+    # define LC_WRITER_BUFFER   ( 1 << 20 )
+
+    /* Define maximum formatted token size */
+    # define LC_WRITER_TOKEN    32
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Writer_struct
+     *  \brief Writer structure
+     *
+     *  Structure that stores the state of a buffered file writer. Formatted
+     *  values are accumulated in the buffer which is sent to the file through
+     *  large write calls.
+     *
+     *  \var lc_Writer_struct::handle
+     *  File descriptor of the written file
+     *  \var lc_Writer_struct::fill
+     *  Amount of bytes waiting in the buffer
+     *  \var lc_Writer_struct::valid
+     *  Writer state, false as soon as a write fails
+     *  \var lc_Writer_struct::data
+     *  Pointer to the writer buffer
+     */
+
+    typedef struct lc_Writer_struct {
+
+        int    handle;
+        size_t fill;
+        bool   valid;
+        char * data;
+
+    } lc_Writer_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Writer creation
+     *
+     *  This function creates, or truncates, the specified file and allocates
+     *  the writer buffer.
+     *
+     *  \param  lcPath      Path of the file to write
+     *  \param  lcWriter    Writer structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_writer_open ( char const * const lcPath, lc_Writer_t * const lcWriter );
+
+    /*! \brief Writer creation in append mode
+     *
+     *  This function opens the specified existing file and allocates the
+     *  writer buffer. The written bytes are appended to the file content and
+     *  the existing bytes can be updated using \b lc_writer_patch.
+     *
+     *  \param  lcPath      Path of the file to extend
+     *  \param  lcWriter    Writer structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool lc_writer_append ( char const * const lcPath, lc_Writer_t * const lcWriter );
+
+    /*! \brief Writer closure
+     *
+     *  This function flushes the buffer, closes the file and releases the
+     *  writer buffer. It can be safely called on a structure for which the
+     *  creation failed.
+     *
+     *  \param  lcWriter    Writer structure to release
+     *
+     *  \return Returns true if every write succeeded, false otherwise
+     */
+
+    bool lc_writer_close ( lc_Writer_t * const lcWriter );
+
+    /*! \brief Writer buffer flush
+     *
+     *  This function sends the content of the buffer to the file.
+     *
+     *  \param  lcWriter    Writer structure
+     *
+     *  \return Returns the writer state
+     */
+
+    bool lc_writer_flush ( lc_Writer_t * const lcWriter );
+
+    /*! \brief Writer in-place update
+     *
+     *  This function flushes the buffer and overwrites the bytes found at the
+     *  specified offset of the file. It is used to update headers, such as a
+     *  records count, once the records are written.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcOffset    Offset, in bytes, of the bytes to overwrite
+     *  \param  lcData      Pointer to the new bytes
+     *  \param  lcSize      Amount of bytes to overwrite
+     *
+     *  \return Returns the writer state
+     */
+
+    bool lc_writer_patch ( lc_Writer_t * const lcWriter, off_t const lcOffset, void const * const lcData, size_t const lcSize );
+
+    /*! \brief File range copy
+     *
+     *  This function flushes the buffer and appends a range of the provided
+     *  file without reading it in user space. The copy is performed by the
+     *  kernel, using copy_file_range or, when unavailable, sendfile. A buffered
+     *  copy is used as last resort.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcHandle    File descriptor of the file to copy
+     *  \param  lcOffset    Offset, in bytes, of the range to copy
+     *  \param  lcSize      Size, in bytes, of the range to copy
+     *
+     *  \return Returns the writer state
+     */
+
+    bool lc_writer_copy ( lc_Writer_t * const lcWriter, int const lcHandle, off_t lcOffset, size_t lcSize );
+
+    /*! \brief Raw bytes writer
+     *
+     *  This function writes the provided bytes. Blocks larger than the buffer
+     *  are directly sent to the file.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcData      Pointer to the bytes to write
+     *  \param  lcSize      Amount of bytes to write
+     */
+
+    void lc_writer_raw ( lc_Writer_t * const lcWriter, void const * const lcData, size_t const lcSize );
+
+    /*! \brief Character writer
+     *
+     *  This function writes a single character, typically a separator.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcChar      Character to write
+     */
+
+    void lc_writer_char ( lc_Writer_t * const lcWriter, char const lcChar );
+
+    /*! \brief Integer writer
+     *
+     *  This function writes the decimal representation of an integer.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcValue     Integer to write
+     */
+
+    void lc_writer_integer ( lc_Writer_t * const lcWriter, long const lcValue );
+
+    /*! \brief Floating point writer
+     *
+     *  This function writes the shortest representation of a floating point
+     *  value that gives back the same value when parsed. The representation
+     *  follows the %g convention used by the standard streams : the default
+     *  six significant digits are used, and extended up to nine digits only
+     *  when required to preserve the value. As any decimal of six digits
+     *  round-trips through a normal single precision value, no shorter
+     *  representation exists for them. Denormal values, carrying less
+     *  significant bits, are searched from a single digit.
+     *
+     *  \param  lcWriter    Writer structure
+     *  \param  lcValue     Value to write
+     */
+
+    void lc_writer_float ( lc_Writer_t * const lcWriter, float const lcValue );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
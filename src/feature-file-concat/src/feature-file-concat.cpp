@@ -54,23 +54,39 @@
         char * fsFileB( NULL );
         char * fsFileO( NULL );
 
-        /* Reading variables */
-        int fsCountA ( 0 );
-        int fsCountB ( 0 );
+        /* Input paths list variables */
+        std::vector < char * > fsPaths;
 
-        /* Stream variables */
-        std::fstream fsStreamA;
-        std::fstream fsStreamB;
-        std::fstream fsStreamO;
+        /* Input files variables */
+        std::vector < fs_File_t > fsFiles;
 
-        /* Line buffer */
-        std::string fsLine;
+        /* Output file variables */
+        fs_File_t fsOutput;
+
+        /* Opened files variables */
+        size_t fsOpened( 0 );
+
+        /* Appending mode variables */
+        bool fsAppend( false );
+
+        /* Input list argument variables */
+        int fsList( lc_stda( argc, argv, "--inputs", "-i" ) );
 
         /* Arguments and parameters handle */
         lc_stdp( lc_stda( argc, argv, "--input-a", "-a" ), argv, & fsFileA, LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--input-b", "-b" ), argv, & fsFileB, LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--output" , "-o" ), argv, & fsFileO, LC_STRING );
 
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--append", "-p" ) ) fsAppend = true;
+
+        /* Gather input paths */
+        if ( fsFileA != NULL ) fsPaths.push_back( fsFileA );
+        if ( fsFileB != NULL ) fsPaths.push_back( fsFileB );
+
+        /* Gather input paths list */
+        if ( fsList != LC_NULL ) for ( int fsIndex( fsList ); fsIndex < argc; fsIndex ++ ) fsPaths.push_back( argv[fsIndex] );
+
         /* Software swicth */
         if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
 
@@ -80,74 +96,72 @@
         } else {
 
             /* Verify path strings */
-            if ( ( fsFileA != NULL ) && ( fsFileB != NULL ) && ( fsFileO != NULL ) ) {
-
-                /* Open input stream */
-                fsStreamA.open( fsFileA, std::ios::in );
+            if ( ( fsPaths.empty() == false ) && ( fsFileO != NULL ) ) {
 
-                /* Check stream openning */
-                if ( fsStreamA.is_open() == true ) {
+                /* Allocate input files */
+                fsFiles.resize( fsPaths.size() );
 
-                    /* Open input stream */
-                    fsStreamB.open( fsFileB, std::ios::in );
+                /* Open input files */
+                while ( ( fsOpened < fsPaths.size() ) && ( fs_concat_open( fsPaths[fsOpened], & fsFiles[fsOpened] ) == true ) ) fsOpened ++;
 
-                    /* Check stream openning */
-                    if ( fsStreamB.is_open() == true ) {
+                /* Check input files */
+                if ( fsOpened == fsPaths.size() ) {
 
-                        /* Open output stream */
-                        fsStreamO.open( fsFileO, std::ios::out );
+                    /* Format consistency variables */
+                    bool fsConsistent( true );
 
-                        /* Check stream openning */
-                        if ( fsStreamO.is_open() == true ) {
-                    
-                            /* Read elements count */
-                            std::getline( fsStreamA, fsLine ); fsCountA = std::stoi( fsLine );
-                            std::getline( fsStreamB, fsLine ); fsCountB = std::stoi( fsLine );
+                    /* Check input files format consistency */
+                    for ( size_t fsIndex( 1 ); fsIndex < fsFiles.size(); fsIndex ++ ) fsConsistent &= fs_concat_consistent( & fsFiles[0], & fsFiles[fsIndex] );
 
-                            /* Export concatenation count */
-                            fsStreamO << fsCountA + fsCountB << std::endl;
+                    /* Check consistency */
+                    if ( fsConsistent == true ) {
 
-                            /* Read matches coordinates */
-                            for ( int fsIndex( 0 ); fsIndex < fsCountA; fsIndex ++ ) {
+                        /* Check appending to existing file */
+                        if ( ( fsAppend == true ) && ( access( fsFileO, F_OK ) == 0 ) ) {
 
-                                /* Import input file line */
-                                std::getline( fsStreamA, fsLine );
+                            /* Open output file */
+                            if ( fs_concat_open( fsFileO, & fsOutput ) == true ) {
 
-                                /* Export line in output file */
-                                fsStreamO << fsLine << std::endl;
+                                /* Check output file format consistency */
+                                if ( fs_concat_consistent( & fsOutput, & fsFiles[0] ) == true ) {
 
+                                    /* Append input files */
+                                    if ( fs_concat_append( & fsOutput, fsFiles, fsFileO ) == false ) {
 
-                            }
+                                        /* Display message */
+                                        std::cerr << "Error : Unable to append to output file" << std::endl;
 
-                            /* Close input stream */
-                            fsStreamA.close();
+                                    }
 
-                            /* Read matches coordinates */
-                            for ( int fsIndex( 0 ); fsIndex < fsCountB; fsIndex ++ ) {
+                                /* Display message */
+                                } else { std::cerr << "Error : Inconsistent output file format" << std::endl; }
 
-                                /* Import input file line */
-                                std::getline( fsStreamB, fsLine );
+                                /* Close output file */
+                                fs_concat_close( & fsOutput );
 
-                                /* Export line in output file */
-                                fsStreamO << fsLine << std::endl;
+                            /* Display message */
+                            } else { std::cerr << "Error : Unable to open output file" << std::endl; }
 
+                        } else {
 
-                            }
+                            /* Concatenate input files */
+                            if ( fs_concat_merge( fsFiles, fsFileO ) == false ) {
 
-                            /* Close input stream */
-                            fsStreamB.close();
+                                /* Display message */
+                                std::cerr << "Error : Unable to write output file" << std::endl;
 
-                            /* Close output stream */
-                            fsStreamO.close();
+                            }
 
-                        /* Display message */
-                        } else { std::cerr << "Error : Unable to open output file" << std::endl; }
+                        }
 
                     /* Display message */
-                    } else { std::cerr << "Error : Unable to open second input file" << std::endl; }
+                    } else { std::cerr << "Error : Inconsistent input files format" << std::endl; }
 
                 /* Display message */
-                } else { std::cerr << "Error : Unable to open first input file" << std::endl; }
+                } else { std::cerr << "Error : Unable to open input file " << fsPaths[fsOpened] << std::endl; }
+
+                /* Close input files */
+                for ( size_t fsIndex( 0 ); fsIndex < fsOpened; fsIndex ++ ) fs_concat_close( & fsFiles[fsIndex] );
 
             /* Display message */
             } else { std::cerr << "Error : Invalid path specification" << std::endl; }
@@ -159,3 +173,305 @@
 
     }
 
+/*
+    Source - File opening
+ */
+
+    bool fs_concat_open( char const * const fsPath, fs_File_t * const fsFile ) {
+
+        /* Header pointer variables */
+        lc_Header_t const * fsHeader( NULL );
+
+        /* Reset file structure */
+        fsFile->format = -1;
+        fsFile->count  = 0;
+        fsFile->body   = 0;
+        fsFile->width  = 0;
+
+        /* Map file */
+        if ( lc_map_open( fsPath, & fsFile->map ) == false ) return( false );
+
+        /* Detect file format */
+        if ( ( fsHeader = lc_archive_check( & fsFile->map ) ) != NULL ) {
+
+            /* Assign archive format */
+            fsFile->format = LC_FORMAT_ARCHIVE;
+
+            /* Copy header and archive description */
+            fsFile->header  = * fsHeader;
+            fsFile->archive = * ( lc_Archive_t const * ) ( fsFile->map.data + sizeof( lc_Header_t ) );
+
+            /* Assign blocks position */
+            fsFile->body = sizeof( lc_Header_t ) + sizeof( lc_Archive_t );
+
+        } else if ( ( fsHeader = lc_format_probe( & fsFile->map ) ) != NULL ) {
+
+            /* Assign binary format */
+            fsFile->format = LC_FORMAT_BINARY;
+
+            /* Copy header */
+            fsFile->header = * fsHeader;
+
+            /* Assign records position */
+            fsFile->body = sizeof( lc_Header_t );
+
+        } else {
+
+            /* Records position variables */
+            char const * fsBody( NULL );
+
+            /* Parse records count */
+            long fsCount( lc_parse_count( & fsFile->map, & fsBody ) );
+
+            /* Check records count */
+            if ( fsCount >= 0 ) {
+
+                /* Assign text format */
+                fsFile->format = LC_FORMAT_TEXT;
+
+                /* Assign records count and position */
+                fsFile->count = fsCount;
+                fsFile->body  = fsBody - fsFile->map.data;
+
+                /* Compute count line width */
+                fsFile->width = ( ( fsFile->body > 0 ) && ( fsFile->map.data[fsFile->body - 1] == '\n' ) ) ? fsFile->body - 1 : fsFile->body;
+
+                /* Assign count line flags */
+                fsFile->header.flags = lc_matchfile_mark( fsFile->map.data, fsFile->map.data + fsFile->body );
+
+            }
+
+        }
+
+        /* Assign binary records count */
+        if ( fsHeader != NULL ) fsFile->count = fsHeader->count;
+
+        /* Check detected format */
+        if ( fsFile->format < 0 ) {
+
+            /* Release mapping */
+            lc_map_close( & fsFile->map );
+
+            /* Send message */
+            return( false );
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
+/*
+    Source - File closure
+ */
+
+    void fs_concat_close( fs_File_t * const fsFile ) {
+
+        /* Release mapping */
+        lc_map_close( & fsFile->map );
+
+    }
+
+/*
+    Source - Matches file detection
+ */
+
+    bool fs_concat_matches( fs_File_t const * const fsFile ) {
+
+        /* Check text and archive formats - text files only carry the truncation mark */
+        if ( ( fsFile->format == LC_FORMAT_TEXT ) || ( fsFile->format == LC_FORMAT_ARCHIVE ) ) return( true );
+
+        /* Check binary matchfile format */
+        return( ( fsFile->format == LC_FORMAT_BINARY ) && ( memcmp( fsFile->header.magic, LC_MATCHFILE_MAGIC, LC_FORMAT_MAGIC ) == 0 ) );
+
+    }
+
+/*
+    Source - Files format consistency
+ */
+
+    bool fs_concat_consistent( fs_File_t const * const fsFileA, fs_File_t const * const fsFileB ) {
+
+        /* Compare formats */
+        if ( fsFileA->format != fsFileB->format ) return( false );
+
+        /* Text files are always consistent */
+        if ( fsFileA->format == LC_FORMAT_TEXT ) return( true );
+
+        /* Compare records description */
+        if ( ( memcmp( fsFileA->header.magic , fsFileB->header.magic , LC_FORMAT_MAGIC  ) != 0 ) ||
+             ( memcmp( fsFileA->header.layout, fsFileB->header.layout, LC_FORMAT_LAYOUT ) != 0 ) ||
+             ( fsFileA->header.width != fsFileB->header.width ) ) return( false );
+
+        /* Compare quantization scale - 8 bits records of different scales cannot be mixed */
+        if ( fsFileA->header.scale != fsFileB->header.scale ) return( false );
+
+        /* Compare flags - matches flags are combined */
+        if ( ( fs_concat_matches( fsFileA ) == false ) && ( fsFileA->header.flags != fsFileB->header.flags ) ) return( false );
+
+        /* Compare archives quantization step */
+        return( ( fsFileA->format != LC_FORMAT_ARCHIVE ) || ( fsFileA->archive.step == fsFileB->archive.step ) );
+
+    }
+
+/*
+    Source - File records copy
+ */
+
+    bool fs_concat_records( lc_Writer_t * const fsWriter, fs_File_t const * const fsFile ) {
+
+        /* Records end variables - archives blocks extend to the file end */
+        size_t fsStop( ( fsFile->format == LC_FORMAT_BINARY ) ? fsFile->body + fsFile->count * fsFile->header.size : fsFile->map.size );
+
+        /* Copy records */
+        lc_writer_copy( fsWriter, fsFile->map.handle, fsFile->body, fsStop - fsFile->body );
+
+        /* Complete last line of text files */
+        if ( ( fsFile->format == LC_FORMAT_TEXT ) && ( fsStop > fsFile->body ) && ( fsFile->map.data[fsStop - 1] != '\n' ) ) lc_writer_char( fsWriter, '\n' );
+
+        /* Return writer state */
+        return( fsWriter->valid );
+
+    }
+
+/*
+    Source - Files concatenation
+ */
+
+    bool fs_concat_merge( std::vector < fs_File_t > const & fsFiles, char const * const fsPath ) {
+
+        /* Writer variables */
+        lc_Writer_t fsWriter;
+
+        /* Header variables */
+        lc_Header_t fsHeader( fsFiles[0].header );
+
+        /* Records count variables */
+        uint64_t fsCount( 0 );
+
+        /* Compute concatenation count */
+        for ( size_t fsIndex( 0 ); fsIndex < fsFiles.size(); fsIndex ++ ) fsCount += fsFiles[fsIndex].count;
+
+        /* Combine matches flags */
+        if ( fs_concat_matches( & fsFiles[0] ) == true ) for ( size_t fsIndex( 1 ); fsIndex < fsFiles.size(); fsIndex ++ ) fsHeader.flags |= fsFiles[fsIndex].header.flags;
+
+        /* Create output file */
+        if ( lc_writer_open( fsPath, & fsWriter ) == false ) return( false );
+
+        /* Check files format */
+        if ( fsFiles[0].format == LC_FORMAT_TEXT ) {
+
+            /* Count line variables */
+            char fsLine[LC_FORMAT_COUNT + 16] = { 0 };
+
+            /* Export padded count line */
+            lc_writer_raw( & fsWriter, fsLine, lc_matchfile_count( fsLine, sizeof( fsLine ), fsCount, fsHeader.flags, LC_FORMAT_COUNT ) );
+
+            /* Terminate count line */
+            lc_writer_char( & fsWriter, '\n' );
+
+        } else {
+
+            /* Update concatenation count */
+            fsHeader.count = fsCount;
+
+            /* Export concatenation header */
+            lc_writer_raw( & fsWriter, & fsHeader, sizeof( lc_Header_t ) );
+
+            /* Export archive description */
+            if ( fsFiles[0].format == LC_FORMAT_ARCHIVE ) lc_writer_raw( & fsWriter, & fsFiles[0].archive, sizeof( lc_Archive_t ) );
+
+        }
+
+        /* Copy input files records */
+        for ( size_t fsIndex( 0 ); fsIndex < fsFiles.size(); fsIndex ++ ) fs_concat_records( & fsWriter, & fsFiles[fsIndex] );
+
+        /* Close output file and return state */
+        return( lc_writer_close( & fsWriter ) );
+
+    }
+
+/*
+    Source - Files appending
+ */
+
+    bool fs_concat_append( fs_File_t const * const fsOutput, std::vector < fs_File_t > const & fsFiles, char const * const fsPath ) {
+
+        /* Writer variables */
+        lc_Writer_t fsWriter;
+
+        /* Records count variables */
+        uint64_t fsCount( fsOutput->count );
+
+        /* Count line variables */
+        std::vector < char > fsLine;
+
+        /* Appended flags variables */
+        uint32_t fsFlags( fsOutput->header.flags );
+
+        /* Compute appended count */
+        for ( size_t fsIndex( 0 ); fsIndex < fsFiles.size(); fsIndex ++ ) fsCount += fsFiles[fsIndex].count;
+
+        /* Combine matches flags */
+        if ( fs_concat_matches( fsOutput ) == true ) for ( size_t fsIndex( 0 ); fsIndex < fsFiles.size(); fsIndex ++ ) fsFlags |= fsFiles[fsIndex].header.flags;
+
+        /* Check text count line capacity */
+        if ( fsOutput->format == LC_FORMAT_TEXT ) {
+
+            /* Compose count line */
+            fsLine.resize( std::max( fsOutput->width, ( size_t ) LC_FORMAT_COUNT ) + 16 );
+
+            /* Check count line width */
+            if ( lc_matchfile_count( fsLine.data(), fsLine.size(), fsCount, fsFlags, fsOutput->width ) > fsOutput->width ) {
+
+                /* Rebuild path variables */
+                std::string fsRebuild( std::string( fsPath ) + ".tmp" );
+
+                /* Rebuild files variables */
+                std::vector < fs_File_t > fsRebuilt( 1, * fsOutput );
+
+                /* Gather output and input files */
+                fsRebuilt.insert( fsRebuilt.end(), fsFiles.begin(), fsFiles.end() );
+
+                /* Rebuild output file with padded count line */
+                return( ( fs_concat_merge( fsRebuilt, fsRebuild.c_str() ) == true ) && ( rename( fsRebuild.c_str(), fsPath ) == 0 ) );
+
+            }
+
+        }
+
+        /* Open output file */
+        if ( lc_writer_append( fsPath, & fsWriter ) == false ) return( false );
+
+        /* Complete last line of text output file */
+        if ( ( fsOutput->format == LC_FORMAT_TEXT ) && ( fsOutput->map.size > fsOutput->body ) && ( fsOutput->map.data[fsOutput->map.size - 1] != '\n' ) ) lc_writer_char( & fsWriter, '\n' );
+
+        /* Append input files records */
+        for ( size_t fsIndex( 0 ); fsIndex < fsFiles.size(); fsIndex ++ ) fs_concat_records( & fsWriter, & fsFiles[fsIndex] );
+
+        /* Check output file format */
+        if ( fsOutput->format == LC_FORMAT_TEXT ) {
+
+            /* Update count line */
+            lc_writer_patch( & fsWriter, 0, fsLine.data(), fsOutput->width );
+
+        } else {
+
+            /* Header variables */
+            lc_Header_t fsHeader( fsOutput->header );
+
+            /* Update records count and flags */
+            fsHeader.count = fsCount;
+            fsHeader.flags = fsFlags;
+
+            /* Update header */
+            lc_writer_patch( & fsWriter, 0, & fsHeader, sizeof( lc_Header_t ) );
+
+        }
+
+        /* Close output file and return state */
+        return( lc_writer_close( & fsWriter ) );
+
+    }
+
@@ -39,7 +39,7 @@
     /*! \file   feature-file-concat.hpp
      *  \author Nils Hamel <n.hamel@foxel.ch>
      *  
-     *  Software main header (single function software)
+     *  Software main header
      */
 
     /*! \mainpage feature-file-concat
@@ -87,7 +87,10 @@
  */
 
     # include <iostream>
-    # include <fstream>
+    # include <string>
+    # include <vector>
+    # include <cstdio>
+    # include <unistd.h>
     # include <common-all.hpp>
 
 /* 
@@ -104,7 +107,9 @@
     "Short arguments and parameters summary :\n\n"           \
     "\t-a\tInput keypoints/matches file 1\n"                 \
     "\t-b\tInput keypoints/matches file 2\n"                 \
-    "\t-o\tOutput file\n\n"                                  \
+    "\t-i\tInput files list (last argument)\n"               \
+    "\t-o\tOutput file\n"                                    \
+    "\t-p\tAppend inputs to the output file\n\n"             \
     "feature-file-concat - feature-suite\n"                  \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
@@ -116,16 +121,53 @@
     Header - Structures
  */
 
+    /*! \struct fs_File_struct
+     *  \brief Concatenated file structure
+     *
+     *  Structure that stores the description of a file to concatenate. The
+     *  file is mapped, but only its header is read : the records are copied
+     *  by the kernel without being parsed.
+     *
+     *  \var fs_File_struct::map
+     *  Mapping of the file
+     *  \var fs_File_struct::format
+     *  Format of the file
+     *  \var fs_File_struct::header
+     *  Header of binary files and archives, only storing the flags of the
+     *  count line for text files
+     *  \var fs_File_struct::archive
+     *  Description of archives
+     *  \var fs_File_struct::count
+     *  Amount of records of the file
+     *  \var fs_File_struct::body
+     *  Offset, in bytes, of the first record
+     *  \var fs_File_struct::width
+     *  Width, in bytes, of the count line of text files
+     */
+
+    typedef struct fs_File_struct {
+
+        lc_Map_t     map;
+        int          format;
+        lc_Header_t  header;
+        lc_Archive_t archive;
+        uint64_t     count;
+        size_t       body;
+        size_t       width;
+
+    } fs_File_t;
+
 /* 
     Header - Function prototypes
  */
 
-    /*! \brief Software main function (single function software)
+    /*! \brief Software main function
      *  
      *  The main function frame follows : parameters are initialized and read.
-     *  The two input file are openned and the output file is created. After
-     *  size reading and concatenation result export, the input files line are
-     *  copied in the output file.
+     *  The input files are opened and their format is checked for consistency.
+     *  The input files are then concatenated in the output file or appended
+     *  to it. In both cases, only the records count is composed : the records
+     *  are copied as is.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -133,6 +175,107 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief File opening
+     *
+     *  This function maps the specified file and detects its format. The
+     *  records count is read from the binary header or from the count line of
+     *  text files. The position of the first record is also computed.
+     *
+     *  \param  fsPath      Path of the file
+     *  \param  fsFile      File structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_concat_open ( char const * const fsPath, fs_File_t * const fsFile );
+
+    /*! \brief File closure
+     *
+     *  This function releases the mapping of the file.
+     *
+     *  \param  fsFile      File structure
+     */
+
+    void fs_concat_close ( fs_File_t * const fsFile );
+
+    /*! \brief Matches file detection
+     *
+     *  This function checks if the provided file is a text file, a binary
+     *  matchfile or a matches archive. The flags of such files describe their
+     *  matches and are combined by the concatenation. The flags of text files
+     *  come from the truncation mark of their count line.
+     *
+     *  \param  fsFile      File structure
+     *
+     *  \return Returns true for text files, binary matchfiles and archives,
+     *  false otherwise
+     */
+
+    bool fs_concat_matches ( fs_File_t const * const fsFile );
+
+    /*! \brief Files format consistency
+     *
+     *  This function checks that two files can be concatenated. Both files
+     *  have to be text files or binary files of the same records description
+     *  and quantization scale. Binary files also have to share their header
+     *  flags, unless they are matches files. Archives also have to share their
+     *  quantization step.
+     *
+     *  \param  fsFileA     First file structure
+     *  \param  fsFileB     Second file structure
+     *
+     *  \return Returns true if the files are consistent, false otherwise
+     */
+
+    bool fs_concat_consistent ( fs_File_t const * const fsFileA, fs_File_t const * const fsFileB );
+
+    /*! \brief File records copy
+     *
+     *  This function appends the records of the provided file through the
+     *  writer, without reading them in user space. A line end is added to
+     *  text files lacking one.
+     *
+     *  \param  fsWriter    Writer structure
+     *  \param  fsFile      File structure
+     *
+     *  \return Returns the writer state
+     */
+
+    bool fs_concat_records ( lc_Writer_t * const fsWriter, fs_File_t const * const fsFile );
+
+    /*! \brief Files concatenation
+     *
+     *  This function creates the output file and concatenates the provided
+     *  files in it. The header of the first file is exported with the total
+     *  records count and, for matches files, the combined flags. Text files
+     *  receive a count line padded to a fixed width, allowing later in-place
+     *  appending, and carrying the truncation mark of the matches.
+     *
+     *  \param  fsFiles     Files to concatenate
+     *  \param  fsPath      Path of the output file
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_concat_merge ( std::vector < fs_File_t > const & fsFiles, char const * const fsPath );
+
+    /*! \brief Files appending
+     *
+     *  This function appends the records of the provided files to the output
+     *  file and updates its records count in place, so that the cost only
+     *  depends on the appended data. When the count line of a text output
+     *  file is too narrow for the new count, the file is rebuilt with a
+     *  padded count line.
+     *
+     *  \param  fsOutput    Output file structure
+     *  \param  fsFiles     Files to append
+     *  \param  fsPath      Path of the output file
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_concat_append ( fs_File_t const * const fsOutput, std::vector < fs_File_t > const & fsFiles, char const * const fsPath );
+
 /*
     Header - Include guard
  */
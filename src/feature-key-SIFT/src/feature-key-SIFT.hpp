@@ -103,6 +103,12 @@
     "Short arguments and parameters summary :\n\n"         \
     "\t-i\tInput image\n"                                  \
     "\t-o\tOutput keypoints file\n"                        \
+    "\t-b\tBinary keypoints file format\n"                 \
+    "\t-r\tSort keypoints by decreasing response\n"        \
+    "\t-d\tOutput descriptors file\n"                      \
+    "\t-S\tFeatures store to append to\n"                  \
+    "\t-I\tImage identifier in the store\n"                \
+    "\t-z\tDescriptors quantization scale\n"               \
     "\t-m\tSIFT nfeatures\n"                               \
     "\t-a\tSIFT nOctaveLayers\n"                           \
     "\t-c\tSIFT contrastThreshold\n"                       \
@@ -134,7 +140,13 @@
      *  The main function frame follows : parameters are initialized and read.
      *  The input image is imported in grayscale mode and the implementation of
      *  OpenCV SIFT is called to generate the keypoints. The keypoint list is
-     *  then exported in the output file.
+     *  then exported in the output file. The descriptors of the exported
+     *  keypoints can also be computed and exported in a descriptors file. They
+     *  can be quantized on unsigned 8 bits integers using a scale : as OpenCV
+     *  SIFT components are integers in [0,255], a unit scale is exact.
+     *  Keypoints can be sorted by decreasing response, so that any prefix of
+     *  the exported files holds the strongest keypoints, as expected by the
+     *  progressive matching of the matchers.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
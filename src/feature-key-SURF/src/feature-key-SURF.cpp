@@ -52,9 +52,13 @@
         /* Path strings */
         char * fsImgIPath( NULL );
         char * fsKeyOPath( NULL );
+        char * fsDscOPath( NULL );
+
+        /* Features store variables */
+        char * fsStore( NULL );
+        int    fsIdent( -1   );
 
         /* SIFT variables */
-        int   fsSURFexported ( 0   );
         int   fsSURFextended ( 1   );
         int   fsSURFupright  ( 0   );
         int   fsSURFlayers   ( 2   );
@@ -65,22 +69,36 @@
         int fsEdgeX ( 0 );
         int fsEdgeY ( 0 );
 
-        /* Output stream */
-        std::ofstream fsKeyfile;
+        /* Keyfile format */
+        int fsFormat ( LC_FORMAT_TEXT );
+
+        /* Keypoints ordering */
+        bool fsSort ( false );
+
+        /* Descriptors quantization scale */
+        float fsScale ( 0.0 );
 
         /* Image variable */
         cv::Mat fsImage;
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--input"   , "-i" ), argv, & fsImgIPath    , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--output"  , "-o" ), argv, & fsKeyOPath    , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--extended", "-t" ), argv, & fsSURFextended, LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--upright" , "-u" ), argv, & fsSURFupright , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--layer"   , "-l" ), argv, & fsSURFlayers  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--octave"  , "-a" ), argv, & fsSURFoctave  , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--hessian" , "-s" ), argv, & fsSURFhessian , LC_FLOAT  );
-        lc_stdp( lc_stda( argc, argv, "--edge-x"  , "-x" ), argv, & fsEdgeX       , LC_INT    );
-        lc_stdp( lc_stda( argc, argv, "--edge-y"  , "-y" ), argv, & fsEdgeY       , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--input"     , "-i" ), argv, & fsImgIPath    , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"    , "-o" ), argv, & fsKeyOPath    , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--descriptor", "-d" ), argv, & fsDscOPath    , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--store"     , "-S" ), argv, & fsStore       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--identifier", "-I" ), argv, & fsIdent       , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--extended"  , "-t" ), argv, & fsSURFextended, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--upright"   , "-u" ), argv, & fsSURFupright , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--layer"     , "-l" ), argv, & fsSURFlayers  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--octave"    , "-a" ), argv, & fsSURFoctave  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--hessian"   , "-s" ), argv, & fsSURFhessian , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--edge-x"    , "-x" ), argv, & fsEdgeX       , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--edge-y"    , "-y" ), argv, & fsEdgeY       , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--quantize"  , "-z" ), argv, & fsScale       , LC_FLOAT  );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--binary"  , "-b" ) ) fsFormat = LC_FORMAT_BINARY;
+        if ( lc_stda( argc, argv, "--response", "-r" ) ) fsSort   = true;
 
         /* Software swicth */
         if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
@@ -91,7 +109,7 @@
         } else {
 
             /* Verify path strings */
-            if ( ( fsImgIPath != NULL ) && ( fsKeyOPath != NULL ) ) {
+            if ( ( fsImgIPath != NULL ) && ( ( fsKeyOPath != NULL ) || ( fsStore != NULL ) ) && ( ( fsStore == NULL ) || ( fsIdent >= 0 ) ) ) {
 
                 /* Read input image */
                 fsImage = cv::imread( fsImgIPath, CV_LOAD_IMAGE_GRAYSCALE );
@@ -108,42 +126,60 @@
                     /* SIFT detection */
                     fsSURF.detect( fsImage, fsKey );
 
-                    /* Open keypoint output file */
-                    fsKeyfile.open( fsKeyOPath, std::ios::out );
+                    /* Filtered keypoint vector */
+                    std::vector < cv::KeyPoint > fsExport;
 
-                    /* Verify stream state */
-                    if ( fsKeyfile.is_open() == true ) {
+                    /* Apply geometric filtering */
+                    for ( unsigned int fsIndex( 0 ); fsIndex < fsKey.size(); fsIndex ++ ) {
 
-                        /* Export keypoint count */
-                        fsKeyfile << fsKey.size() << std::endl;
+                        /* Check keypoint position */
+                        if ( ( fsKey[fsIndex].pt.x >= fsEdgeX ) && ( fsKey[fsIndex].pt.x < fsImage.cols - fsEdgeX ) &&
+                             ( fsKey[fsIndex].pt.y >= fsEdgeY ) && ( fsKey[fsIndex].pt.y < fsImage.rows - fsEdgeY ) ) {
 
-                        /* Export results */
-                        for ( unsigned int fsIndex( 0 ); fsIndex < fsKey.size(); fsIndex ++ ) {
+                            /* Push exported keypoint */
+                            fsExport.push_back( fsKey[fsIndex] );
 
-                            /* Apply geometric filtering */
-                            if ( ( fsKey[fsIndex].pt.x >= fsEdgeX ) && ( fsKey[fsIndex].pt.x < fsImage.cols - fsEdgeX ) &&
-                                 ( fsKey[fsIndex].pt.y >= fsEdgeY ) && ( fsKey[fsIndex].pt.y < fsImage.rows - fsEdgeY ) ) {
+                        }
 
-                                /* Export keypoint coordinates */
-                                fsKeyfile << fsKey[fsIndex].pt.x     << " " 
-                                          << fsKey[fsIndex].pt.y     << " " 
-                                          << fsKey[fsIndex].size     << " "
-                                          << fsKey[fsIndex].angle    << " " 
-                                          << fsKey[fsIndex].response << " " 
-                                          << fsKey[fsIndex].octave   << std::endl; 
+                    }
 
-                                /* Increment exportation count */
-                                fsSURFexported ++;
+                    /* Sort keypoints by decreasing response - any prefix holds the strongest keypoints */
+                    if ( fsSort == true ) lc_keyfile_sort( fsExport );
 
-                            }
+                    /* Descriptors matrix */
+                    cv::Mat fsDescript;
 
-                        }
+                    /* Check descriptors exportation */
+                    if ( ( fsDscOPath != NULL ) || ( fsStore != NULL ) ) {
+
+                        /* Compute descriptors - keypoints without descriptor are removed */
+                        fsSURF.compute( fsImage, fsExport, fsDescript );
+
+                        /* Ensure descriptors matrix format */
+                        if ( fsDescript.empty() == true ) fsDescript.create( 0, fsSURF.descriptorSize(), CV_32FC1 );
+
+                        /* Quantize descriptors - the temporary header keeps floating point rows alive */
+                        if ( fsScale > 0.0 ) lc_quantize( cv::Mat( fsDescript ), fsDescript, LC_QUANTIZE_SIGNED, fsScale );
+
+                    }
+
+                    /* Export keypoints */
+                    if ( ( fsKeyOPath != NULL ) && ( lc_keyfile_write( fsKeyOPath, fsExport, fsFormat ) == false ) ) {
+
+                        /* Display message */
+                        std::cerr << "Error : Unable to write output file" << std::endl;
+
+                    } else if ( ( fsDscOPath != NULL ) && ( lc_descfile_write( fsDscOPath, fsDescript, fsScale ) == false ) ) {
+
+                        /* Display message */
+                        std::cerr << "Error : Unable to write descriptors file" << std::endl;
+
+                    } else if ( ( fsStore != NULL ) && ( lc_store_append( fsStore, fsIdent, fsExport, fsDescript, fsScale ) == false ) ) {
 
-                        /* Close output stream */
-                        fsKeyfile.close();
+                        /* Display message */
+                        std::cerr << "Error : Unable to append to features store" << std::endl;
 
-                    /* Display message */
-                    } else { std::cerr << "Error : Unable to write output file" << std::endl; }
+                    }
 
                 /* Display message */
                 } else { std::cerr << "Error : Unable to read input image" << std::endl; }
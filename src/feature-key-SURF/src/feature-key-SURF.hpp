@@ -103,6 +103,12 @@
     "Short arguments and parameters summary :\n\n"         \
     "\t-i\tInput image\n"                                  \
     "\t-o\tOutput keypoints file\n"                        \
+    "\t-b\tBinary keypoints file format\n"                 \
+    "\t-r\tSort keypoints by decreasing response\n"        \
+    "\t-d\tOutput descriptors file\n"                      \
+    "\t-S\tFeatures store to append to\n"                  \
+    "\t-I\tImage identifier in the store\n"                \
+    "\t-z\tDescriptors quantization scale\n"               \
     "\t-t\tSURF extended\n"                                \
     "\t-u\tSURF upright\n"                                 \
     "\t-l\tSURF nOctaveLayers\n"                           \
@@ -132,9 +138,15 @@
     /*! \brief Software main function (single function software)
      *  
      *  The main function frame follows : parameters are initialized and read.
-     *  The input image is imported in grayscale mode. The implementation of 
-     *  OpenCV SURF is then called to generate the keypoints list. The list is 
-     *  then exported in the output file.
+     *  The input image is imported in grayscale mode. The implementation of
+     *  OpenCV SURF is then called to generate the keypoints list. The list is
+     *  then exported in the output file. The descriptors of the exported
+     *  keypoints can also be computed and exported in a descriptors file. They
+     *  can be quantized on signed 8 bits integers using a scale, the components
+     *  of the unit SURF descriptors being in [-1,1]. Keypoints can be sorted by
+     *  decreasing response, so that any prefix of the exported files holds the
+     *  strongest keypoints, as expected by the progressive matching of the
+     *  matchers.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -0,0 +1,232 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "feature-key-pca.hpp"
+
+/*
+    Source - Entry point
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Path variables */
+        char * fsStore     ( NULL );
+        char * fsOutputfile( NULL );
+
+        /* Learning parameters variables */
+        unsigned int fsSample   ( LC_PCA_SAMPLE );
+        int          fsDimension( 0 );
+
+        /* Report parameters variables */
+        int fsQuery( FS_QUERY );
+        int fsStep ( FS_STEP  );
+
+        /* Store variables */
+        lc_Store_t fsFeature;
+
+        /* Basis variables */
+        lc_Pca_t fsPca;
+
+        /* Learning variables */
+        cv::Mat fsTrain;
+
+        /* Descriptors count variables */
+        uint64_t fsTotal( 0 );
+
+        /* Arguments and parameters handle */
+        lc_stdp( lc_stda( argc, argv, "--store"    , "-S" ), argv, & fsStore     , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"   , "-o" ), argv, & fsOutputfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--sample"   , "-s" ), argv, & fsSample    , LC_UINT   );
+        lc_stdp( lc_stda( argc, argv, "--dimension", "-d" ), argv, & fsDimension , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--query"    , "-q" ), argv, & fsQuery     , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--step"     , "-p" ), argv, & fsStep      , LC_INT    );
+
+        /* Software swicth */
+        if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
+
+            /* Display message */
+            std::cout << FS_HELP;
+
+        } else {
+
+            /* Verify path strings */
+            if ( ( fsStore != NULL ) && ( fsOutputfile != NULL ) ) {
+
+                /* Open features store */
+                if ( lc_store_open( fsStore, & fsFeature ) == true ) {
+
+                    /* Compose learning sample */
+                    if ( lc_store_sample( & fsFeature, fsSample, fsTrain, & fsTotal ) == true ) {
+
+                        /* Learn principal components */
+                        if ( lc_pca_learn( fsTrain, & fsPca ) == true ) {
+
+                            /* Report retained variance and recall */
+                            fs_pca_report( & fsPca, fsTrain, fsQuery, fsStep, fsDimension );
+
+                            /* Export leading components */
+                            if ( lc_pca_write( fsOutputfile, & fsPca, fsDimension ) == false ) {
+
+                                /* Display message */
+                                std::cerr << "Error : Unable to write basis file" << std::endl;
+
+                            }
+
+                        /* Display message */
+                        } else { std::cerr << "Error : Unable to learn principal components" << std::endl; }
+
+                    /* Display message */
+                    } else { std::cerr << "Error : Unable to compose learning sample" << std::endl; }
+
+                    /* Close features store */
+                    lc_store_close( & fsFeature );
+
+                /* Display message */
+                } else { std::cerr << "Error : Unable to open features store" << std::endl; }
+
+            /* Display message */
+            } else { std::cerr << "Error : Invalid path specification" << std::endl; }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Projection report
+ */
+
+    void fs_pca_report( lc_Pca_t const * const fsPca, cv::Mat const & fsSample, int const fsQuery, int const fsStep, int const fsDimension ) {
+
+        /* Full dimension variables */
+        int fsFull( fsPca->basis.rows );
+
+        /* Queries amount variables - half of the sample at most */
+        int fsCount( std::max( std::min( fsQuery, fsSample.rows / 2 ), 0 ) );
+
+        /* Reported dimensions variables */
+        std::set < int > fsReport;
+
+        /* Projection variables */
+        cv::Mat fsProject;
+
+        /* Full descriptors neighbours variables */
+        std::vector < cv::DMatch > fsExact;
+
+        /* Compose reported dimensions */
+        for ( int fsParse( std::max( fsStep, 1 ) ); fsParse < fsFull; fsParse += std::max( fsStep, 1 ) ) fsReport.insert( fsParse );
+
+        /* Push full and stored dimensions */
+        fsReport.insert( fsFull ); if ( ( fsDimension > 0 ) && ( fsDimension < fsFull ) ) fsReport.insert( fsDimension );
+
+        /* Check recall measure */
+        if ( fsCount > 0 ) {
+
+            /* Search full descriptors neighbours */
+            lc_brute_match( fsSample.rowRange( 0, fsCount ), fsSample.rowRange( fsCount, fsSample.rows ), fsExact );
+
+            /* Project sample on all components */
+            lc_pca_project( fsPca, fsSample, 0.0, 0, fsProject );
+
+        }
+
+        /* Report dimensions */
+        for ( std::set < int >::iterator fsIter( fsReport.begin() ); fsIter != fsReport.end(); fsIter ++ ) {
+
+            /* Recall variables */
+            double fsRecall( 0.0 );
+
+            /* Check recall measure */
+            if ( fsCount > 0 ) {
+
+                /* Leading coordinates variables */
+                cv::Mat fsLeadQuery;
+                cv::Mat fsLeadTrain;
+
+                /* Projected descriptors neighbours variables */
+                std::vector < cv::DMatch > fsNear;
+
+                /* Extract leading coordinates */
+                fs_pca_lead( fsProject, 0, fsCount, * fsIter, fsLeadQuery );
+                fs_pca_lead( fsProject, fsCount, fsSample.rows, * fsIter, fsLeadTrain );
+
+                /* Search projected descriptors neighbours */
+                lc_brute_match( fsLeadQuery, fsLeadTrain, fsNear );
+
+                /* Count retrieved neighbours */
+                for ( int fsParse( 0 ); fsParse < fsCount; fsParse ++ ) if ( fsNear[fsParse].trainIdx == fsExact[fsParse].trainIdx ) fsRecall += 1.0;
+
+                /* Compute recall */
+                fsRecall /= fsCount;
+
+            }
+
+            /* Display dimension report */
+            std::cout << "Dimension : " << * fsIter << " variance " << lc_pca_retained( fsPca, * fsIter );
+
+            /* Display recall */
+            if ( fsCount > 0 ) std::cout << " recall " << fsRecall;
+
+            /* Terminate report line */
+            std::cout << std::endl;
+
+        }
+
+    }
+
+/*
+    Source - Leading coordinates
+ */
+
+    void fs_pca_lead( cv::Mat const & fsProject, int const fsBegin, int const fsEnd, int const fsDimension, cv::Mat & fsLead ) {
+
+        /* Create leading coordinates matrix */
+        fsLead.create( fsEnd - fsBegin, fsDimension, CV_32FC1 );
+
+        /* Copy leading coordinates */
+        for ( int fsParse( fsBegin ); fsParse < fsEnd; fsParse ++ ) memcpy( fsLead.ptr < float > ( fsParse - fsBegin ), fsProject.ptr < float > ( fsParse ), fsDimension * sizeof( float ) );
+
+    }
+
@@ -0,0 +1,189 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   feature-key-pca.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *  
+     *  Software main header
+     */
+
+    /*! \mainpage feature-key-pca
+     *
+     *  \section feature-suite
+     *  \section _ Features detection suite
+     *  
+     *  The feature-suite provides tools in the context of automatic image 
+     *  matching. The suite is separated into small softwares that solve a
+     *  specific part of the problem. It is designed so in order to perform 
+     *  research using each software as a brick of the overall solver.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/feature-suite/wiki.
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __FS_KEY_PCA__
+    # define __FS_KEY_PCA__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <vector>
+    # include <set>
+    # include <cstdlib>
+    # include <common-all.hpp>
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define FS_HELP "Usage summary :\n\n"                   \
+    "\tfeature-key-pca [Arguments] [Parameters] ...\n\n"     \
+    "Short arguments and parameters summary :\n\n"           \
+    "\t-S\tInput features store\n"                           \
+    "\t-o\tOutput basis file\n"                              \
+    "\t-s\tLearning sample size\n"                           \
+    "\t-d\tAmount of stored components\n"                    \
+    "\t-q\tAmount of recall queries\n"                       \
+    "\t-p\tReported dimensions step\n\n"                     \
+    "feature-key-pca - feature-suite\n"                      \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Default amount of recall queries */
+    # define FS_QUERY       1024
+
+    /* Default reported dimensions step */
+    # define FS_STEP        8
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function frame follows : parameters are initialized and read.
+     *  The principal components basis is learned on a sample of the features
+     *  store descriptors. The variance retained by the leading components and
+     *  the recall of the nearest neighbours found with projected descriptors
+     *  against the ones found with full descriptors are reported for a range
+     *  of dimensions, so that the projection dimension of the match tools can
+     *  be chosen. The leading components are then written in the basis file.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Projection report
+     *
+     *  This function reports, for each multiple of the step and for the
+     *  stored dimension, the variance retained by the leading components and
+     *  the recall of the projected nearest neighbours. The first descriptors
+     *  of the sample are the queries and the others the train descriptors.
+     *  The recall is the fraction of queries whose nearest train descriptor,
+     *  searched with projected descriptors, is the one found with the full
+     *  descriptors.
+     *
+     *  \param  fsPca       Basis structure
+     *  \param  fsSample    Learning descriptors matrix
+     *  \param  fsQuery     Amount of recall queries, recall disabled if zero
+     *  \param  fsStep      Reported dimensions step
+     *  \param  fsDimension Amount of stored components
+     */
+
+    void fs_pca_report ( lc_Pca_t const * const fsPca, cv::Mat const & fsSample, int const fsQuery, int const fsStep, int const fsDimension );
+
+    /*! \brief Leading coordinates
+     *
+     *  This function extracts the leading coordinates of a range of rows of
+     *  projected descriptors.
+     *
+     *  \param  fsProject   Projected descriptors matrix
+     *  \param  fsBegin     First extracted row
+     *  \param  fsEnd       Row following the last extracted one
+     *  \param  fsDimension Amount of leading coordinates
+     *  \param  fsLead      Matrix receiving the leading coordinates
+     */
+
+    void fs_pca_lead ( cv::Mat const & fsProject, int const fsBegin, int const fsEnd, int const fsDimension, cv::Mat & fsLead );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
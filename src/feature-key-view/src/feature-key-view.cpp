@@ -54,17 +54,6 @@
         char * fsImgOPath( NULL );
         char * fsKeyIPath( NULL );
 
-        /* Keypoint coordinates */
-        float fsKeyX ( 0.0 );
-        float fsKeyY ( 0.0 );
-        float fsVoid ( 0.0 );
-
-        /* Keypoint matrix size */
-        int fsRows ( 0 );
-
-        /* Input stream */
-        std::ifstream fsKeyfile;
-
         /* Image variable */
         cv::Mat fsImage;
 
@@ -93,29 +82,20 @@
                     /* Convert image to RGB */
                     cvtColor( fsImage, fsImage, CV_GRAY2RGB );
 
-                    /* Open keypoint output file */
-                    fsKeyfile.open( fsKeyIPath, std::ios::in );
+                    /* Read keypoints */
+                    std::vector < cv::KeyPoint > fsKey = lc_keyfile_read( fsKeyIPath );
 
-                    /* Verify stream state */
-                    if ( fsKeyfile.is_open() == true ) {
+                    /* Verify keyfile reading */
+                    if ( fsKey.size() > 0 ) {
 
-                        /* Read keypoint count */
-                        fsKeyfile >> fsRows;
-
-                        /* Export results */
-                        for ( int fsIndex( 0 ); fsIndex < fsRows; fsIndex ++ ) {
-
-                            /* Read current keypoint */
-                            fsKeyfile >> fsKeyX >> fsKeyY >> fsVoid >> fsVoid >> fsVoid >> fsVoid;
+                        /* Draw keypoints */
+                        for ( unsigned int fsIndex( 0 ); fsIndex < fsKey.size(); fsIndex ++ ) {
 
                             /* Draw cricle in image */
-                            cv::circle( fsImage, cv::Point2f( fsKeyX, fsKeyY ), 4, cv::Scalar( 0, 177, 235 ) );
+                            cv::circle( fsImage, fsKey[fsIndex].pt, 4, cv::Scalar( 0, 177, 235 ) );
 
                         }
 
-                        /* Close output stream */
-                        fsKeyfile.close();
-
                         /* Write result image */
                         if ( imwrite( fsImgOPath, fsImage ) == false ) {
 
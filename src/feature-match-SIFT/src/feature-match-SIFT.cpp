@@ -52,22 +52,117 @@
         /* Path variables */
         char * fsImAIPath( NULL );
         char * fsKeAIPath( NULL );
+        char * fsDeAIPath( NULL );
         char * fsImBIPath( NULL );
         char * fsKeBIPath( NULL );
+        char * fsDeBIPath( NULL );
         char * fsMatOPath( NULL );
 
-        /* Image variable */
-        cv::Mat fsImageA, fsImageB;
+        /* Database variables */
+        char * fsImageB( NULL );
+
+        /* Pairs list variables */
+        char * fsList( NULL );
+
+        /* Pair regions variables */
+        char * fsRegionA( NULL );
+        char * fsRegionB( NULL );
+
+        /* Pair regions */
+        cv::Rect fsRectA;
+        cv::Rect fsRectB;
+
+        /* Features store variables */
+        int fsIdentA( -1 );
+        int fsIdentB( -1 );
+
+        /* Features store structure */
+        lc_Store_t fsFeatures = { { -1, 0, NULL }, { -1, 0, NULL } };
+
+        /* Matching options */
+        fs_Option_t fsOption;
 
-        /* Output stream variable */
-        std::ofstream fsMatchfile;
+        /* Matching options - paths */
+        fsOption.store       = NULL;
+        fsOption.database    = NULL;
+        fsOption.imageA      = NULL;
+        fsOption.tuning      = NULL;
+        fsOption.basis       = NULL;
+
+        /* Matching options - switches */
+        fsOption.format      = LC_FORMAT_TEXT;
+        fsOption.exact       = false;
+        fsOption.persist     = false;
+        fsOption.mutual      = false;
+        fsOption.recall      = false;
+        fsOption.quantize    = false;
+        fsOption.bucket      = false;
+        fsOption.vptree      = false;
+        fsOption.subset      = false;
+
+        /* Matching options - parameters */
+        fsOption.octave      = LC_BUCKET_OCTAVE;
+        fsOption.angle       = LC_BUCKET_ANGLE;
+        fsOption.sketch      = 0;
+        fsOption.dimension   = 0;
+        fsOption.progressive = 0;
+        fsOption.support     = LC_FILTER_SUPPORT;
+        fsOption.deadline    = 0;
+        fsOption.scale       = 0.0;
+        fsOption.target      = 0.0;
+        fsOption.ratio       = 0.0;
+
+        /* Matching options - index configuration */
+        fsOption.config.type   = LC_FLANN_KDTREE;
+        fsOption.config.trees  = LC_FLANN_TREES;
+        fsOption.config.branch = LC_FLANN_BRANCH;
+        fsOption.config.checks = LC_FLANN_CHECKS;
+
+        /* Resident first image */
+        fs_Query_t fsQuery;
+
+        /* Second images array */
+        std::vector < fs_Pair_t > fsPair;
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv,  "--input-a"  , "-i" ), argv, & fsImAIPath, LC_STRING );
-        lc_stdp( lc_stda( argc, argv,  "--input-b"  , "-j" ), argv, & fsImBIPath, LC_STRING );
-        lc_stdp( lc_stda( argc, argv,  "--keyfile-a", "-k" ), argv, & fsKeAIPath, LC_STRING );
-        lc_stdp( lc_stda( argc, argv,  "--keyfile-b", "-l" ), argv, & fsKeBIPath, LC_STRING );
-        lc_stdp( lc_stda( argc, argv,  "--output"   , "-o" ), argv, & fsMatOPath, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--input-a"     , "-i" ), argv, & fsImAIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--input-b"     , "-j" ), argv, & fsImBIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--keyfile-a"   , "-k" ), argv, & fsKeAIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--keyfile-b"   , "-l" ), argv, & fsKeBIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--descriptor-a", "-p" ), argv, & fsDeAIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--descriptor-b", "-q" ), argv, & fsDeBIPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"      , "-o" ), argv, & fsMatOPath       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-o"  , "-O" ), argv, & fsOption.database, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-a"      , "-A" ), argv, & fsOption.imageA  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-b"      , "-B" ), argv, & fsImageB         , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--store"       , "-S" ), argv, & fsOption.store   , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--identifier-a", "-K" ), argv, & fsIdentA         , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--identifier-b", "-L" ), argv, & fsIdentB         , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--many"        , "-M" ), argv, & fsList           , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--region-a"    , "-X" ), argv, & fsRegionA        , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--region-b"    , "-Y" ), argv, & fsRegionB        , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--quantize"    , "-z" ), argv, & fsOption.scale   , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--autotune"    , "-t" ), argv, & fsOption.target  , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--tuning"      , "-c" ), argv, & fsOption.tuning  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--ratio"       , "-d" ), argv, & fsOption.ratio   , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--octave"      , "-g" ), argv, & fsOption.octave  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--angle"       , "-a" ), argv, & fsOption.angle   , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--sketch"      , "-s" ), argv, & fsOption.sketch  , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--basis"       , "-P" ), argv, & fsOption.basis   , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--dimension"   , "-D" ), argv, & fsOption.dimension, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--progressive" , "-T" ), argv, & fsOption.progressive, LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--support"     , "-N" ), argv, & fsOption.support , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--deadline"    , "-W" ), argv, & fsOption.deadline, LC_INT    );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--binary"   , "-b" ) ) fsOption.format   = LC_FORMAT_BINARY;
+        if ( lc_stda( argc, argv, "--exact"    , "-e" ) ) fsOption.exact    = true;
+        if ( lc_stda( argc, argv, "--recall"   , "-r" ) ) fsOption.recall   = true;
+        if ( lc_stda( argc, argv, "--quantized", "-Q" ) ) fsOption.quantize = true;
+        if ( lc_stda( argc, argv, "--index"    , "-n" ) ) fsOption.persist  = true;
+        if ( lc_stda( argc, argv, "--mutual"   , "-m" ) ) fsOption.mutual   = true;
+        if ( lc_stda( argc, argv, "--bucket"   , "-u" ) ) fsOption.bucket   = true;
+        if ( lc_stda( argc, argv, "--vptree"   , "-v" ) ) fsOption.vptree   = true;
 
         /* Software swicth */
         if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
@@ -75,79 +170,137 @@
             /* Display message */
             std::cout << FS_HELP;
 
+        } else if ( ( fs_matchSIFT_region( fsRegionA, fsRectA ) == false ) || ( fs_matchSIFT_region( fsRegionB, fsRectB ) == false ) ) {
+
+            /* Display message */
+            std::cerr << "Error : Invalid region specification" << std::endl;
+
         } else {
 
-            /* Verify path strings */
-            if ( ( fsImAIPath != NULL ) && ( fsKeAIPath != NULL ) && ( fsImBIPath != NULL ) && ( fsKeBIPath != NULL ) && ( fsMatOPath != NULL ) ) {
-    
-                /* Read input image */
-                fsImageA = cv::imread( fsImAIPath, CV_LOAD_IMAGE_GRAYSCALE );
-                fsImageB = cv::imread( fsImBIPath, CV_LOAD_IMAGE_GRAYSCALE );
+            /* Verify path strings - first image, second images and destinations */
+            if ( ( ( ( fsOption.store != NULL ) && ( fsIdentA >= 0 ) ) || ( ( ( fsImAIPath != NULL ) || ( fsDeAIPath != NULL ) ) && ( fsKeAIPath != NULL ) ) ) && ( ( fsOption.database == NULL ) || ( fsOption.imageA != NULL ) ) &&
+                 ( ( fsList != NULL ) || ( ( ( ( fsOption.store != NULL ) && ( fsIdentB >= 0 ) ) || ( ( ( fsImBIPath != NULL ) || ( fsDeBIPath != NULL ) ) && ( fsKeBIPath != NULL ) ) ) && ( ( ( fsOption.database == NULL ) ? fsMatOPath : fsImageB ) != NULL ) ) ) ) {
 
-                /* Verify image reading */
-                if ( ( fsImageA.data != NULL ) && ( fsImageB.data != NULL ) ) {
+                /* Reset first image descriptors mapping */
+                fsQuery.map.handle = -1;
+                fsQuery.map.size   = 0;
+                fsQuery.map.data   = NULL;
 
-                    /* Keypoint vectors */
-                    std::vector < cv::KeyPoint > fsKeyA = fs_matchSIFT_readkey( fsKeAIPath );
-                    std::vector < cv::KeyPoint > fsKeyB = fs_matchSIFT_readkey( fsKeBIPath );
+                /* Reset first image quantization scale */
+                fsQuery.scale = 0.0;
 
-                    /* Verify keyfile reading */
-                    if ( ( fsKeyA.size() > 0 ) && ( fsKeyB.size() > 0 ) ) {
+                /* Reset first image index availability */
+                fsQuery.indexed = false;
 
-                        /* Instance SIFT detector */
-                        cv::SIFT fsSift;
+                /* Check features source */
+                if ( fsOption.store != NULL ) {
 
-                        /* Instance SIFT descriptor */
-                        cv::Mat fsDescriptA, fsDescriptB;
+                    /* Open features store */
+                    if ( lc_store_open( fsOption.store, & fsFeatures ) == true ) {
 
-                        /* Instance match feature */
-                        cv::FlannBasedMatcher fsMatcher;
+                        /* Read first image features - descriptors stay in the shared store mapping */
+                        lc_store_read( & fsFeatures, fsIdentA, fsQuery.key, fsQuery.desc );
 
-                        /* Instance matches array */
-                        std::vector < cv::DMatch > fsMatches;
+                        /* Retrieve descriptors quantization scale */
+                        fsQuery.scale = lc_store_scale( & fsFeatures );
 
-                        /* Compute images descriptors */
-                        fsSift.compute( fsImageA, fsKeyA, fsDescriptA );
-                        fsSift.compute( fsImageB, fsKeyB, fsDescriptB );
+                    }
 
-                        /* Compute matches */
-                        fsMatcher.match( fsDescriptA, fsDescriptB, fsMatches );
+                } else {
 
-                        /* Open output match file */
-                        fsMatchfile.open( fsMatOPath );
+                    /* Import keypoints */
+                    fsQuery.key = lc_keyfile_read( fsKeAIPath );
 
-                        /* Verify file openning */
-                        if ( fsMatchfile.is_open() == true ) {
+                }
 
-                            /* Export match count */
-                            fsMatchfile << fsMatches.size() << std::endl;
+                /* Verify keyfile reading */
+                if ( fsQuery.key.size() > 0 ) {
 
-                            /* Export match coordinates */
-                            for ( unsigned int fsIndex( 0 ); fsIndex < fsMatches.size(); fsIndex ++ ) {
+                    /* Check second images source */
+                    if ( fsList == NULL ) {
 
-                                /* Export match index */
-                                fsMatchfile << fsMatches[fsIndex].queryIdx << " "
-                                            << fsMatches[fsIndex].trainIdx << " ";
+                        /* Second image structure */
+                        fs_Pair_t fsSingle = { fsIdentB, "", "", "", ( fsOption.database == NULL ) ? fsMatOPath : fsImageB, fsRectA, fsRectB };
 
-                                /* Export match coordinates */
-                                fsMatchfile << fsKeyA[fsMatches[fsIndex].queryIdx].pt.x << " " 
-                                            << fsKeyA[fsMatches[fsIndex].queryIdx].pt.y << " "
-                                            << fsKeyB[fsMatches[fsIndex].trainIdx].pt.x << " " 
-                                            << fsKeyB[fsMatches[fsIndex].trainIdx].pt.y << std::endl;
+                        /* Assign second image paths */
+                        if ( fsKeBIPath != NULL ) fsSingle.keyfile  = fsKeBIPath;
+                        if ( fsImBIPath != NULL ) fsSingle.image    = fsImBIPath;
+                        if ( fsDeBIPath != NULL ) fsSingle.descfile = fsDeBIPath;
 
-                            }
+                        /* Push second image */
+                        fsPair.push_back( fsSingle );
+
+                    }
+
+                    /* Read second images list */
+                    if ( ( fsList == NULL ) || ( fs_matchSIFT_list( fsList, fsOption.store != NULL, fsPair ) == true ) ) {
+
+                        /* Detect subsets matching - progressive matching and pair regions match subsets of the keypoints */
+                        fsOption.subset = ( fsOption.progressive > 0 );
+
+                        /* Detect pair regions */
+                        for ( size_t fsParse( 0 ); fsParse < fsPair.size(); fsParse ++ ) if ( ( fsPair[fsParse].regionA.area() > 0 ) || ( fsPair[fsParse].regionB.area() > 0 ) ) fsOption.subset = true;
+
+                        /* Obtain keypoints descriptors - first image is described once, lazily for subsets matching */
+                        if ( ( fsOption.store != NULL ) || ( fs_matchSIFT_descriptor( fsImAIPath, fsDeAIPath, fsQuery.key, fsQuery.desc, & fsQuery.map, & fsQuery.scale, ( fsOption.subset == true ) ? & fsQuery.lazy : NULL ) == true ) ) {
+
+                            /* Read projection basis */
+                            if ( ( fsOption.basis == NULL ) || ( lc_pca_read( fsOption.basis, & fsOption.pca ) == true ) ) {
+
+                                /* Derive dataset quantization scale from first image descriptors - explicit scales override */
+                                if ( ( fsOption.quantize == true ) && ( fsOption.scale <= 0.0 ) && ( fsOption.basis == NULL ) && ( fsQuery.scale <= 0.0 ) ) fsOption.scale = lc_quantize_scale( fsQuery.desc, LC_QUANTIZE_UNSIGNED );
 
-                            /* Close file */
-                            fsMatchfile.close();
+                                /* Check quantization scale - lazily described first images have no descriptors to derive it */
+                                if ( ( fsOption.quantize == false ) || ( fsOption.scale > 0.0 ) || ( fsOption.basis != NULL ) || ( fsQuery.scale > 0.0 ) ) {
+
+                                    /* Prepare first image descriptors - subsets are prepared by the pairs at each stage */
+                                    if ( ( fsOption.subset == true ) || ( fs_matchSIFT_prepare( & fsQuery, & fsOption ) == true ) ) {
+
+                                        /* Check index configuration source - auto-tuning is performed on each pair */
+                                        if ( ( fsOption.target <= 0.0 ) && ( fsOption.tuning != NULL ) && ( lc_flann_read( fsOption.tuning, & fsOption.config ) == false ) ) {
+
+                                            /* Display message */
+                                            std::cerr << "Error : Unable to read index configuration" << std::endl;
+
+                                        }
+
+                                        /* Build first image descriptors structures once for the reverse searches - subsets have their own */
+                                        if ( fsOption.subset == false ) fs_matchSIFT_reverse( & fsQuery, & fsOption, & fsOption.config );
+
+                                        /* Match second images - parallel pairs share the resident first image */
+                                        # ifdef __OPENMP__
+                                        # pragma omp parallel for schedule( dynamic )
+                                        # endif
+                                        for ( int fsParse = 0; fsParse < ( int ) fsPair.size(); fsParse ++ ) {
+
+                                            /* Match pair */
+                                            fs_matchSIFT_pair( & fsQuery, & fsPair[fsParse], & fsOption, ( fsOption.store != NULL ) ? & fsFeatures : NULL );
+
+                                        }
+
+                                    /* Display message */
+                                    } else { std::cerr << "Error : Inconsistent projection basis" << std::endl; }
+
+                                /* Display message */
+                                } else { std::cerr << "Error : Unable to derive quantization scale from first image descriptors" << std::endl; }
+
+                            /* Display message */
+                            } else { std::cerr << "Error : Unable to read projection basis" << std::endl; }
 
                         /* Display message */
-                        } else { std::cerr << "Error : Unable to write output matchfile" << std::endl; }                
+                        } else { std::cerr << "Error : Unable to read input images or descriptors files" << std::endl; }
 
                     /* Display message */
-                    } else { std::cerr << "Error : Unable to read input keyfiles" << std::endl; }
+                    } else { std::cerr << "Error : Unable to read second images list" << std::endl; }
+
+                    /* Release descriptors mapping */
+                    lc_map_close( & fsQuery.map );
 
                 /* Display message */
-                } else { std::cerr << "Error : Unable to read input images" << std::endl; }
+                } else { std::cerr << "Error : Unable to read input keyfiles" << std::endl; }
+
+                /* Release features store */
+                lc_store_close( & fsFeatures );
 
             /* Display message */
             } else { std::cerr << "Error : Invalid path specification" << std::endl; }
@@ -160,47 +313,885 @@
     }
 
 /*
-    Source - Read keypoint file
-*/
+    Source - Pair region
+ */
+
+    bool fs_matchSIFT_region( char const * const fsSpec, cv::Rect & fsRegion ) {
+
+        /* Parsed length variables */
+        int fsLength( 0 );
+
+        /* Check specification - whole image by default */
+        if ( fsSpec == NULL ) return( true );
+
+        /* Read region position and size */
+        if ( sscanf( fsSpec, "%d,%d,%d,%d%n", & fsRegion.x, & fsRegion.y, & fsRegion.width, & fsRegion.height, & fsLength ) != 4 ) return( false );
+
+        /* Check specification end and region size */
+        return( ( fsSpec[fsLength] == '\0' ) && ( fsRegion.width > 0 ) && ( fsRegion.height > 0 ) );
 
-    std::vector < cv::KeyPoint > fs_matchSIFT_readkey( char const * const fsKeyfile ) {
+    }
+
+/*
+    Source - Pair regions
+ */
 
-        /* Instance return variable */
-        std::vector < cv::KeyPoint > fsKey;
+    bool fs_matchSIFT_regions( std::istream & fsToken, cv::Rect & fsRegionA, cv::Rect & fsRegionB ) {
 
-        /* File stream variable */
-        std::ifstream fsFile( fsKeyfile, std::ios::in );
+        /* Regions variables */
+        cv::Rect * fsRegion[2] = { & fsRegionA, & fsRegionB };
 
-        /* Size parameters */
-        int fsRows ( 0 ), fsCols ( 0 );
+        /* Parse regions */
+        for ( int fsParse( 0 ); fsParse < 2; fsParse ++ ) {
 
-        /* Reading variable */
-        float fsX ( 0.0 ), fsY ( 0.0 ), fsSize ( 0.0 ), fsAngle ( 0.0 ), fsResponse ( 0.0 ), fsOctave ( 0.0 );
+            /* Check remaining tokens - regions are optional */
+            if ( ( fsToken >> std::ws ).eof() == true ) return( true );
 
-        /* Verify file */
-        if ( fsFile.is_open() == true ) {
+            /* Read region position and size */
+            if ( ! ( fsToken >> fsRegion[fsParse]->x >> fsRegion[fsParse]->y >> fsRegion[fsParse]->width >> fsRegion[fsParse]->height ) ) return( false );
 
-            /* Read parameters */
-            fsFile >> fsRows >> fsCols;
+            /* Check region size */
+            if ( ( fsRegion[fsParse]->width <= 0 ) || ( fsRegion[fsParse]->height <= 0 ) ) return( false );
 
-            /* Reading keypoints */
-            for ( int fsIndex( 0 ); fsIndex < fsRows; fsIndex ++ ) {
+        }
 
-                /* Read keypoints */
-                fsFile >> fsX >> fsY >> fsSize >> fsAngle >> fsResponse >> fsOctave;
+        /* Check line end */
+        return( ( fsToken >> std::ws ).eof() );
 
-                /* Push keypoint */
-                fsKey.push_back( cv::KeyPoint( cv::Point2f( fsX, fsY ), fsSize, fsAngle, fsResponse, fsOctave ) );
+    }
+
+/*
+    Source - Second images list
+ */
+
+    bool fs_matchSIFT_list( char const * const fsPath, bool const fsStore, std::vector < fs_Pair_t > & fsPair ) {
+
+        /* Stream variables */
+        std::ifstream fsStream( fsPath );
+
+        /* Line variables */
+        std::string fsLine;
+
+        /* Check stream */
+        if ( fsStream.is_open() == false ) return( false );
+
+        /* Parse list lines */
+        while ( std::getline( fsStream, fsLine ) ) {
+
+            /* Line stream */
+            std::istringstream fsToken( fsLine );
+
+            /* Second image structure */
+            fs_Pair_t fsItem = { -1, "", "", "", "", cv::Rect(), cv::Rect() };
+
+            /* Source path variables */
+            std::string fsSource;
+
+            /* Source mapping variables */
+            lc_Map_t fsMap = { -1, 0, NULL };
+
+            /* Check features source */
+            if ( fsStore == true ) {
+
+                /* Read store identifier and destination */
+                if ( ! ( fsToken >> fsItem.ident >> fsItem.output ) ) continue;
+
+            } else {
+
+                /* Read keyfile, source and destination */
+                if ( ! ( fsToken >> fsItem.keyfile >> fsSource >> fsItem.output ) ) continue;
+
+                /* Detect descriptors file source */
+                if ( ( lc_map_open( fsSource.c_str(), & fsMap ) == true ) && ( lc_format_detect( & fsMap, LC_DESCFILE_MAGIC ) == true ) ) {
+
+                    /* Assign descriptors file */
+                    fsItem.descfile = fsSource;
+
+                /* Assign image */
+                } else { fsItem.image = fsSource; }
+
+                /* Release source mapping */
+                lc_map_close( & fsMap );
+
+            }
+
+            /* Read optional pair regions - first image region, then second image one */
+            if ( fs_matchSIFT_regions( fsToken, fsItem.regionA, fsItem.regionB ) == false ) {
+
+                /* Display message */
+                std::cerr << "Error : Invalid region specification - " << fsLine << std::endl;
+
+                /* Skip line */
+                continue;
 
             }
 
-            /* Close stream */
-            fsFile.close();
+            /* Push second image */
+            fsPair.push_back( fsItem );
 
         }
 
-        /* Return readed keypoints */
-        return( fsKey );
+        /* Return list state */
+        return( fsPair.size() > 0 );
+
+    }
+
+/*
+    Source - Pair matching
+ */
+
+    void fs_matchSIFT_pair( fs_Query_t * const fsQuery, fs_Pair_t const * const fsPair, fs_Option_t const * const fsOption, lc_Store_t const * const fsStore ) {
+
+        /* Second image paths */
+        char const * fsImBIPath( fsPair->image.empty()    ? NULL : fsPair->image.c_str()    );
+        char const * fsKeBIPath( fsPair->keyfile.empty()  ? NULL : fsPair->keyfile.c_str()  );
+        char const * fsDeBIPath( fsPair->descfile.empty() ? NULL : fsPair->descfile.c_str() );
+
+        /* Deadline of the pair - time budget measured from the pair start */
+        std::chrono::steady_clock::time_point fsDeadline( ( fsOption->deadline > 0 ) ? std::chrono::steady_clock::now() + std::chrono::milliseconds( fsOption->deadline ) : std::chrono::steady_clock::time_point::max() );
+
+        /* Second image features */
+        fs_Query_t fsTrain;
+
+        /* Subsets keypoints indexes */
+        std::vector < int > fsSelectA;
+        std::vector < int > fsSelectB;
+
+        /* Matches array */
+        std::vector < lc_Match_t > fsMatch;
+
+        /* Leading keypoints of the stage - all keypoints without progressive matching */
+        int fsLimit( fsOption->progressive );
+
+        /* Stages variables */
+        bool fsStage( true );
+
+        /* Truncation variables - deadline reached before completion */
+        bool fsTruncated( false );
+
+        /* Index configuration of the pair */
+        lc_Flann_t fsConfig( fsOption->config );
+
+        /* Message variables */
+        char const * fsError( NULL );
+
+        /* Reset second image descriptors mapping */
+        fsTrain.map.handle = -1;
+        fsTrain.map.size   = 0;
+        fsTrain.map.data   = NULL;
+
+        /* Reset second image quantization scale */
+        fsTrain.scale = 0.0;
+
+        /* Check features source */
+        if ( fsStore != NULL ) {
+
+            /* Read second image features */
+            lc_store_read( fsStore, fsPair->ident, fsTrain.key, fsTrain.desc );
+
+            /* Retrieve descriptors quantization scale */
+            fsTrain.scale = lc_store_scale( fsStore );
+
+        /* Import keypoints */
+        } else { fsTrain.key = lc_keyfile_read( fsKeBIPath ); }
+
+        /* Verify keyfile reading */
+        if ( fsTrain.key.size() > 0 ) {
+
+            /* Obtain keypoints descriptors - lazily for subsets matching */
+            if ( ( fsStore != NULL ) || ( fs_matchSIFT_descriptor( fsImBIPath, fsDeBIPath, fsTrain.key, fsTrain.desc, & fsTrain.map, & fsTrain.scale, ( fsOption->subset == true ) ? & fsTrain.lazy : NULL ) == true ) ) {
+
+                /* Prepare second image descriptors - subsets are prepared at each stage */
+                if ( ( fsOption->subset == true ) || ( fs_matchSIFT_prepare( & fsTrain, fsOption ) == true ) ) {
+
+                    /* Match pair stages - a single stage without progressive matching */
+                    while ( ( fsStage == true ) && ( fsError == NULL ) ) {
+
+                        /* Subsets of the stage */
+                        fs_Query_t fsSubsetA;
+                        fs_Query_t fsSubsetB;
+
+                        /* Images of the stage - whole images or their subsets */
+                        fs_Query_t * fsFirst ( fsQuery   );
+                        fs_Query_t * fsSecond( & fsTrain );
+
+                        /* Matches of the stage */
+                        std::vector < cv::DMatch > fsMatches;
+
+                        /* Last stage detection - all keypoints considered */
+                        bool fsLast( ( fsLimit <= 0 ) || ( ( size_t ) fsLimit >= std::max( fsQuery->key.size(), fsTrain.key.size() ) ) );
+
+                        /* Check subsets matching */
+                        if ( fsOption->subset == true ) {
+
+                            /* Gather first image subset - the resident image is described for all pairs */
+                            # ifdef __OPENMP__
+                            # pragma omp critical ( fs_resident )
+                            # endif
+                            fs_matchSIFT_subset( fsQuery, fsPair->regionA, fsLimit, fsSelectA, & fsSubsetA );
+
+                            /* Gather second image subset */
+                            fs_matchSIFT_subset( & fsTrain, fsPair->regionB, fsLimit, fsSelectB, & fsSubsetB );
+
+                            /* Prepare subsets descriptors */
+                            if ( ( fs_matchSIFT_prepare( & fsSubsetA, fsOption ) == true ) && ( fs_matchSIFT_prepare( & fsSubsetB, fsOption ) == true ) ) {
+
+                                /* Build first image subset structures for the reverse searches */
+                                if ( fsSubsetA.key.size() > 0 ) fs_matchSIFT_reverse( & fsSubsetA, fsOption, & fsConfig );
+
+                            /* Display message */
+                            } else { fsError = "Inconsistent projection basis"; }
+
+                            /* Match the subsets */
+                            fsFirst  = & fsSubsetA;
+                            fsSecond = & fsSubsetB;
+
+                        }
+
+                        /* Match stage images - stages without keypoints are skipped until the last one */
+                        if ( ( fsError == NULL ) && ( ( fsLast == true ) || ( ( fsFirst->key.size() > 0 ) && ( fsSecond->key.size() > 0 ) ) ) ) {
+
+                            /* Search and filter matches */
+                            fsError = fs_matchSIFT_match( fsFirst, fsSecond, fsPair, fsOption, & fsConfig, fsDeadline, & fsTruncated, fsMatches );
+
+                        }
+
+                        /* Matches of the stage replace the previous ones - a truncated stage only if it found more matches */
+                        if ( ( fsTruncated == false ) || ( fsMatches.size() > fsMatch.size() ) ) {
+
+                            /* Assign matches count */
+                            fsMatch.resize( fsMatches.size() );
+
+                            /* Convert matches */
+                            for ( unsigned int fsIndex( 0 ); fsIndex < fsMatches.size(); fsIndex ++ ) {
+
+                                /* Assign match index */
+                                fsMatch[fsIndex].ai = ( fsOption->subset == true ) ? fsSelectA[fsMatches[fsIndex].queryIdx] : fsMatches[fsIndex].queryIdx;
+                                fsMatch[fsIndex].bi = ( fsOption->subset == true ) ? fsSelectB[fsMatches[fsIndex].trainIdx] : fsMatches[fsIndex].trainIdx;
+
+                                /* Assign match coordinates */
+                                fsMatch[fsIndex].ax = fsFirst->key[fsMatches[fsIndex].queryIdx].pt.x;
+                                fsMatch[fsIndex].ay = fsFirst->key[fsMatches[fsIndex].queryIdx].pt.y;
+                                fsMatch[fsIndex].bx = fsSecond->key[fsMatches[fsIndex].trainIdx].pt.x;
+                                fsMatch[fsIndex].by = fsSecond->key[fsMatches[fsIndex].trainIdx].pt.y;
+
+                            }
+
+                        }
+
+                        /* Check progressive matching - a truncated stage is the last one */
+                        if ( ( fsLast == false ) && ( fsTruncated == false ) ) {
+
+                            /* Geometric support of the stage matches */
+                            int fsSupport( fs_matchSIFT_support( fsMatch ) );
+
+                            /* Stop on sufficient support - otherwise double the leading keypoints */
+                            if ( fsSupport >= fsOption->support ) fsStage = false; else fsLimit *= 2;
+
+                            /* Check deadline - the remaining stages are not matched */
+                            if ( ( fsStage == true ) && ( std::chrono::steady_clock::now() >= fsDeadline ) ) {
+
+                                /* Stop on the current stage matches */
+                                fsStage = false; fsTruncated = true;
+
+                            }
+
+                        /* Last stage */
+                        } else { fsStage = false; }
+
+                    }
+
+                    /* Export matches */
+                    if ( ( fsError == NULL ) && ( fs_matchSIFT_export( fsOption, fsPair->output.c_str(), fsMatch, ( fsTruncated == true ) ? LC_MATCHFILE_TRUNCATED : 0 ) == false ) ) {
+
+                        /* Display message */
+                        fsError = "Unable to write output matches";
+
+                    }
+
+                    /* Check truncation */
+                    if ( ( fsError == NULL ) && ( fsTruncated == true ) ) {
+
+                        /* Display truncated pair */
+                        # ifdef __OPENMP__
+                        # pragma omp critical
+                        # endif
+                        std::cout << "Truncated : " << fsPair->output << " " << fsMatch.size() << std::endl;
+
+                    }
+
+                /* Display message */
+                } else { fsError = "Inconsistent projection basis"; }
+
+            /* Display message */
+            } else { fsError = "Unable to read input images or descriptors files"; }
+
+            /* Release descriptors mapping */
+            lc_map_close( & fsTrain.map );
+
+        /* Display message */
+        } else { fsError = "Unable to read input keyfiles"; }
+
+        /* Check pair state */
+        if ( fsError != NULL ) {
+
+            /* Display message */
+            # ifdef __OPENMP__
+            # pragma omp critical
+            # endif
+            std::cerr << "Error : " << fsError << " - " << fsPair->output << std::endl;
+
+        }
+
+    }
+
+/*
+    Source - Stage matching
+ */
+
+    char const * fs_matchSIFT_match( fs_Query_t * const fsFirst, fs_Query_t * const fsSecond, fs_Pair_t const * const fsPair, fs_Option_t const * const fsOption, lc_Flann_t * const fsConfig, std::chrono::steady_clock::time_point const & fsDeadline, bool * const fsTruncated, std::vector < cv::DMatch > & fsMatches ) {
+
+        /* Second image paths */
+        char const * fsKeBIPath( fsPair->keyfile.empty()  ? NULL : fsPair->keyfile.c_str()  );
+        char const * fsDeBIPath( fsPair->descfile.empty() ? NULL : fsPair->descfile.c_str() );
+
+        /* Neighbours arrays - both directions */
+        std::vector < std::vector < cv::DMatch > > fsForward;
+        std::vector < std::vector < cv::DMatch > > fsReverse;
+
+        /* Search method - index only used without other search methods */
+        bool fsBrute( ( fsOption->exact == true ) || ( fsOption->bucket == true ) || ( fsOption->vptree == true ) || ( fsOption->sketch > 0 ) || ( fsSecond->scale > 0.0 ) );
+
+        /* Message variables */
+        char const * fsError( NULL );
+
+        /* Check images keypoints */
+        if ( ( fsFirst->key.size() == 0 ) || ( fsSecond->key.size() == 0 ) ) return( "No keypoints in pair regions" );
+
+        /* Check descriptors quantization consistency */
+        if ( ( fsFirst->desc.type() != fsSecond->desc.type() ) || ( fsFirst->scale != fsSecond->scale ) ) return( "Inconsistent descriptors quantization" );
+
+        /* Check search method */
+        if ( fsBrute == false ) {
+
+            /* Check index configuration source */
+            if ( fsOption->target > 0.0 ) {
+
+                /* Tune index configuration on the pair */
+                double fsReached( lc_flann_autotune( fsFirst->desc, fsSecond->desc, fsOption->target, fsConfig ) );
+
+                /* Serialize pairs outputs */
+                # ifdef __OPENMP__
+                # pragma omp critical
+                # endif
+                {
+
+                    /* Display selected configuration */
+                    std::cout << "Configuration : " << lc_flann_tag( fsConfig ) << " checks " << fsConfig->checks << " recall " << fsReached << std::endl;
+
+                    /* Export configuration for later runs */
+                    if ( ( fsOption->tuning != NULL ) && ( lc_flann_write( fsOption->tuning, fsConfig ) == false ) ) fsError = "Unable to write index configuration";
+
+                }
+
+            }
+
+            /* Persistent index path */
+            std::string fsIndexPath( fs_matchSIFT_index( fsOption->store, fsPair->ident, fsDeBIPath, fsKeBIPath, ( fsOption->basis != NULL ) ? fsSecond->desc.cols : 0, fsConfig ) );
+
+            /* Build or load train descriptors index - subsets are not persistent */
+            if ( lc_flann_index( fsSecond->index, fsSecond->desc, fsConfig, ( ( fsOption->persist == true ) && ( fsOption->subset == false ) ) ? fsIndexPath.c_str() : NULL, ( fsOption->store != NULL ) ? fsOption->store : ( ( fsDeBIPath != NULL ) ? fsDeBIPath : fsKeBIPath ), fsOption->basis ) == false ) {
+
+                /* Display message */
+                fsError = "Unable to save descriptors index";
+
+            }
+
+        }
+
+        /* Build second image descriptors tree */
+        if ( ( fsOption->vptree == true ) && ( fsOption->bucket == false ) ) lc_vptree_build( fsSecond->desc, & fsSecond->tree );
+
+        /* Build second image descriptors sketches */
+        if ( ( fsOption->sketch > 0 ) && ( fsOption->bucket == false ) && ( fsOption->vptree == false ) ) lc_sketch_build( fsSecond->desc, & fsSecond->sketch );
+
+        /* Check time budget */
+        if ( fsOption->deadline > 0 ) {
+
+            /* Search matches by priority until the deadline */
+            if ( fs_matchSIFT_anytime( fsFirst, fsSecond, fsBrute, fsConfig, fsOption, fsDeadline, fsMatches ) == false ) * fsTruncated = true;
+
+        } else {
+
+            /* Search neighbours - index searches of both directions run concurrently */
+            # ifdef __OPENMP__
+            # pragma omp parallel sections if ( fsBrute == false )
+            # endif
+            {
+
+                /* Forward search - second neighbour for the ratio test */
+                # ifdef __OPENMP__
+                # pragma omp section
+                # endif
+                fs_matchSIFT_knn( fsFirst->desc, fsFirst->key, fsSecond->desc, fsSecond->key, ( fsBrute == true ) ? NULL : & fsSecond->index, & fsSecond->tree, & fsSecond->sketch, fsConfig, fsOption, ( fsOption->ratio > 0.0 ) ? 2 : 1, false, fsForward );
+
+                /* Reverse search - through the first image index */
+                # ifdef __OPENMP__
+                # pragma omp section
+                # endif
+                if ( fsOption->mutual == true ) fs_matchSIFT_knn( fsSecond->desc, fsSecond->key, fsFirst->desc, fsFirst->key, ( fsFirst->indexed == true ) ? & fsFirst->index : NULL, & fsFirst->tree, & fsFirst->sketch, fsConfig, fsOption, 1, fsOption->subset == false, fsReverse );
+
+            }
+
+            /* Apply ratio test */
+            lc_filter_ratio( fsForward, fsOption->ratio, fsMatches );
+
+            /* Apply mutual consistency */
+            if ( fsOption->mutual == true ) lc_filter_mutual( fsMatches, fsReverse );
+
+        }
+
+        /* Check recall measure */
+        if ( fsOption->recall == true ) {
+
+            /* Check floating point descriptors */
+            if ( ( fsFirst->real.empty() == false ) && ( fsSecond->real.empty() == false ) ) {
+
+                /* Recall variables */
+                double fsRecall( lc_quantize_recall( fsFirst->real, fsSecond->real, fsFirst->desc, fsSecond->desc ) );
+
+                /* Display recall of quantized matching */
+                # ifdef __OPENMP__
+                # pragma omp critical
+                # endif
+                std::cout << "Recall : " << fsPair->output << " " << fsRecall << std::endl;
+
+            /* Display message */
+            } else { fsError = "Recall requires floating point descriptors to quantize"; }
+
+        }
+
+        /* Return matching state */
+        return( fsError );
+
+    }
+
+/*
+    Source - Time-budgeted matching
+ */
+
+    bool fs_matchSIFT_anytime( fs_Query_t * const fsFirst, fs_Query_t * const fsSecond, bool const fsBrute, lc_Flann_t const * const fsConfig, fs_Option_t const * const fsOption, std::chrono::steady_clock::time_point const & fsDeadline, std::vector < cv::DMatch > & fsMatches ) {
+
+        /* Queries priority order */
+        std::vector < int > fsOrder;
+
+        /* Searched queries variables */
+        size_t fsDone( 0 );
+
+        /* Compute queries priority - strongest keypoints first */
+        lc_keyfile_order( fsFirst->key, fsOrder );
+
+        /* Reset matches array */
+        fsMatches.clear();
+
+        /* Search chunks - deadline checked between chunks, the first one always searched */
+        while ( ( fsDone < fsOrder.size() ) && ( ( fsDone == 0 ) || ( std::chrono::steady_clock::now() < fsDeadline ) ) ) {
+
+            /* Chunk queries indexes */
+            std::vector < int > fsChunk( fsOrder.begin() + fsDone, fsOrder.begin() + std::min( fsDone + FS_CHUNK, fsOrder.size() ) );
+
+            /* Chunk queries keypoints */
+            std::vector < cv::KeyPoint > fsChunkKey( fsChunk.size() );
+
+            /* Neighbours arrays - both directions */
+            std::vector < std::vector < cv::DMatch > > fsForward;
+            std::vector < std::vector < cv::DMatch > > fsReverse;
+
+            /* Chunk matches */
+            std::vector < cv::DMatch > fsSelect;
+
+            /* Gather chunk queries keypoints */
+            for ( size_t fsParse( 0 ); fsParse < fsChunk.size(); fsParse ++ ) fsChunkKey[fsParse] = fsFirst->key[fsChunk[fsParse]];
+
+            /* Forward search - second neighbour for the ratio test */
+            fs_matchSIFT_knn( lc_lazy_gather( fsFirst->desc, fsChunk ), fsChunkKey, fsSecond->desc, fsSecond->key, ( fsBrute == true ) ? NULL : & fsSecond->index, & fsSecond->tree, & fsSecond->sketch, fsConfig, fsOption, ( fsOption->ratio > 0.0 ) ? 2 : 1, false, fsForward );
+
+            /* Apply ratio test */
+            lc_filter_ratio( fsForward, fsOption->ratio, fsSelect );
+
+            /* Restore queries indexes */
+            for ( size_t fsParse( 0 ); fsParse < fsSelect.size(); fsParse ++ ) fsSelect[fsParse].queryIdx = fsChunk[fsSelect[fsParse].queryIdx];
+
+            /* Check mutual consistency */
+            if ( ( fsOption->mutual == true ) && ( fsSelect.size() > 0 ) ) {
+
+                /* Matched train descriptors */
+                std::vector < int > fsTrain( fsSelect.size() );
+
+                /* Matched train keypoints */
+                std::vector < cv::KeyPoint > fsTrainKey( fsSelect.size() );
+
+                /* Kept matches variables */
+                size_t fsKept( 0 );
+
+                /* Gather matched train descriptors */
+                for ( size_t fsParse( 0 ); fsParse < fsSelect.size(); fsParse ++ ) {
+
+                    /* Assign train index and keypoint */
+                    fsTrain   [fsParse] = fsSelect[fsParse].trainIdx;
+                    fsTrainKey[fsParse] = fsSecond->key[fsTrain[fsParse]];
+
+                }
+
+                /* Reverse search - limited to the matched train descriptors */
+                fs_matchSIFT_knn( lc_lazy_gather( fsSecond->desc, fsTrain ), fsTrainKey, fsFirst->desc, fsFirst->key, ( fsFirst->indexed == true ) ? & fsFirst->index : NULL, & fsFirst->tree, & fsFirst->sketch, fsConfig, fsOption, 1, fsOption->subset == false, fsReverse );
+
+                /* Apply mutual consistency - reverse neighbours follow the matches */
+                for ( size_t fsParse( 0 ); fsParse < fsSelect.size(); fsParse ++ ) {
+
+                    /* Check reverse nearest neighbour */
+                    if ( ( fsReverse[fsParse].empty() == false ) && ( fsReverse[fsParse][0].trainIdx == fsSelect[fsParse].queryIdx ) ) fsSelect[fsKept ++] = fsSelect[fsParse];
+
+                }
+
+                /* Remove rejected matches */
+                fsSelect.resize( fsKept );
+
+            }
+
+            /* Append chunk matches */
+            fsMatches.insert( fsMatches.end(), fsSelect.begin(), fsSelect.end() );
+
+            /* Update searched queries */
+            fsDone += fsChunk.size();
+
+        }
+
+        /* Matches by query - each query has one match at most */
+        std::vector < cv::DMatch > fsQueryMatch( fsFirst->key.size() );
+
+        /* Scatter matches on their queries */
+        for ( size_t fsParse( 0 ); fsParse < fsMatches.size(); fsParse ++ ) fsQueryMatch[fsMatches[fsParse].queryIdx] = fsMatches[fsParse];
+
+        /* Reset matches array */
+        fsMatches.clear();
+
+        /* Restore queries order - matches ordered as by the whole search */
+        for ( size_t fsParse( 0 ); fsParse < fsQueryMatch.size(); fsParse ++ ) if ( fsQueryMatch[fsParse].queryIdx >= 0 ) fsMatches.push_back( fsQueryMatch[fsParse] );
+
+        /* Return completion state */
+        return( fsDone == fsOrder.size() );
+
+    }
+
+/*
+    Source - Matches geometric support
+ */
+
+    int fs_matchSIFT_support( std::vector < lc_Match_t > const & fsMatch ) {
+
+        /* Matched positions arrays */
+        std::vector < cv::Point2f > fsPointA( fsMatch.size() );
+        std::vector < cv::Point2f > fsPointB( fsMatch.size() );
+
+        /* Gather matched positions */
+        for ( size_t fsParse( 0 ); fsParse < fsMatch.size(); fsParse ++ ) {
+
+            /* Assign positions */
+            fsPointA[fsParse] = cv::Point2f( fsMatch[fsParse].ax, fsMatch[fsParse].ay );
+            fsPointB[fsParse] = cv::Point2f( fsMatch[fsParse].bx, fsMatch[fsParse].by );
+
+        }
+
+        /* Return epipolar inliers count */
+        return( lc_filter_support( fsPointA, fsPointB, LC_FILTER_TOLERANCE ) );
+
+    }
+
+/*
+    Source - Matches exportation
+ */
+
+    bool fs_matchSIFT_export( fs_Option_t const * const fsOption, char const * const fsOutput, std::vector < lc_Match_t > const & fsMatch, uint32_t const fsFlags ) {
+
+        /* Database structure */
+        lc_Database_t fsHandle;
+
+        /* Exportation status variables */
+        bool fsExport( false );
+
+        /* Check matches destination */
+        if ( fsOption->database != NULL ) {
+
+            /* Serialize database accesses */
+            # ifdef __OPENMP__
+            # pragma omp critical
+            # endif
+            {
+
+                /* Open database */
+                if ( lc_database_open( fsOption->database, & fsHandle, LC_DATABASE_WRITE ) == true ) {
+
+                    /* Export pair matches */
+                    fsExport = lc_database_insert( & fsHandle, fsOption->imageA, fsOutput, fsMatch, fsFlags );
+
+                    /* Close database */
+                    lc_database_close( & fsHandle );
+
+                }
+
+            }
+
+        /* Export matches */
+        } else { fsExport = lc_matchfile_write( fsOutput, fsMatch, fsOption->format, fsFlags ); }
+
+        /* Return exportation state */
+        return( fsExport );
+
+    }
+
+/*
+    Source - Keypoints descriptors
+ */
+
+    bool fs_matchSIFT_descriptor( char const * const fsImage, char const * const fsDescfile, std::vector < cv::KeyPoint > & fsKey, cv::Mat & fsDescript, lc_Map_t * const fsMap, float * const fsScale, lc_Lazy_t * const fsLazy ) {
+
+        /* Image variable */
+        cv::Mat fsGray;
+
+        /* Check descriptors source */
+        if ( fsDescfile != NULL ) {
+
+            /* Map precomputed descriptors */
+            fsDescript = lc_descfile_map( fsDescfile, fsMap, fsScale );
+
+            /* Verify descriptors consistency with keypoints */
+            return( ( fsDescript.empty() == false ) && ( ( size_t ) fsDescript.rows == fsKey.size() ) );
+
+        } else {
+
+            /* Read input image */
+            fsGray = cv::imread( fsImage, CV_LOAD_IMAGE_GRAYSCALE );
+
+            /* Verify image reading */
+            if ( fsGray.data == NULL ) return( false );
+
+            /* Instance SIFT descriptor */
+            cv::SIFT fsSift;
+
+            /* Floating point descriptors */
+            * fsScale = 0.0;
+
+            /* Prepare lazy description - regions are described on demand */
+            if ( fsLazy != NULL ) return( lc_lazy_create( fsGray, fsKey, fsSift, fsLazy, fsDescript ) );
+
+            /* Compute image descriptors */
+            fsSift.compute( fsGray, fsKey, fsDescript );
+
+            /* Return descriptors state */
+            return( fsDescript.empty() == false );
+
+        }
+
+    }
+
+/*
+    Source - Region description
+ */
+
+    void fs_matchSIFT_describe( lc_Lazy_t * const fsLazy, std::vector < cv::KeyPoint > & fsKey, cv::Rect const & fsRegion, int const fsLimit, cv::Mat & fsDescript ) {
+
+        /* Check lazy description */
+        if ( fsLazy->image.empty() == true ) return;
+
+        /* Instance SIFT descriptor */
+        cv::SIFT fsSift;
+
+        /* Describe region keypoints not described yet */
+        lc_lazy_describe( fsLazy, fsKey, fsSift, fsRegion, fsLimit, fsDescript );
+
+    }
+
+/*
+    Source - Image subset
+ */
+
+    void fs_matchSIFT_subset( fs_Query_t * const fsImage, cv::Rect const & fsRegion, int const fsLimit, std::vector < int > & fsSelect, fs_Query_t * const fsSubset ) {
+
+        /* Describe subset keypoints not described yet */
+        fs_matchSIFT_describe( & fsImage->lazy, fsImage->key, fsRegion, fsLimit, fsImage->desc );
+
+        /* Select subset keypoints */
+        lc_lazy_select( & fsImage->lazy, fsImage->key, fsRegion, fsLimit, fsSelect );
+
+        /* Allocate subset keypoints */
+        fsSubset->key.resize( fsSelect.size() );
+
+        /* Gather subset keypoints */
+        for ( size_t fsParse( 0 ); fsParse < fsSelect.size(); fsParse ++ ) fsSubset->key[fsParse] = fsImage->key[fsSelect[fsParse]];
+
+        /* Gather subset descriptors */
+        fsSubset->desc = lc_lazy_gather( fsImage->desc, fsSelect );
+        fsSubset->real = lc_lazy_gather( fsImage->real, fsSelect );
+
+        /* Assign subset quantization scale */
+        fsSubset->scale = fsImage->scale;
+
+    }
+
+/*
+    Source - Descriptors preparation
+ */
+
+    bool fs_matchSIFT_prepare( fs_Query_t * const fsImage, fs_Option_t const * const fsOption ) {
+
+        /* Check keypoints - empty subsets need no preparation */
+        if ( fsImage->key.size() == 0 ) return( true );
+
+        /* Project descriptors on the learned basis */
+        if ( ( fsOption->basis != NULL ) && ( fs_matchSIFT_project( fsImage->desc, & fsImage->scale, fsOption ) == false ) ) return( false );
+
+        /* Quantize floating point descriptors - projected descriptors are not quantized */
+        if ( ( fsOption->scale > 0.0 ) && ( fsOption->basis == NULL ) ) fs_matchSIFT_quantize( fsImage->desc, fsImage->real, & fsImage->scale, fsOption->scale );
+
+        /* Return preparation state */
+        return( true );
+
+    }
+
+/*
+    Source - Descriptors quantization
+ */
+
+    void fs_matchSIFT_quantize( cv::Mat & fsDescript, cv::Mat & fsFloat, float * const fsScale, float const fsTarget ) {
+
+        /* Check floating point descriptors */
+        if ( * fsScale > 0.0 ) return;
+
+        /* Keep floating point descriptors */
+        fsFloat = fsDescript;
+
+        /* Quantize descriptors */
+        if ( lc_quantize( fsFloat, fsDescript, LC_QUANTIZE_UNSIGNED, fsTarget ) == true ) * fsScale = fsTarget;
+
+    }
+
+/*
+    Source - Descriptors projection
+ */
+
+    bool fs_matchSIFT_project( cv::Mat & fsDescript, float * const fsScale, fs_Option_t const * const fsOption ) {
+
+        /* Projected descriptors matrix */
+        cv::Mat fsProject;
+
+        /* Check descriptors and basis consistency */
+        if ( fsDescript.cols != fsOption->pca.mean.cols ) return( false );
+
+        /* Project descriptors on the leading components */
+        lc_pca_project( & fsOption->pca, fsDescript, * fsScale, fsOption->dimension, fsProject );
+
+        /* Replace descriptors - projected descriptors are floating point ones */
+        fsDescript = fsProject;
+
+        /* Reset quantization scale */
+        * fsScale = 0.0;
+
+        /* Return projection state */
+        return( true );
+
+    }
+
+/*
+    Source - Reverse searches structures
+ */
+
+    void fs_matchSIFT_reverse( fs_Query_t * const fsQuery, fs_Option_t const * const fsOption, lc_Flann_t const * const fsConfig ) {
+
+        /* Search method of the reverse searches - index only used without other search methods */
+        fsQuery->indexed = ( fsOption->mutual == true ) && ( fsOption->exact == false ) && ( fsOption->bucket == false ) && ( fsOption->vptree == false ) && ( fsOption->sketch <= 0 ) && ( fsQuery->scale <= 0.0 );
+
+        /* Build first image descriptors index for the reverse searches */
+        if ( fsQuery->indexed == true ) lc_flann_index( fsQuery->index, fsQuery->desc, fsConfig, NULL, NULL, NULL );
+
+        /* Build first image descriptors tree for the reverse searches */
+        if ( ( fsOption->mutual == true ) && ( fsOption->vptree == true ) && ( fsOption->bucket == false ) ) lc_vptree_build( fsQuery->desc, & fsQuery->tree );
+
+        /* Build first image descriptors sketches for the reverse searches */
+        if ( ( fsOption->mutual == true ) && ( fsOption->sketch > 0 ) && ( fsOption->bucket == false ) && ( fsOption->vptree == false ) ) lc_sketch_build( fsQuery->desc, & fsQuery->sketch );
+
+    }
+
+/*
+    Source - Persistent index path
+ */
+
+    std::string fs_matchSIFT_index( char const * const fsStore, int const fsIdent, char const * const fsDescfile, char const * const fsKeyfile, int const fsDimension, lc_Flann_t const * const fsConfig ) {
+
+        /* Projection tag - projected descriptors have their own index */
+        std::string fsProject( ( fsDimension > 0 ) ? ".pca" + std::to_string( fsDimension ) : "" );
+
+        /* Check train features source */
+        if ( fsStore != NULL ) {
+
+            /* Return store image index path */
+            return( std::string( fsStore ) + "." + std::to_string( fsIdent ) + fsProject + lc_flann_tag( fsConfig ) + LC_FLANN_EXTENSION );
+
+        } else if ( fsDescfile != NULL ) {
+
+            /* Return descriptors file index path */
+            return( std::string( fsDescfile ) + fsProject + lc_flann_tag( fsConfig ) + LC_FLANN_EXTENSION );
+
+        } else {
+
+            /* Return keyfile index path - descriptors computed from image */
+            return( std::string( fsKeyfile ) + fsProject + lc_flann_tag( fsConfig ) + LC_FLANN_EXTENSION );
+
+        }
+
+    }
+
+/*
+    Source - Neighbours search
+ */
+
+    void fs_matchSIFT_knn( cv::Mat const & fsQuery, std::vector < cv::KeyPoint > const & fsQueryKey, cv::Mat const & fsTrain, std::vector < cv::KeyPoint > const & fsTrainKey, cv::flann::Index * const fsIndex, lc_Vptree_t const * const fsTree, lc_Sketch_t const * const fsSketch, lc_Flann_t const * const fsConfig, fs_Option_t const * const fsOption, int const fsK, bool const fsShared, std::vector < std::vector < cv::DMatch > > & fsNeighbour ) {
+
+        /* Check search method */
+        if ( ( fsIndex == NULL ) && ( fsOption->bucket == true ) ) {
+
+            /* Exact neighbours search among compatible scales and orientations */
+            lc_bucket_knn( fsQuery, fsQueryKey, fsTrain, fsTrainKey, fsOption->octave, fsOption->angle, fsNeighbour, fsK );
+
+        } else if ( ( fsIndex == NULL ) && ( fsOption->vptree == true ) ) {
+
+            /* Exact neighbours search through the train descriptors tree */
+            lc_vptree_knn( fsTree, fsQuery, fsNeighbour, fsK );
+
+        } else if ( ( fsIndex == NULL ) && ( fsOption->sketch > 0 ) ) {
+
+            /* Binary sketches shortlist ranked by exact distances */
+            lc_sketch_knn( fsSketch, fsTrain, fsQuery, fsOption->sketch, fsNeighbour, fsK );
+
+        } else if ( fsIndex == NULL ) {
+
+            /* Exact neighbours search */
+            lc_brute_knn( fsQuery, fsTrain, fsNeighbour, fsK );
+
+        } else if ( fsShared == true ) {
+
+            /* Approximated neighbours search - the shared index is searched by one pair at a time */
+            # ifdef __OPENMP__
+            # pragma omp critical ( fs_index )
+            # endif
+            lc_flann_knn( * fsIndex, fsQuery, fsConfig, fsNeighbour, std::min( fsK, fsTrain.rows ) );
+
+        } else {
+
+            /* Approximated neighbours search - neighbours limited by train size */
+            lc_flann_knn( * fsIndex, fsQuery, fsConfig, fsNeighbour, std::min( fsK, fsTrain.rows ) );
+
+        }
 
     }
 
@@ -88,6 +88,8 @@
 
     # include <iostream>
     # include <fstream>
+    # include <sstream>
+    # include <chrono>
     # include <common-all.hpp>
     # include <opencv2/opencv.hpp>
     # include <opencv2/highgui/highgui_c.h>
@@ -105,10 +107,44 @@
     "\t-j\tInput image 2\n"                                 \
     "\t-k\tInput keypoints file 1\n"                        \
     "\t-l\tInput keypoints file 2\n"                        \
-    "\t-o\tOutput matches file\n\n"                         \
+    "\t-p\tInput descriptors file 1\n"                      \
+    "\t-q\tInput descriptors file 2\n"                      \
+    "\t-o\tOutput matches file\n"                           \
+    "\t-O\tOutput matches database\n"                       \
+    "\t-A\tDatabase pair first image name\n"                \
+    "\t-B\tDatabase pair second image name\n"               \
+    "\t-S\tInput features store\n"                          \
+    "\t-K\tStore identifier of image 1\n"                   \
+    "\t-L\tStore identifier of image 2\n"                   \
+    "\t-M\tList of images 2 matched against image 1\n"      \
+    "\t-X\tRegion of image 1, as x,y,width,height\n"        \
+    "\t-Y\tRegion of image 2, as x,y,width,height\n"        \
+    "\t-b\tBinary matches file format\n"                    \
+    "\t-e\tExact brute-force matching\n"                    \
+    "\t-Q\tQuantized matching, scale from image 1\n"        \
+    "\t-z\tDescriptors quantization scale\n"                \
+    "\t-r\tDisplay quantized matching recall\n"             \
+    "\t-n\tPersistent index of image 2 descriptors\n"       \
+    "\t-t\tIndex auto-tuning recall target\n"               \
+    "\t-c\tIndex configuration file\n"                      \
+    "\t-d\tNeighbours distance ratio threshold\n"           \
+    "\t-m\tMutual nearest neighbours matches\n"             \
+    "\t-u\tScale and orientation bucketed search\n"         \
+    "\t-g\tBucketed search octave tolerance\n"              \
+    "\t-a\tBucketed search angle tolerance\n"               \
+    "\t-v\tExact vantage-point tree search\n"               \
+    "\t-s\tBinary sketches shortlist size\n"                \
+    "\t-P\tDescriptors projection basis\n"                  \
+    "\t-D\tProjected descriptors dimension\n"               \
+    "\t-T\tProgressive matching initial keypoints\n"        \
+    "\t-N\tProgressive matching geometric support\n"        \
+    "\t-W\tSearch deadline in ms from each pair start\n\n"  \
     "feature-match-SIFT - feature-suite\n"                  \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
+    /* Time-budgeted matching - queries searched between deadline checks */
+    # define FS_CHUNK 256
+
 /* 
     Header - Preprocessor macros
  */
@@ -121,6 +157,176 @@
     Header - Structures
  */
 
+    /*! \struct fs_Pair_struct
+     *  \brief Second image structure
+     *
+     *  Structure describing one second image matched against the first image
+     *  and the destination of the pair matches. Unused paths are empty.
+     *
+     *  \var fs_Pair_struct::ident
+     *  Store identifier of the image
+     *  \var fs_Pair_struct::keyfile
+     *  Path of the keyfile
+     *  \var fs_Pair_struct::image
+     *  Path of the image
+     *  \var fs_Pair_struct::descfile
+     *  Path of the descriptors file
+     *  \var fs_Pair_struct::output
+     *  Matches file path, or pair second image name in the database
+     *  \var fs_Pair_struct::regionA
+     *  Matched region of the first image, the whole image if empty
+     *  \var fs_Pair_struct::regionB
+     *  Matched region of the second image, the whole image if empty
+     */
+
+    typedef struct fs_Pair_struct {
+
+        int         ident;
+        std::string keyfile;
+        std::string image;
+        std::string descfile;
+        std::string output;
+        cv::Rect    regionA;
+        cv::Rect    regionB;
+
+    } fs_Pair_t;
+
+    /*! \struct fs_Query_struct
+     *  \brief Image features structure
+     *
+     *  Structure holding the features of an image : the first image, obtained
+     *  once and kept resident while the second images are matched against it,
+     *  a second image, or the subset of an image matched at a stage.
+     *
+     *  \var fs_Query_struct::key
+     *  Keypoints array
+     *  \var fs_Query_struct::desc
+     *  Descriptors matrix
+     *  \var fs_Query_struct::real
+     *  Floating point descriptors of quantized descriptors
+     *  \var fs_Query_struct::map
+     *  Mapping of the descriptors file
+     *  \var fs_Query_struct::scale
+     *  Descriptors quantization scale
+     *  \var fs_Query_struct::index
+     *  Descriptors index used by reverse searches
+     *  \var fs_Query_struct::indexed
+     *  Index availability flag
+     *  \var fs_Query_struct::tree
+     *  Descriptors tree used by exact reverse searches
+     *  \var fs_Query_struct::sketch
+     *  Descriptors sketches used by prefiltered reverse searches
+     *  \var fs_Query_struct::lazy
+     *  Lazy descriptors of the image subsets
+     */
+
+    typedef struct fs_Query_struct {
+
+        std::vector < cv::KeyPoint > key;
+        cv::Mat                      desc;
+        cv::Mat                      real;
+        lc_Map_t                     map;
+        float                        scale;
+        cv::flann::Index             index;
+        bool                         indexed;
+        lc_Vptree_t                  tree;
+        lc_Sketch_t                  sketch;
+        lc_Lazy_t                    lazy;
+
+    } fs_Query_t;
+
+    /*! \struct fs_Option_struct
+     *  \brief Matching options structure
+     *
+     *  Structure gathering the matching options shared by all pairs.
+     *
+     *  \var fs_Option_struct::store
+     *  Path of the features store, NULL if not used
+     *  \var fs_Option_struct::database
+     *  Path of the matches database, NULL if not used
+     *  \var fs_Option_struct::imageA
+     *  Database pair first image name
+     *  \var fs_Option_struct::tuning
+     *  Path of the index configuration file
+     *  \var fs_Option_struct::basis
+     *  Path of the projection basis, NULL if not used
+     *  \var fs_Option_struct::format
+     *  Matchfile format
+     *  \var fs_Option_struct::exact
+     *  Exact brute-force matching flag
+     *  \var fs_Option_struct::persist
+     *  Persistent index flag
+     *  \var fs_Option_struct::mutual
+     *  Mutual consistency flag
+     *  \var fs_Option_struct::recall
+     *  Quantized matching recall flag
+     *  \var fs_Option_struct::quantize
+     *  Quantized matching flag, the scale being derived from the first image
+     *  descriptors when not specified
+     *  \var fs_Option_struct::bucket
+     *  Scale and orientation bucketed search flag
+     *  \var fs_Option_struct::vptree
+     *  Exact vantage-point tree search flag
+     *  \var fs_Option_struct::subset
+     *  Subsets matching flag, set by progressive matching or pair regions
+     *  \var fs_Option_struct::octave
+     *  Bucketed search octave tolerance
+     *  \var fs_Option_struct::angle
+     *  Bucketed search angle tolerance, in degrees
+     *  \var fs_Option_struct::sketch
+     *  Binary sketches shortlist size, zero to disable prefiltering
+     *  \var fs_Option_struct::dimension
+     *  Projected descriptors dimension, zero for all basis components
+     *  \var fs_Option_struct::progressive
+     *  Leading keypoints of the first progressive stage, zero to disable
+     *  \var fs_Option_struct::support
+     *  Geometric support ending progressive matching, in inliers
+     *  \var fs_Option_struct::deadline
+     *  Deadline of the searches, in milliseconds from each pair start, zero
+     *  to disable
+     *  \var fs_Option_struct::scale
+     *  Descriptors quantization scale to apply, overriding the derived one
+     *  \var fs_Option_struct::target
+     *  Index auto-tuning recall target
+     *  \var fs_Option_struct::ratio
+     *  Neighbours distance ratio threshold
+     *  \var fs_Option_struct::config
+     *  Index configuration
+     *  \var fs_Option_struct::pca
+     *  Projection basis
+     */
+
+    typedef struct fs_Option_struct {
+
+        char *     store;
+        char *     database;
+        char *     imageA;
+        char *     tuning;
+        char *     basis;
+        int        format;
+        bool       exact;
+        bool       persist;
+        bool       mutual;
+        bool       recall;
+        bool       quantize;
+        bool       bucket;
+        bool       vptree;
+        bool       subset;
+        int        octave;
+        float      angle;
+        int        sketch;
+        int        dimension;
+        int        progressive;
+        int        support;
+        int        deadline;
+        float      scale;
+        float      target;
+        float      ratio;
+        lc_Flann_t config;
+        lc_Pca_t   pca;
+
+    } fs_Option_t;
+
 /* 
     Header - Function prototypes
  */
@@ -128,9 +334,25 @@
     /*! \brief Software main function
      *  
      *  The main function frame follows : parameters are initialized and read.
-     *  The two input images are imported in grayscale mode and the two keypoints
-     *  files are read. The OpenCV SIFT descriptor is called befor the OpenCV 
-     *  Flann matcher generate the matches. The list of matches is then exported.
+     *  The first image keypoints are read and their descriptors are obtained
+     *  once, either from a descriptors file or by calling the OpenCV SIFT
+     *  descriptor on the input image imported in grayscale mode. They stay
+     *  resident while the second images, a single one or a list of them, are
+     *  matched against them in parallel, each pair producing its own list of
+     *  matches. When mutual consistency is requested, the index of the first
+     *  image descriptors used by the reverse searches is built only once. When
+     *  pairs are restricted to regions of their images, the images are
+     *  described lazily : only the keypoints of the regions are described, the
+     *  first image keypoints being described once for all pairs. Progressive
+     *  matching proceeds the same way on the leading keypoints of the images.
+     *  Each pair can be given a time budget : its searches stop at the
+     *  deadline and the matches found so far are exported as truncated. The
+     *  budget starts with the pair : its reading, description, index building
+     *  and auto-tuning consume it but are not interrupted, while the first
+     *  image, prepared once for all pairs, is not accounted. Quantized
+     *  matching uses a single scale for all pairs : unless specified, it is
+     *  derived from the largest component of the first image descriptors,
+     *  the larger components of the second images being saturated.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -138,17 +360,324 @@
 
     int main ( int argc, char ** argv );
 
-    /*! \brief Keypoints file reader
-     *  
-     *  The function simply load the keypoint information from the specified 
-     *  file.
-     *  
-     *  \param  fsKeyfile   Path of the keypoints file
-     *  
-     *  \return Returns read keypoints
+    /*! \brief Pair region
+     *
+     *  This function reads a pair region given on the command line as its
+     *  position and size, separated by commas, in decimal. The specification
+     *  has to be entirely consumed and the region size has to be positive. A
+     *  missing specification leaves the region empty, standing for the whole
+     *  image.
+     *
+     *  \param  fsSpec   Region specification, NULL for the whole image
+     *  \param  fsRegion Region receiving the specification
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchSIFT_region ( char const * const fsSpec, cv::Rect & fsRegion );
+
+    /*! \brief Pair regions
+     *
+     *  This function reads the optional regions ending a list line, the first
+     *  image region and then the second image one, each given by its position
+     *  and size. A region group that is started has to be complete, with a
+     *  positive size, and no token can follow the regions. Missing regions are
+     *  left empty, standing for the whole images.
+     *
+     *  \param  fsToken   Line stream, positioned after the mandatory fields
+     *  \param  fsRegionA Region of the first image
+     *  \param  fsRegionB Region of the second image
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchSIFT_regions ( std::istream & fsToken, cv::Rect & fsRegionA, cv::Rect & fsRegionB );
+
+    /*! \brief Second images list
+     *
+     *  This function reads the list of second images to match against the first
+     *  image. Each line gives a store identifier followed by the pair
+     *  destination when a features store is used, and a keyfile, a source and
+     *  the pair destination otherwise. The source is a descriptors file when
+     *  its format is detected as such, an image otherwise. The destination is a
+     *  matches file, or the pair second image name in the database. Lines can
+     *  end with the region of the first image and the region of the second
+     *  image, each given by its position and size.
+     *
+     *  \param  fsPath  Path of the list file
+     *  \param  fsStore Features store usage flag
+     *  \param  fsPair  Array receiving the second images
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchSIFT_list ( char const * const fsPath, bool const fsStore, std::vector < fs_Pair_t > & fsPair );
+
+    /*! \brief Pair matching
+     *
+     *  This function matches one second image against the resident first image.
+     *  The second image descriptors are obtained and projected on the learned
+     *  principal components or quantized if required. Pairs restricted to
+     *  regions of their images are matched on the keypoints of the regions,
+     *  the second image being described lazily. With progressive matching,
+     *  the pair is matched in stages on the leading keypoints of both images,
+     *  the strongest ones of keyfiles sorted by response : the amount of
+     *  keypoints is doubled until the matches of a stage reach the requested
+     *  geometric support or all keypoints are considered, only the keypoints
+     *  of the stages being described. The matches of the last stage are then
+     *  exported. With a time budget, the stages stop at the deadline of the
+     *  pair, measured from its start, and the matches found so far are
+     *  exported as truncated : a truncated stage replaces the matches of the
+     *  previous one only if it found more matches.
+     *
+     *  \param  fsQuery  First image structure
+     *  \param  fsPair   Second image structure
+     *  \param  fsOption Matching options structure
+     *  \param  fsStore  Features store structure, NULL if not used
+     */
+
+    void fs_matchSIFT_pair ( fs_Query_t * const fsQuery, fs_Pair_t const * const fsPair, fs_Option_t const * const fsOption, lc_Store_t const * const fsStore );
+
+    /*! \brief Stage matching
+     *
+     *  This function matches the descriptors of two images or of their subsets.
+     *  The OpenCV Flann index of the second image descriptors, configured by
+     *  auto-tuning or by a stored configuration, and built or loaded from its
+     *  persistent file, provides the two nearest neighbours of each keypoint,
+     *  or the exact brute-force matcher of the common library, its exact
+     *  vantage-point tree or its binary sketches prefiltered search, if
+     *  requested. Matches are selected by the ratio test and, optionally, by
+     *  mutual consistency. The search can be restricted to the train keypoints
+     *  of compatible scale and orientation. Quantized descriptors are matched
+     *  by the exact integer search and the recall of the quantized matching
+     *  can be measured. With a time budget, the neighbours are searched by
+     *  \b fs_matchSIFT_anytime until the deadline.
+     *
+     *  \param  fsFirst     First image structure
+     *  \param  fsSecond    Second image structure
+     *  \param  fsPair      Pair structure
+     *  \param  fsOption    Matching options structure
+     *  \param  fsConfig    Index configuration of the pair
+     *  \param  fsDeadline  Deadline of the pair
+     *  \param  fsTruncated Receives true if the deadline stopped the search
+     *  \param  fsMatches   Array receiving the matches
+     *
+     *  \return Returns an error message, NULL on success
+     */
+
+    char const * fs_matchSIFT_match ( fs_Query_t * const fsFirst, fs_Query_t * const fsSecond, fs_Pair_t const * const fsPair, fs_Option_t const * const fsOption, lc_Flann_t * const fsConfig, std::chrono::steady_clock::time_point const & fsDeadline, bool * const fsTruncated, std::vector < cv::DMatch > & fsMatches );
+
+    /*! \brief Time-budgeted matching
+     *
+     *  This function searches the matches of the first image keypoints in
+     *  priority order, by decreasing response, through chunks of FS_CHUNK
+     *  queries. The ratio test and the mutual consistency apply to each chunk,
+     *  the reverse searches being limited to the matched train descriptors.
+     *  The deadline is checked between chunks, the first chunk being always
+     *  searched : the matches of the searched chunks are kept when it is
+     *  reached. The matches are then ordered by query, so that a search not
+     *  stopped by the deadline gives the matches of the whole search in the
+     *  same order.
+     *
+     *  \param  fsFirst     First image structure
+     *  \param  fsSecond    Second image structure
+     *  \param  fsBrute     Search without the second image index flag
+     *  \param  fsConfig    Index configuration of the pair
+     *  \param  fsOption    Matching options structure
+     *  \param  fsDeadline  Deadline of the pair
+     *  \param  fsMatches   Array receiving the matches
+     *
+     *  \return Returns true if all queries were searched, false otherwise
+     */
+
+    bool fs_matchSIFT_anytime ( fs_Query_t * const fsFirst, fs_Query_t * const fsSecond, bool const fsBrute, lc_Flann_t const * const fsConfig, fs_Option_t const * const fsOption, std::chrono::steady_clock::time_point const & fsDeadline, std::vector < cv::DMatch > & fsMatches );
+
+    /*! \brief Matches geometric support
+     *
+     *  This function gives the amount of matches consistent with the epipolar
+     *  geometry estimated by RANSAC on the matches.
+     *
+     *  \param  fsMatch     Matches array
+     *
+     *  \return Returns the amount of inliers
+     */
+
+    int fs_matchSIFT_support ( std::vector < lc_Match_t > const & fsMatch );
+
+    /*! \brief Matches exportation
+     *
+     *  This function exports the matches of a pair, either in a matches file
+     *  or in the matches database. Database accesses are serialized among the
+     *  parallel pairs. The flags are stored by the matches files only.
+     *
+     *  \param  fsOption Matching options structure
+     *  \param  fsOutput Matches file path or pair second image name
+     *  \param  fsMatch  Matches array
+     *  \param  fsFlags  Matches file flags
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchSIFT_export ( fs_Option_t const * const fsOption, char const * const fsOutput, std::vector < lc_Match_t > const & fsMatch, uint32_t const fsFlags );
+
+    /*! \brief Keypoints descriptors
+     *
+     *  This function obtains the descriptors of the provided keypoints. If a
+     *  descriptors file is specified, it is mapped in memory and used without
+     *  any image decoding or description. Otherwise, the image is imported in
+     *  grayscale mode and the OpenCV SIFT descriptor is computed. In this last
+     *  case, keypoints for which no descriptor can be computed are removed. If
+     *  a lazy descriptors structure is provided, the image is not described
+     *  but prepared for region description.
+     *
+     *  \param  fsImage     Path of the image, used without descriptors file
+     *  \param  fsDescfile  Path of the descriptors file, NULL if not available
+     *  \param  fsKey       Keypoints array
+     *  \param  fsDescript  Matrix receiving the descriptors
+     *  \param  fsMap       Mapping structure of the descriptors file
+     *  \param  fsScale     Receives the descriptors quantization scale
+     *  \param  fsLazy      Lazy descriptors structure, NULL for full description
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchSIFT_descriptor ( char const * const fsImage, char const * const fsDescfile, std::vector < cv::KeyPoint > & fsKey, cv::Mat & fsDescript, lc_Map_t * const fsMap, float * const fsScale, lc_Lazy_t * const fsLazy );
+
+    /*! \brief Region description
+     *
+     *  This function describes, through the lazy descriptors structure, the
+     *  keypoints of the provided region that are not described yet, among the
+     *  leading keypoints of the image. Nothing is done if the image is not
+     *  lazily described.
+     *
+     *  \param  fsLazy      Lazy descriptors structure
+     *  \param  fsKey       Keypoints array
+     *  \param  fsRegion    Image region, the whole image if empty
+     *  \param  fsLimit     Amount of leading keypoints, all if not positive
+     *  \param  fsDescript  Descriptors matrix
+     */
+
+    void fs_matchSIFT_describe ( lc_Lazy_t * const fsLazy, std::vector < cv::KeyPoint > & fsKey, cv::Rect const & fsRegion, int const fsLimit, cv::Mat & fsDescript );
+
+    /*! \brief Image subset
+     *
+     *  This function gathers the subset of an image matched at a stage : the
+     *  described keypoints of the provided region among the leading keypoints
+     *  of the image, with their descriptors. The keypoints of the subset that
+     *  are not described yet are described first.
+     *
+     *  \param  fsImage     Image structure
+     *  \param  fsRegion    Image region, the whole image if empty
+     *  \param  fsLimit     Amount of leading keypoints, all if not positive
+     *  \param  fsSelect    Array receiving the image indexes of the subset
+     *  \param  fsSubset    Structure receiving the subset
+     */
+
+    void fs_matchSIFT_subset ( fs_Query_t * const fsImage, cv::Rect const & fsRegion, int const fsLimit, std::vector < int > & fsSelect, fs_Query_t * const fsSubset );
+
+    /*! \brief Descriptors preparation
+     *
+     *  This function projects the descriptors of an image on the learned basis
+     *  or quantizes them, as requested by the matching options.
+     *
+     *  \param  fsImage     Image structure
+     *  \param  fsOption    Matching options structure
+     *
+     *  \return Returns true on success, false on basis inconsistency
+     */
+
+    bool fs_matchSIFT_prepare ( fs_Query_t * const fsImage, fs_Option_t const * const fsOption );
+
+    /*! \brief Descriptors quantization
+     *
+     *  This function quantizes floating point descriptors on unsigned 8 bits
+     *  integers using the provided scale. The floating point descriptors are
+     *  kept for recall measure. Already quantized descriptors are left as is.
+     *
+     *  \param  fsDescript  Descriptors matrix, replaced by quantized one
+     *  \param  fsFloat     Matrix receiving the floating point descriptors
+     *  \param  fsScale     Quantization scale of the descriptors, updated
+     *  \param  fsTarget    Quantization scale to apply
+     */
+
+    void fs_matchSIFT_quantize ( cv::Mat & fsDescript, cv::Mat & fsFloat, float * const fsScale, float const fsTarget );
+
+    /*! \brief Descriptors projection
+     *
+     *  This function projects the descriptors on the leading components of
+     *  the projection basis, replacing them by the projected floating point
+     *  descriptors. Quantized descriptors are projected using their scale,
+     *  which is then reset.
+     *
+     *  \param  fsDescript  Descriptors matrix, replaced by projected one
+     *  \param  fsScale     Quantization scale of the descriptors, reset
+     *  \param  fsOption    Matching options structure
+     *
+     *  \return Returns true on success, false on basis inconsistency
+     */
+
+    bool fs_matchSIFT_project ( cv::Mat & fsDescript, float * const fsScale, fs_Option_t const * const fsOption );
+
+    /*! \brief Reverse searches structures
+     *
+     *  This function builds, according to the search method, the index, the
+     *  tree or the sketches of the first image descriptors used by the reverse
+     *  searches of mutual matching.
+     *
+     *  \param  fsQuery     First image structure
+     *  \param  fsOption    Matching options structure
+     *  \param  fsConfig    Index configuration
+     */
+
+    void fs_matchSIFT_reverse ( fs_Query_t * const fsQuery, fs_Option_t const * const fsOption, lc_Flann_t const * const fsConfig );
+
+    /*! \brief Persistent index path
+     *
+     *  This function composes the path of the persistent FLANN index of the
+     *  second image descriptors, placed next to the file providing them : the
+     *  features store, the descriptors file or the keyfile when descriptors
+     *  are computed from the image. The path carries the tag of the index
+     *  configuration and, for projected descriptors, their dimension.
+     *
+     *  \param  fsStore     Path of the features store, NULL if not used
+     *  \param  fsIdent     Store identifier of the image
+     *  \param  fsDescfile  Path of the descriptors file, NULL if not used
+     *  \param  fsKeyfile   Path of the keyfile
+     *  \param  fsDimension Projected descriptors dimension, zero if not projected
+     *  \param  fsConfig    Index configuration
+     *
+     *  \return Returns the persistent index path
+     */
+
+    std::string fs_matchSIFT_index ( char const * const fsStore, int const fsIdent, char const * const fsDescfile, char const * const fsKeyfile, int const fsDimension, lc_Flann_t const * const fsConfig );
+
+    /*! \brief Neighbours search
+     *
+     *  This function searches the nearest train descriptors of each query
+     *  descriptor, either exactly or through the provided FLANN index of the
+     *  train descriptors. Exact searches are restricted to the train keypoints
+     *  of compatible octave and orientation when bucketed search is requested,
+     *  performed through the vantage-point tree of the train descriptors when
+     *  tree search is requested, and limited to the shortlist given by the
+     *  binary sketches when prefiltering is requested. As OpenCV FLANN
+     *  searches are not reentrant, an index shared by the parallel pairs is
+     *  searched by one pair at a time.
+     *
+     *  \param  fsQuery     Query descriptors matrix
+     *  \param  fsQueryKey  Query keypoints array
+     *  \param  fsTrain     Train descriptors matrix
+     *  \param  fsTrainKey  Train keypoints array
+     *  \param  fsIndex     Index of the train descriptors, NULL for exact search
+     *  \param  fsTree      Tree of the train descriptors, used by tree search
+     *  \param  fsSketch    Sketches of the train descriptors, used by prefiltering
+     *  \param  fsConfig    Index configuration
+     *  \param  fsOption    Matching options structure
+     *  \param  fsK         Amount of neighbours, at most two
+     *  \param  fsShared    Index shared by the parallel pairs flag
+     *  \param  fsNeighbour Array receiving the neighbours of each query
      */
 
-    std::vector < cv::KeyPoint > fs_matchSIFT_readkey ( char const * const fsKeyfile );
+    void fs_matchSIFT_knn ( cv::Mat const & fsQuery, std::vector < cv::KeyPoint > const & fsQueryKey, cv::Mat const & fsTrain, std::vector < cv::KeyPoint > const & fsTrainKey, cv::flann::Index * const fsIndex, lc_Vptree_t const * const fsTree, lc_Sketch_t const * const fsSketch, lc_Flann_t const * const fsConfig, fs_Option_t const * const fsOption, int const fsK, bool const fsShared, std::vector < std::vector < cv::DMatch > > & fsNeighbour );
 
 /*
     Header - Include guard
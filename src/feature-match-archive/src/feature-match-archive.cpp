@@ -0,0 +1,154 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "feature-match-archive.hpp"
+
+/*
+    Source - Entry point
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Path variables */
+        char * fsInputfile ( NULL );
+        char * fsOutputfile( NULL );
+
+        /* Quantization step variables */
+        float fsStep( LC_ARCHIVE_STEP );
+
+        /* Matches chunk variables */
+        std::vector < lc_Match_t > fsChunk;
+
+        /* Matchfile reader and writer variables */
+        lc_Matchreader_t fsReader;
+        lc_Matchwriter_t fsWriter;
+
+        /* Reading and creation status variables */
+        bool fsStatus( true );
+        bool fsCreate( false );
+
+        /* Output format variables */
+        int fsFormat( LC_FORMAT_ARCHIVE );
+
+        /* Arguments and parameters handle */
+        lc_stdp( lc_stda( argc, argv, "--input" , "-i" ), argv, & fsInputfile , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output", "-o" ), argv, & fsOutputfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--step"  , "-s" ), argv, & fsStep      , LC_FLOAT  );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--unpack", "-u" ) ) fsFormat = LC_FORMAT_TEXT;
+        if ( lc_stda( argc, argv, "--binary", "-b" ) ) fsFormat = LC_FORMAT_BINARY;
+
+        /* Software swicth */
+        if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
+
+            /* Display message */
+            std::cout << FS_HELP;
+
+        } else {
+
+            /* Verify path strings and quantization step */
+            if ( ( fsInputfile != NULL ) && ( fsOutputfile != NULL ) && ( fsStep > 0.0 ) ) {
+
+                /* Open input matches */
+                if ( lc_matchreader_open( fsInputfile, & fsReader ) == true ) {
+
+                    /* Create output matches */
+                    if ( fsFormat == LC_FORMAT_ARCHIVE ) {
+
+                        /* Create archive */
+                        fsCreate = lc_matchwriter_archive( fsOutputfile, & fsWriter, fsStep );
+
+                    } else {
+
+                        /* Create matches file */
+                        fsCreate = lc_matchwriter_open( fsOutputfile, & fsWriter, fsFormat );
+
+                    }
+
+                    /* Check output creation */
+                    if ( fsCreate == true ) {
+
+                        /* Preserve input flags */
+                        fsWriter.flags = fsReader.flags;
+
+                        /* Convert matches chunk by chunk */
+                        while ( ( ( fsStatus = lc_matchreader_chunk( & fsReader, fsChunk, LC_ARCHIVE_BLOCK ) ) == true ) && ( fsChunk.empty() == false ) ) {
+
+                            /* Export matches */
+                            lc_matchwriter_chunk( & fsWriter, fsChunk );
+
+                        }
+
+                        /* Close output matches */
+                        if ( lc_matchwriter_close( & fsWriter ) == false ) {
+
+                            /* Display message */
+                            std::cerr << "Error : Unable to write output file" << std::endl;
+
+                        } else if ( fsStatus == false ) {
+
+                            /* Display message */
+                            std::cerr << "Error : Unable to read input file" << std::endl;
+
+                        }
+
+                    /* Display message */
+                    } else { std::cerr << "Error : Unable to open output file" << std::endl; }
+
+                    /* Close input matches */
+                    lc_matchreader_close( & fsReader );
+
+                /* Display message */
+                } else { std::cerr << "Error : Unable to open input file" << std::endl; }
+
+            /* Display message */
+            } else { std::cerr << "Error : Invalid path specification" << std::endl; }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
@@ -53,16 +53,20 @@
 
     int main( int argc, char ** argv ) {
 
+        /* Time budget origin */
+        std::chrono::steady_clock::time_point fsStart( std::chrono::steady_clock::now() );
+
         /* Path variables */
         char * fsSMatchfile( NULL );
         char * fsIMatchfile( NULL );
         char * fsOMatchfile( NULL );
 
-        /* Reading variables */
-        int   fsCount  ( 0   );
-        int   fsKeyIdx ( 0   );
-        float fsKeyX   ( 0.0 );
-        float fsKeyY   ( 0.0 );
+        /* Database variables */
+        char * fsSDatabase( NULL );
+        char * fsIDatabase( NULL );
+        char * fsODatabase( NULL );
+        char * fsImageA   ( NULL );
+        char * fsImageB   ( NULL );
 
         /* Sieve tolerence parameter */
         float fsTolerence ( 1.0 );
@@ -76,28 +80,45 @@
         float fsPointA[3] = { 0.0 };
         float fsPointB[3] = { 0.0 };
 
-        /* Match buffer */
-        fs_Match_t fsBuffer = { };
-
         /* Strict matches arrays */
         std::vector < cv::Point2f > fsKeyA;
         std::vector < cv::Point2f > fsKeyB;
 
         /* Matches array */
-        std::vector < fs_Match_t > fsIMatch;
-        std::vector < fs_Match_t > fsOMatch;
+        std::vector < lc_Match_t > fsSMatch;
+        std::vector < lc_Match_t > fsIMatch;
+        std::vector < lc_Match_t > fsOMatch;
 
         /* Fundamental matrix */
         cv::Mat fsFundmat;
 
-        /* Stream variables */
-        std::fstream fsStream;
+        /* Fundamental matrix inliers mask */
+        std::vector < unsigned char > fsMask;
+
+        /* Time budget parameter - milliseconds */
+        int fsDeadline( 0 );
+
+        /* Input and output matchfile flags */
+        uint32_t fsInput( 0 );
+        uint32_t fsFlags( 0 );
+
+        /* Matchfile format */
+        int fsFormat ( LC_FORMAT_TEXT );
 
         /* Arguments and parameters handle */
-        lc_stdp( lc_stda( argc, argv, "--strict"   , "-s" ), argv, & fsSMatchfile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--input"    , "-i" ), argv, & fsIMatchfile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--output"   , "-o" ), argv, & fsOMatchfile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--tolerance", "-t" ), argv, & fsTolerence , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--strict"    , "-s" ), argv, & fsSMatchfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--input"     , "-i" ), argv, & fsIMatchfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"    , "-o" ), argv, & fsOMatchfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-s", "-S" ), argv, & fsSDatabase , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-i", "-I" ), argv, & fsIDatabase , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-o", "-O" ), argv, & fsODatabase , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-a"    , "-A" ), argv, & fsImageA    , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-b"    , "-B" ), argv, & fsImageB    , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--tolerance" , "-t" ), argv, & fsTolerence , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--deadline"  , "-W" ), argv, & fsDeadline  , LC_INT    );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--binary", "-b" ) ) fsFormat = LC_FORMAT_BINARY;
 
         /* Software swicth */
         if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
@@ -107,150 +128,111 @@
 
         } else {
 
-            /* Verify path strings */
-            if ( ( fsSMatchfile != NULL ) && ( fsIMatchfile != NULL ) && ( fsOMatchfile != NULL ) ) {
-
-                /* Open strict match stream */
-                fsStream.open( fsSMatchfile, std::ios::in );
-
-                /* Check stream openning */
-                if ( fsStream.is_open() == true ) {
+            /* Verify path strings and pair names */
+            if ( ( ( fsSMatchfile != NULL ) || ( fsSDatabase != NULL ) ) && ( ( fsIMatchfile != NULL ) || ( fsIDatabase != NULL ) ) && ( ( fsOMatchfile != NULL ) || ( fsODatabase != NULL ) ) &&
+                 ( ( ( fsSDatabase == NULL ) && ( fsIDatabase == NULL ) && ( fsODatabase == NULL ) ) || ( ( fsImageA != NULL ) && ( fsImageB != NULL ) ) ) ) {
 
-                    /* Read matches count */
-                    fsStream >> fsCount;
+                /* Import strict matches */
+                if ( fs_matchFF_read( fsSMatchfile, fsSDatabase, fsImageA, fsImageB, fsSMatch, NULL ) == true ) {
 
-                    /* Read matches coordinates and index */
-                    for ( int fsIndex( 0 ); fsIndex < fsCount; fsIndex ++ ) {
+                    /* Convert strict matches */
+                    for ( unsigned int fsIndex( 0 ); fsIndex < fsSMatch.size(); fsIndex ++ ) {
 
-                        /* Read indexes (not used) */
-                        fsStream >> fsKeyIdx >> fsKeyIdx;
-
-                        /* Read first key parameters */
-                        fsStream >> fsKeyX >> fsKeyY;
-
-                        /* Push first key parameters */
-                        fsKeyA.push_back( cv::Point2f( fsKeyX, fsKeyY ) );
-
-                        /* Read second key parameters */
-                        fsStream >> fsKeyX >> fsKeyY;
-
-                        /* Push second key parameters */
-                        fsKeyB.push_back( cv::Point2f( fsKeyX, fsKeyY ) );
+                        /* Push keys parameters */
+                        fsKeyA.push_back( cv::Point2f( fsSMatch[fsIndex].ax, fsSMatch[fsIndex].ay ) );
+                        fsKeyB.push_back( cv::Point2f( fsSMatch[fsIndex].bx, fsSMatch[fsIndex].by ) );
 
                     }
 
-                    /* Close input stream */
-                    fsStream.close();
-
                     /* Check strict matches count */
-                    if ( fsCount >= 8 ) {
+                    if ( fsSMatch.size() >= 8 ) {
 
-                        /* Compute fundamental matrix estimation */
-                        fsFundmat = cv::findFundamentalMat( fsKeyA, fsKeyB, cv::FM_RANSAC, 1.0 , 0.99 );
+                        /* Check time budget */
+                        if ( fsDeadline > 0 ) {
 
-                        /* Open input matches file */
-                        fsStream.open( fsIMatchfile, std::ios::in );
+                            /* Compute time-budgeted fundamental matrix estimation - best model kept at deadline */
+                            if ( lc_filter_fundamental( fsKeyA, fsKeyB, 1.0, 0.99, fsStart + std::chrono::milliseconds( fsDeadline ), fsFundmat, fsMask ) == false ) fsFlags |= LC_MATCHFILE_TRUNCATED;
 
-                        /* Check stream openning */
-                        if ( fsStream.is_open() == true ) {
+                        } else {
 
-                            /* Read matches count */
-                            fsStream >> fsCount;
+                            /* Compute fundamental matrix estimation */
+                            fsFundmat = cv::findFundamentalMat( fsKeyA, fsKeyB, cv::FM_RANSAC, 1.0 , 0.99 );
 
-                            /* Read matches coordinates and index */
-                            for ( int fsIndex( 0 ); fsIndex < fsCount; fsIndex ++ ) {
+                        }
 
-                                /* Read matches coordinates */
-                                fsStream >> fsBuffer.ai >> fsBuffer.bi >> fsBuffer.ax >> fsBuffer.ay >> fsBuffer.bx >> fsBuffer.by; 
+                        /* Check fundamental matrix estimation */
+                        if ( fsFundmat.empty() == false ) {
 
-                                /* Push reading buffer */
-                                fsIMatch.push_back( fsBuffer );
+                            /* Import input matches - truncation of the input is kept */
+                            if ( fs_matchFF_read( fsIMatchfile, fsIDatabase, fsImageA, fsImageB, fsIMatch, & fsInput ) == true ) {
 
-                            }
+                                /* Accumulate input flags */
+                                fsFlags |= fsInput;
 
-                            /* Close input stream */
-                            fsStream.close();
+                                /* Apply fundamental matrix sieve */
+                                for ( unsigned int fsIndex( 0 ); fsIndex < fsIMatch.size(); fsIndex ++ ) {
 
-                            /* Apply fundamental matrix sieve */
-                            for ( unsigned int fsIndex( 0 ); fsIndex < fsIMatch.size(); fsIndex ++ ) {
+                                    /* Create homogenous vectors */
+                                    fsPointA[0] = fsIMatch[fsIndex].ax;
+                                    fsPointA[1] = fsIMatch[fsIndex].ay;
+                                    fsPointA[2] = 1.0;
+                                    fsPointB[0] = fsIMatch[fsIndex].bx;
+                                    fsPointB[1] = fsIMatch[fsIndex].by;
+                                    fsPointB[2] = 1.0;
 
-                                /* Create homogenous vectors */
-                                fsPointA[0] = fsIMatch[fsIndex].ax;
-                                fsPointA[1] = fsIMatch[fsIndex].ay;
-                                fsPointA[2] = 1.0;
-                                fsPointB[0] = fsIMatch[fsIndex].bx;
-                                fsPointB[1] = fsIMatch[fsIndex].by;
-                                fsPointB[2] = 1.0;
+                                    /* Reset epipolar line coefficients */
+                                    fsEpiplA[0] = 0.0;
+                                    fsEpiplA[1] = 0.0;
+                                    fsEpiplA[2] = 0.0;
+                                    fsEpiplB[0] = 0.0;
+                                    fsEpiplB[1] = 0.0;
+                                    fsEpiplB[2] = 0.0;
 
-                                /* Reset epipolar line coefficients */
-                                fsEpiplA[0] = 0.0;
-                                fsEpiplA[1] = 0.0;
-                                fsEpiplA[2] = 0.0;
-                                fsEpiplB[0] = 0.0;
-                                fsEpiplB[1] = 0.0;
-                                fsEpiplB[2] = 0.0;
+                                    /* Reset fundamental matrix condition */
+                                    fsCondition = 0.0;
 
-                                /* Reset fundamental matrix condition */
-                                fsCondition = 0.0;
+                                    /* Compute fundamental matrix condition and coefficients - Rows */
+                                    for ( int fsi ( 0 ); fsi < int( 3 ); fsi ++ ) {
 
-                                /* Compute fundamental matrix condition and coefficients - Rows */
-                                for ( int fsi ( 0 ); fsi < int( 3 ); fsi ++ ) {
+                                        /* Compute fundamental matrix condition and coefficients - Columns */
+                                        for ( int fsj ( 0 ); fsj < int( 3 ); fsj ++ ) {
 
-                                    /* Compute fundamental matrix condition and coefficients - Columns */
-                                    for ( int fsj ( 0 ); fsj < int( 3 ); fsj ++ ) {
+                                            /* Fundamental matrix condition */
+                                            fsCondition += fsPointB[fsi] * ( fsFundmat.at < double > ( fsi, fsj ) ) * fsPointA[fsj];
 
-                                        /* Fundamental matrix condition */
-                                        fsCondition += fsPointB[fsi] * ( fsFundmat.at < double > ( fsi, fsj ) ) * fsPointA[fsj];
+                                            /* Epipolar line coefficients */
+                                            fsEpiplB[fsi] += ( fsFundmat.at < double > ( fsi, fsj ) ) * fsPointA[fsj];
+                                            fsEpiplA[fsi] += ( fsFundmat.at < double > ( fsj, fsi ) ) * fsPointB[fsj];
 
-                                        /* Epipolar line coefficients */
-                                        fsEpiplB[fsi] += ( fsFundmat.at < double > ( fsi, fsj ) ) * fsPointA[fsj];
-                                        fsEpiplA[fsi] += ( fsFundmat.at < double > ( fsj, fsi ) ) * fsPointB[fsj];
+                                        }
 
                                     }
 
-                                }
+                                    /* Apply fundamental matrix sieve */
+                                    if ( ( ( fabs( fsCondition ) / sqrt( fsEpiplA[0] * fsEpiplA[0] + fsEpiplA[1] * fsEpiplA[1] ) ) <  fsTolerence ) &&
+                                         ( ( fabs( fsCondition ) / sqrt( fsEpiplB[0] * fsEpiplB[0] + fsEpiplB[1] * fsEpiplB[1] ) ) <  fsTolerence ) ) {
 
-                                /* Apply fundamental matrix sieve */
-                                if ( ( ( fabs( fsCondition ) / sqrt( fsEpiplA[0] * fsEpiplA[0] + fsEpiplA[1] * fsEpiplA[1] ) ) <  fsTolerence ) &&
-                                     ( ( fabs( fsCondition ) / sqrt( fsEpiplB[0] * fsEpiplB[0] + fsEpiplB[1] * fsEpiplB[1] ) ) <  fsTolerence ) ) {
+                                        /* Matches passed the fundamental matrix sieve */
+                                        fsOMatch.push_back( fsIMatch[fsIndex] );
 
-                                    /* Matches passed the fundamental matrix sieve */
-                                    fsOMatch.push_back( fsIMatch[fsIndex] );
+                                    }
 
                                 }
 
-                            }
-
-                            /* Open output matches file */
-                            fsStream.open( fsOMatchfile, std::ios::out );
-
-                            /* Check stream openning */
-                            if ( fsStream.is_open() == true ) {
-
-                                /* Export matches count */
-                                fsStream << fsOMatch.size() << std::endl;
-
-                                /* Export matches coordinates and index */
-                                for ( unsigned int fsIndex( 0 ); fsIndex < fsOMatch.size(); fsIndex ++ ) {
+                                /* Export filtered matches */
+                                if ( fs_matchFF_write( fsOMatchfile, fsODatabase, fsImageA, fsImageB, fsOMatch, fsFormat, fsFlags ) == false ) {
 
-                                    /* Export matches coordinates */
-                                    fsStream << fsOMatch[fsIndex].ai << " " 
-                                             << fsOMatch[fsIndex].bi << " " 
-                                             << fsOMatch[fsIndex].ax << " " 
-                                             << fsOMatch[fsIndex].ay << " " 
-                                             << fsOMatch[fsIndex].bx << " " 
-                                             << fsOMatch[fsIndex].by << std::endl;
+                                    /* Display message */
+                                    std::cerr << "Error : Unable to open output matches file" << std::endl;
 
-                                }    
-
-                                /* Close output stream */
-                                fsStream.close();
+                                /* Display truncation */
+                                } else if ( fsFlags != 0 ) { std::cout << "Truncated : " << ( ( fsODatabase != NULL ) ? fsODatabase : fsOMatchfile ) << std::endl; }
 
                             /* Display message */
-                            } else { std::cerr << "Error : Unable to open output matches file" << std::endl; }
+                            } else { std::cerr << "Error : Unable to open input matches file" << std::endl; }
 
                         /* Display message */
-                        } else { std::cerr << "Error : Unable to open input matches file" << std::endl; }
+                        } else { std::cerr << "Error : Unable to estimate fundamental matrix" << std::endl; }
 
                     /* Display message */
                     } else { std::cerr << "Error : Not enough strict matches for matrix estimation" << std::endl; }
@@ -268,3 +250,65 @@
 
     }
 
+/*
+    Source - Matches importation
+ */
+
+    bool fs_matchFF_read( char const * const fsMatchfile, char const * const fsDatabase, char const * const fsImageA, char const * const fsImageB, std::vector < lc_Match_t > & fsMatch, uint32_t * const fsFlags ) {
+
+        /* Database variables */
+        lc_Database_t fsHandle;
+
+        /* Reading status variables */
+        bool fsReturn( false );
+
+        /* Import matchfile */
+        if ( fsDatabase == NULL ) return( lc_matchfile_read( fsMatchfile, fsMatch, fsFlags ) );
+
+        /* Open database */
+        if ( lc_database_open( fsDatabase, & fsHandle, LC_DATABASE_READ ) == true ) {
+
+            /* Import pair matches */
+            fsReturn = lc_database_lookup( & fsHandle, fsImageA, fsImageB, fsMatch, fsFlags );
+
+            /* Close database */
+            lc_database_close( & fsHandle );
+
+        }
+
+        /* Return reading status */
+        return( fsReturn );
+
+    }
+
+/*
+    Source - Matches exportation
+ */
+
+    bool fs_matchFF_write( char const * const fsMatchfile, char const * const fsDatabase, char const * const fsImageA, char const * const fsImageB, std::vector < lc_Match_t > const & fsMatch, int const fsFormat, uint32_t const fsFlags ) {
+
+        /* Database variables */
+        lc_Database_t fsHandle;
+
+        /* Writing status variables */
+        bool fsReturn( false );
+
+        /* Export matchfile */
+        if ( fsDatabase == NULL ) return( lc_matchfile_write( fsMatchfile, fsMatch, fsFormat, fsFlags ) );
+
+        /* Open database */
+        if ( lc_database_open( fsDatabase, & fsHandle, LC_DATABASE_WRITE ) == true ) {
+
+            /* Export pair matches */
+            fsReturn = lc_database_insert( & fsHandle, fsImageA, fsImageB, fsMatch, fsFlags );
+
+            /* Close database */
+            lc_database_close( & fsHandle );
+
+        }
+
+        /* Return writing status */
+        return( fsReturn );
+
+    }
+
@@ -98,6 +98,7 @@
     # include <cmath>
     # include <numeric>
     # include <climits>
+    # include <chrono>
     # include <common-all.hpp>
     # include <opencv2/opencv.hpp>
     # include <opencv2/highgui/highgui_c.h>
@@ -107,14 +108,21 @@
  */
 
     /* Standard help */
-    # define FS_HELP "Usage summary :\n\n"                 \
-    "\tfeature-match-ff [Arguments] [Parameters] ...\n\n"  \
-    "Short arguments and parameters summary :\n\n"         \
-    "\t-s\tInput keypoints file (quality)\n"               \
-    "\t-i\tInput keypoints file (raw)\n"                   \
-    "\t-o\tOutput keypoints file\n"                        \
-    "\t-t\tFilter tolerance in pixels\n\n"                 \
-    "feature-match-ff - feature-suite\n"                   \
+    # define FS_HELP "Usage summary :\n\n"                \
+    "\tfeature-match-ff [Arguments] [Parameters] ...\n\n" \
+    "Short arguments and parameters summary :\n\n"        \
+    "\t-s\tInput keypoints file (quality)\n"              \
+    "\t-i\tInput keypoints file (raw)\n"                  \
+    "\t-o\tOutput keypoints file\n"                       \
+    "\t-S\tInput matches database (quality)\n"            \
+    "\t-I\tInput matches database (raw)\n"                \
+    "\t-O\tOutput matches database\n"                     \
+    "\t-A\tDatabase pair first image name\n"              \
+    "\t-B\tDatabase pair second image name\n"             \
+    "\t-b\tBinary matches file format\n"                  \
+    "\t-t\tFilter tolerance in pixels\n"                  \
+    "\t-W\tTime budget in milliseconds\n\n"               \
+    "feature-match-ff - feature-suite\n"                  \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
 /* 
@@ -129,36 +137,6 @@
     Header - Structures
  */
 
-    /*! \struct fs_Match_struct
-     *  \brief Match structure
-     *  
-     *  Structure that stores the description of a match between two keypoints.
-     *  
-     *  \var fs_Match_struct::ai
-     *  Index of the first keypoint in the keypoints list
-     *  \var fs_Match_struct::ax
-     *  Position x of the keypoint on the first image
-     *  \var fs_Match_struct::ay 
-     *  Position y of the keypoint on the first image
-     *  \var fs_Match_struct::bi 
-     *  Index of the second keypoint in the keypoints list
-     *  \var fs_Match_struct::bx
-     *  Position x of the keypoint on the second image
-     *  \var fs_Match_struct::by 
-     *  Position z of the keypoint on the second image
-     */
-
-    typedef struct fs_Match_struct {
-
-        int   ai;
-        float ax;
-        float ay;
-        int   bi;
-        float bx;
-        float by;
-
-    } fs_Match_t;
-
 /* 
     Header - Function prototypes
  */
@@ -170,6 +148,14 @@
      *  is performed on their basis. The set of matches to filter is read and 
      *  the fundamental matrix sieve applies. The filtered matches are then 
      *  exported.
+     *
+     *  With a time budget, the estimation uses the RANSAC of libcommon that
+     *  stops at the deadline, measured from the software start, keeping the
+     *  best model found so far. The sieve then applies with this model and
+     *  the exported matches are marked as truncated, as are the matches
+     *  filtered from truncated input matches. As this estimation
+     *  differs from the OpenCV one, the budget can change the results even
+     *  when the deadline is not reached.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -177,6 +163,43 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Matches importation
+     *
+     *  This function imports matches either from the provided matchfile or,
+     *  when a database is specified, from the database entry of the images
+     *  pair.
+     *
+     *  \param fsMatchfile Path of the matchfile
+     *  \param fsDatabase  Path of the database, NULL to use the matchfile
+     *  \param fsImageA    Name of the first image of the pair
+     *  \param fsImageB    Name of the second image of the pair
+     *  \param fsMatch     Array receiving the matches
+     *  \param fsFlags     Pointer receiving the matches flags, or NULL
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchFF_read ( char const * const fsMatchfile, char const * const fsDatabase, char const * const fsImageA, char const * const fsImageB, std::vector < lc_Match_t > & fsMatch, uint32_t * const fsFlags );
+
+    /*! \brief Matches exportation
+     *
+     *  This function exports matches either in the provided matchfile or,
+     *  when a database is specified, as the database entry of the images
+     *  pair.
+     *
+     *  \param fsMatchfile Path of the matchfile
+     *  \param fsDatabase  Path of the database, NULL to use the matchfile
+     *  \param fsImageA    Name of the first image of the pair
+     *  \param fsImageB    Name of the second image of the pair
+     *  \param fsMatch     Matches to export
+     *  \param fsFormat    Matchfile format
+     *  \param fsFlags     Matchfile flags
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_matchFF_write ( char const * const fsMatchfile, char const * const fsDatabase, char const * const fsImageA, char const * const fsImageB, std::vector < lc_Match_t > const & fsMatch, int const fsFormat, uint32_t const fsFlags );
+
 /*
     Header - Include guard
  */
@@ -0,0 +1,284 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "feature-match-ivfpq.hpp"
+
+/*
+    Source - Entry point
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Path variables */
+        char * fsStore     ( NULL );
+        char * fsIndexfile ( NULL );
+        char * fsDescfile  ( NULL );
+        char * fsOutputfile( NULL );
+
+        /* Building parameters variables */
+        unsigned int fsLists ( LC_IVFPQ_LISTS  );
+        unsigned int fsSpaces( LC_IVFPQ_SPACES );
+        unsigned int fsSample( LC_IVFPQ_SAMPLE );
+
+        /* Query parameters variables */
+        int fsIdent    ( -1 );
+        int fsProbe    ( LC_IVFPQ_PROBES );
+        int fsNeighbour( FS_NEIGHBOUR );
+        int fsCount    ( 0 );
+
+        /* Mode variables */
+        bool fsBuild( false );
+
+        /* Store variables */
+        lc_Store_t fsFeature;
+
+        /* Index variables */
+        lc_Ivfpq_t fsIndex;
+
+        /* Query variables */
+        cv::Mat fsDescript;
+
+        /* Neighbours variables */
+        std::vector < std::vector < cv::DMatch > > fsMatch;
+
+        /* Votes variables */
+        std::map < uint32_t, uint32_t > fsVote;
+        std::vector < std::pair < int, uint32_t > > fsRank;
+
+        /* Output variables */
+        lc_Writer_t fsWriter;
+
+        /* Arguments and parameters handle */
+        lc_stdp( lc_stda( argc, argv, "--store"      , "-S" ), argv, & fsStore     , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--index"      , "-x" ), argv, & fsIndexfile , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--lists"      , "-l" ), argv, & fsLists     , LC_UINT   );
+        lc_stdp( lc_stda( argc, argv, "--spaces"     , "-m" ), argv, & fsSpaces    , LC_UINT   );
+        lc_stdp( lc_stda( argc, argv, "--sample"     , "-s" ), argv, & fsSample    , LC_UINT   );
+        lc_stdp( lc_stda( argc, argv, "--image"      , "-I" ), argv, & fsIdent     , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--descriptors", "-p" ), argv, & fsDescfile  , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"     , "-o" ), argv, & fsOutputfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--probes"     , "-r" ), argv, & fsProbe     , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--neighbours" , "-n" ), argv, & fsNeighbour , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--count"      , "-k" ), argv, & fsCount     , LC_INT    );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--train", "-t" ) ) fsBuild = true;
+
+        /* Software swicth */
+        if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
+
+            /* Display message */
+            std::cout << FS_HELP;
+
+        } else if ( fsBuild == true ) {
+
+            /* Verify path strings */
+            if ( ( fsStore != NULL ) && ( fsIndexfile != NULL ) ) {
+
+                /* Open features store */
+                if ( lc_store_open( fsStore, & fsFeature ) == true ) {
+
+                    /* Build store index */
+                    if ( lc_ivfpq_build( fsIndexfile, & fsFeature, fsLists, fsSpaces, fsSample ) == false ) {
+
+                        /* Display message */
+                        std::cerr << "Error : Unable to build index" << std::endl;
+
+                    }
+
+                    /* Close features store */
+                    lc_store_close( & fsFeature );
+
+                /* Display message */
+                } else { std::cerr << "Error : Unable to open features store" << std::endl; }
+
+            /* Display message */
+            } else { std::cerr << "Error : Invalid path specification" << std::endl; }
+
+        } else {
+
+            /* Verify path strings and query source */
+            if ( ( fsIndexfile != NULL ) && ( fsOutputfile != NULL ) && ( ( fsDescfile != NULL ) || ( ( fsStore != NULL ) && ( fsIdent >= 0 ) ) ) ) {
+
+                /* Open index */
+                if ( lc_ivfpq_open( fsIndexfile, & fsIndex ) == true ) {
+
+                    /* Obtain query descriptors */
+                    if ( fs_ivfpq_query( fsStore, fsIdent, fsDescfile, fsDescript ) == true ) {
+
+                        /* Search nearest indexed descriptors */
+                        lc_ivfpq_search( & fsIndex, fsDescript, fsProbe, fsNeighbour, fsMatch );
+
+                        /* Accumulate votes */
+                        for ( size_t fsParse( 0 ); fsParse < fsMatch.size(); fsParse ++ ) {
+
+                            /* Voted images variables */
+                            std::vector < uint32_t > fsVoted;
+
+                            /* Gather neighbours images */
+                            for ( size_t fsNear( 0 ); fsNear < fsMatch[fsParse].size(); fsNear ++ ) {
+
+                                /* Discard query image when taken from the store */
+                                if ( ( fsDescfile == NULL ) && ( fsMatch[fsParse][fsNear].imgIdx == fsIdent ) ) continue;
+
+                                /* Push neighbour image */
+                                fsVoted.push_back( fsMatch[fsParse][fsNear].imgIdx );
+
+                            }
+
+                            /* Remove duplicated images - one vote per image and descriptor */
+                            std::sort( fsVoted.begin(), fsVoted.end() ); fsVoted.erase( std::unique( fsVoted.begin(), fsVoted.end() ), fsVoted.end() );
+
+                            /* Count votes */
+                            for ( size_t fsNear( 0 ); fsNear < fsVoted.size(); fsNear ++ ) fsVote[fsVoted[fsNear]] ++;
+
+                        }
+
+                        /* Compose ranking - negated votes sort images by decreasing votes */
+                        for ( std::map < uint32_t, uint32_t >::iterator fsIter( fsVote.begin() ); fsIter != fsVote.end(); fsIter ++ ) fsRank.push_back( std::make_pair( - ( int ) fsIter->second, fsIter->first ) );
+
+                        /* Sort ranking */
+                        std::sort( fsRank.begin(), fsRank.end() );
+
+                        /* Truncate ranking */
+                        if ( ( fsCount > 0 ) && ( fsRank.size() > ( size_t ) fsCount ) ) fsRank.resize( fsCount );
+
+                        /* Create output file */
+                        if ( lc_writer_open( fsOutputfile, & fsWriter ) == true ) {
+
+                            /* Export ranking */
+                            for ( size_t fsParse( 0 ); fsParse < fsRank.size(); fsParse ++ ) {
+
+                                /* Export image and votes */
+                                lc_writer_integer( & fsWriter, fsRank[fsParse].second ); lc_writer_char( & fsWriter, ' ' ); lc_writer_integer( & fsWriter, - fsRank[fsParse].first ); lc_writer_char( & fsWriter, '\n' );
+
+                            }
+
+                            /* Close output file */
+                            if ( lc_writer_close( & fsWriter ) == false ) {
+
+                                /* Display message */
+                                std::cerr << "Error : Unable to write output file" << std::endl;
+
+                            }
+
+                        /* Display message */
+                        } else { std::cerr << "Error : Unable to open output file" << std::endl; }
+
+                    /* Display message */
+                    } else { std::cerr << "Error : Unable to read query descriptors" << std::endl; }
+
+                    /* Close index */
+                    lc_ivfpq_close( & fsIndex );
+
+                /* Display message */
+                } else { std::cerr << "Error : Unable to open index" << std::endl; }
+
+            /* Display message */
+            } else { std::cerr << "Error : Invalid path specification" << std::endl; }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Query descriptors
+ */
+
+    bool fs_ivfpq_query( char const * const fsStore, int const fsIdent, char const * const fsDescfile, cv::Mat & fsDescript ) {
+
+        /* Store variables */
+        lc_Store_t fsFeature;
+
+        /* Descriptors file mapping variables */
+        lc_Map_t fsMap;
+
+        /* Descriptors variables */
+        std::vector < cv::KeyPoint > fsKey;
+        cv::Mat fsDesc;
+
+        /* Quantization scale variables */
+        float fsScale( 0.0 );
+
+        /* Reading status variables */
+        bool fsRead( false );
+
+        /* Check descriptors source */
+        if ( fsDescfile != NULL ) {
+
+            /* Map descriptors file */
+            fsDesc = lc_descfile_map( fsDescfile, & fsMap, & fsScale );
+
+            /* Check descriptors file */
+            if ( ( fsRead = ( fsDesc.empty() == false ) ) == true ) {
+
+                /* Convert descriptors - copied before unmapping */
+                if ( fsDesc.type() == CV_32FC1 ) fsDescript = fsDesc.clone(); else fsDesc.convertTo( fsDescript, CV_32FC1, 1.0 / fsScale );
+
+                /* Unmap descriptors file */
+                lc_map_close( & fsMap );
+
+            }
+
+        } else if ( lc_store_open( fsStore, & fsFeature ) == true ) {
+
+            /* Read image descriptors */
+            if ( ( fsRead = lc_store_read( & fsFeature, fsIdent, fsKey, fsDesc ) ) == true ) {
+
+                /* Convert descriptors - copied before store closure */
+                if ( fsDesc.type() == CV_32FC1 ) fsDescript = fsDesc.clone(); else fsDesc.convertTo( fsDescript, CV_32FC1, 1.0 / lc_store_scale( & fsFeature ) );
+
+            }
+
+            /* Close features store */
+            lc_store_close( & fsFeature );
+
+        }
+
+        /* Send message */
+        return( fsRead );
+
+    }
+
@@ -0,0 +1,178 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   feature-match-ivfpq.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *  
+     *  Software main header
+     */
+
+    /*! \mainpage feature-match-ivfpq
+     *
+     *  \section feature-suite
+     *  \section _ Features detection suite
+     *  
+     *  The feature-suite provides tools in the context of automatic image 
+     *  matching. The suite is separated into small softwares that solve a
+     *  specific part of the problem. It is designed so in order to perform 
+     *  research using each software as a brick of the overall solver.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/feature-suite/wiki.
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __FS_MATCH_IVFPQ__
+    # define __FS_MATCH_IVFPQ__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <vector>
+    # include <map>
+    # include <algorithm>
+    # include <cstdlib>
+    # include <common-all.hpp>
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define FS_HELP "Usage summary :\n\n"                   \
+    "\tfeature-match-ivfpq [Arguments] [Parameters] ...\n\n" \
+    "Short arguments and parameters summary :\n\n"           \
+    "\t-S\tInput features store\n"                           \
+    "\t-x\tIndex file\n"                                     \
+    "\t-t\tBuild index of the store\n"                       \
+    "\t-l\tAmount of inverted lists\n"                       \
+    "\t-m\tAmount of descriptors subspaces\n"                \
+    "\t-s\tTraining sample size\n"                           \
+    "\t-I\tStore identifier of query image\n"                \
+    "\t-p\tQuery descriptors file\n"                         \
+    "\t-o\tOutput images ranking file\n"                     \
+    "\t-r\tAmount of visited inverted lists\n"               \
+    "\t-n\tAmount of neighbours per descriptor\n"            \
+    "\t-k\tAmount of ranked images\n\n"                      \
+    "feature-match-ivfpq - feature-suite\n"                  \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Default amount of neighbours per descriptor */
+    # define FS_NEIGHBOUR   4
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function frame follows : parameters are initialized and read.
+     *  In building mode, the inverted file product quantization index of all
+     *  the descriptors of the features store is computed and written in the
+     *  index file. Otherwise, the descriptors of the query image are read,
+     *  from the store or from a descriptors file, and their nearest indexed
+     *  descriptors are searched through the mapped index. Each descriptor
+     *  votes once for each image found among its neighbours, the query image
+     *  excepted, and the images are exported by decreasing amount of votes,
+     *  one image identifier and its votes per line.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Query descriptors
+     *
+     *  This function obtains the floating point descriptors of the query
+     *  image, either from the features store or from a descriptors file.
+     *  Quantized descriptors are converted using their scale.
+     *
+     *  \param  fsStore     Path of the features store, NULL if not used
+     *  \param  fsIdent     Store identifier of the query image
+     *  \param  fsDescfile  Path of the descriptors file, NULL if not used
+     *  \param  fsDescript  Matrix receiving the descriptors
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_ivfpq_query ( char const * const fsStore, int const fsIdent, char const * const fsDescfile, cv::Mat & fsDescript );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
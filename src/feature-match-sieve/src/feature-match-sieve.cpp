@@ -53,29 +53,67 @@
         char * fsMatchfile( NULL );
         char * fsSievefile( NULL );
 
-        /* Reading variables */
-        int fsCount ( 0 );
+        /* Database variables */
+        char * fsDatabaseI( NULL );
+        char * fsDatabaseO( NULL );
+        char * fsImageA   ( NULL );
+        char * fsImageB   ( NULL );
+
+        /* Database structures */
+        lc_Database_t fsInput;
+        lc_Database_t fsOutput;
 
         /* Filters parameters */
         float fsStrength ( 1.0   );
         float fsMinimum  ( 10.0  );
         float fsMaximum  ( 100.0 );
 
-        /* Matches reading buffer */
-        fs_Match_t fsBuffer = { };
+        /* Chunk size variables */
+        int fsSize( FS_CHUNK );
+
+        /* Sieve mode variables */
+        int fsMode( FS_NONE );
+
+        /* Matches chunk variables */
+        std::vector < lc_Match_t > fsChunk;
+
+        /* Matchfile reader and writer variables */
+        lc_Matchreader_t fsReader;
+        lc_Matchwriter_t fsWriter;
+
+        /* Statistical quantities variables */
+        fs_Stat_t fsStat = { };
+
+        /* Reading status variables */
+        bool fsStatus( true );
 
-        /* Matches array variables */
-        std::vector < fs_Match_t > fsMatch;
+        /* Opening status variables */
+        bool fsOpen( false );
 
-        /* Stream variables */
-        std::fstream fsStream;
+        /* Matchfile format */
+        int fsFormat ( LC_FORMAT_TEXT );
 
         /* Arguments and parameters handle */
-        lc_stdp( lc_stda( argc, argv, "--input"   , "-i" ), argv, & fsMatchfile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--output"  , "-o" ), argv, & fsSievefile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--strength", "-s" ), argv, & fsStrength , LC_FLOAT  );
-        lc_stdp( lc_stda( argc, argv, "--minimum" , "-m" ), argv, & fsMinimum  , LC_FLOAT  );
-        lc_stdp( lc_stda( argc, argv, "--maximum" , "-a" ), argv, & fsMaximum  , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--input"     , "-i" ), argv, & fsMatchfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"    , "-o" ), argv, & fsSievefile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-i", "-I" ), argv, & fsDatabaseI, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--database-o", "-O" ), argv, & fsDatabaseO, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-a"    , "-A" ), argv, & fsImageA   , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--pair-b"    , "-B" ), argv, & fsImageB   , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--strength"  , "-s" ), argv, & fsStrength , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--minimum"   , "-m" ), argv, & fsMinimum  , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--maximum"   , "-a" ), argv, & fsMaximum  , LC_FLOAT  );
+        lc_stdp( lc_stda( argc, argv, "--chunk"     , "-c" ), argv, & fsSize     , LC_INT    );
+
+        /* Search in switches */
+        if ( lc_stda( argc, argv, "--binary", "-b" ) ) fsFormat = LC_FORMAT_BINARY;
+
+        /* Switch filters */
+        if      ( lc_stda( argc, argv, "--stat-dist", "-r" ) ) fsMode = FS_STAT_DIST;
+        else if ( lc_stda( argc, argv, "--thre-dist", "-t" ) ) fsMode = FS_THRE_DIST;
+        else if ( lc_stda( argc, argv, "--stat-disp", "-d" ) ) fsMode = FS_STAT_DISP;
+        else if ( lc_stda( argc, argv, "--stat-flow", "-f" ) ) fsMode = FS_STAT_FLOW;
+        else if ( lc_stda( argc, argv, "--dich-slop", "-l" ) ) fsMode = FS_DICH_SLOP;
 
         /* Software swicth */
         if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
@@ -85,88 +123,132 @@
 
         } else {
 
-            /* Verify path strings */
-            if ( ( fsMatchfile != NULL ) && ( fsSievefile != NULL ) ) {
+            /* Verify path strings, pair names and chunk size */
+            if ( ( ( fsMatchfile != NULL ) || ( fsDatabaseI != NULL ) ) && ( ( fsSievefile != NULL ) || ( fsDatabaseO != NULL ) ) && ( ( ( fsDatabaseI == NULL ) && ( fsDatabaseO == NULL ) ) || ( ( fsImageA != NULL ) && ( fsImageB != NULL ) ) ) && ( fsSize > 0 ) ) {
 
-                /* Open input stream */
-                fsStream.open( fsMatchfile, std::ios::in );
+                /* Check input matches source */
+                if ( fsDatabaseI != NULL ) {
 
-                /* Check stream openning */
-                if ( fsStream.is_open() == true ) {
+                    /* Open input database */
+                    if ( ( fsOpen = lc_database_open( fsDatabaseI, & fsInput, LC_DATABASE_READ ) ) == true ) {
 
-                    /* Read matches count */
-                    fsStream >> fsCount;
+                        /* Read input pair */
+                        fsOpen = lc_database_reader( & fsInput, fsImageA, fsImageB, & fsReader );
 
-                    /* Read matches coordinates */
-                    for ( int fsIndex( 0 ); fsIndex < fsCount; fsIndex ++ ) {
+                        /* Close input database */
+                        lc_database_close( & fsInput );
 
-                        /* Read matches coordinates */
-                        fsStream >> fsBuffer.ai >> fsBuffer.bi >> fsBuffer.ax >> fsBuffer.ay >> fsBuffer.bx >> fsBuffer.by; 
+                    }
 
-                        /* Push reading buffer */
-                        fsMatch.push_back( fsBuffer );
+                /* Open input matches */
+                } else { fsOpen = lc_matchreader_open( fsMatchfile, & fsReader ); }
 
-                    }
+                /* Check input matches */
+                if ( fsOpen == true ) {
 
-                    /* Close input stream */
-                    fsStream.close();
+                    /* Check output matches destination */
+                    if ( fsDatabaseO != NULL ) {
 
-                    /* Switch filters */
-                    if ( lc_stda( argc, argv, "--stat-dist", "-r" ) ) {
+                        /* Open output database and create pair writer */
+                        if ( ( fsOpen = lc_database_open( fsDatabaseO, & fsOutput, LC_DATABASE_WRITE ) ) == true ) lc_database_writer( & fsWriter );
 
-                        /* Statistical distance */
-                        fsMatch = fs_matchSIEVE_stat_dist( fsMatch, fsStrength );
+                    /* Create output matches */
+                    } else { fsOpen = lc_matchwriter_open( fsSievefile, & fsWriter, fsFormat ); }
 
-                    } else if ( lc_stda( argc, argv, "--thre-dist", "-t" ) ) {
+                    /* Check output matches */
+                    if ( fsOpen == true ) {
 
-                        /* Threshold distance */
-                        fsMatch = fs_matchSIEVE_thre_dist( fsMatch, fsMinimum, fsMaximum );
+                        /* Preserve input flags */
+                        fsWriter.flags = fsReader.flags;
 
-                    } else if ( lc_stda( argc, argv, "--stat-disp", "-d" ) ) {
+                        /* Statistical pass - threshold and copy need none */
+                        if ( ( fsMode != FS_NONE ) && ( fsMode != FS_THRE_DIST ) ) {
 
-                        /* Statistical displacement */
-                        fsMatch = fs_matchSIEVE_stat_disp( fsMatch, fsStrength );
+                            /* Accumulate statistical quantities */
+                            while ( ( ( fsStatus = lc_matchreader_chunk( & fsReader, fsChunk, fsSize ) ) == true ) && ( fsChunk.empty() == false ) ) {
 
-                    } else if ( lc_stda( argc, argv, "--stat-flow", "-f" ) ) {
+                                /* Switch filters */
+                                switch ( fsMode ) {
 
-                        /* Statistical displacement */
-                        fsMatch = fs_matchSIEVE_stat_flow( fsMatch, fsStrength );
+                                    /* Statistical distance */
+                                    case ( FS_STAT_DIST ) : { fs_matchSIEVE_stat_dist_accum( fsChunk, & fsStat ); } break;
 
-                    } else if ( lc_stda( argc, argv, "--dich-slop", "-l" ) ) {
+                                    /* Statistical displacement */
+                                    case ( FS_STAT_DISP ) : { fs_matchSIEVE_stat_disp_accum( fsChunk, & fsStat ); } break;
 
-                        /* Statistical displacement */
-                        fsMatch = fs_matchSIEVE_dich_slop( fsMatch );
+                                    /* Statistical flow */
+                                    case ( FS_STAT_FLOW ) : { fs_matchSIEVE_stat_flow_accum( fsChunk, & fsStat ); } break;
 
-                    }
+                                    /* Dichotomous slope */
+                                    case ( FS_DICH_SLOP ) : { fs_matchSIEVE_dich_slop_accum( fsChunk, & fsStat ); } break;
+
+                                }
+
+                            }
 
-                    /* Open output stream */
-                    fsStream.open( fsSievefile, std::ios::out );
+                            /* Compute statistical quantities */
+                            fs_matchSIEVE_stat( & fsStat );
 
-                    /* Check stream openning */
-                    if ( fsStream.is_open() == true ) {
+                            /* Rewind input matches */
+                            lc_matchreader_rewind( & fsReader );
 
-                        /* Export matches count */
-                        fsStream << fsMatch.size() << std::endl;
+                        }
+
+                        /* Sieve pass */
+                        while ( ( fsStatus == true ) && ( ( fsStatus = lc_matchreader_chunk( & fsReader, fsChunk, fsSize ) ) == true ) && ( fsChunk.empty() == false ) ) {
+
+                            /* Switch filters */
+                            switch ( fsMode ) {
+
+                                /* Statistical distance */
+                                case ( FS_STAT_DIST ) : { fsChunk = fs_matchSIEVE_stat_dist( fsChunk, & fsStat, fsStrength ); } break;
+
+                                /* Threshold distance */
+                                case ( FS_THRE_DIST ) : { fsChunk = fs_matchSIEVE_thre_dist( fsChunk, fsMinimum, fsMaximum ); } break;
+
+                                /* Statistical displacement */
+                                case ( FS_STAT_DISP ) : { fsChunk = fs_matchSIEVE_stat_disp( fsChunk, & fsStat, fsStrength ); } break;
 
-                        /* Export matches coordinates and index */
-                        for ( unsigned int fsIndex( 0 ); fsIndex < fsMatch.size(); fsIndex ++ ) {
+                                /* Statistical flow */
+                                case ( FS_STAT_FLOW ) : { fsChunk = fs_matchSIEVE_stat_flow( fsChunk, & fsStat, fsStrength ); } break;
 
-                            /* Export matches coordinates */
-                            fsStream << fsMatch[fsIndex].ai << " " 
-                                     << fsMatch[fsIndex].bi << " " 
-                                     << fsMatch[fsIndex].ax << " " 
-                                     << fsMatch[fsIndex].ay << " " 
-                                     << fsMatch[fsIndex].bx << " " 
-                                     << fsMatch[fsIndex].by << std::endl;
+                                /* Dichotomous slope */
+                                case ( FS_DICH_SLOP ) : { fsChunk = fs_matchSIEVE_dich_slop( fsChunk, & fsStat ); } break;
+
+                            }
+
+                            /* Export matches */
+                            lc_matchwriter_chunk( & fsWriter, fsChunk );
 
                         }
 
-                        /* Close output stream */
-                        fsStream.close();
+                        /* Close output matches */
+                        if ( lc_matchwriter_close( & fsWriter ) == false ) {
+
+                            /* Display message */
+                            std::cerr << "Error : Unable to write output file" << std::endl;
+
+                        } else if ( fsStatus == false ) {
+
+                            /* Display message */
+                            std::cerr << "Error : Unable to read input file" << std::endl;
+
+                        } else if ( ( fsDatabaseO != NULL ) && ( lc_database_commit( & fsOutput, fsImageA, fsImageB, & fsWriter ) == false ) ) {
+
+                            /* Display message */
+                            std::cerr << "Error : Unable to write output database" << std::endl;
+
+                        }
+
+                        /* Close output database */
+                        if ( fsDatabaseO != NULL ) lc_database_close( & fsOutput );
 
                     /* Display message */
                     } else { std::cerr << "Error : Unable to open output file" << std::endl; }
 
+                    /* Close input matches */
+                    lc_matchreader_close( & fsReader );
+
                 /* Display message */
                 } else { std::cerr << "Error : Unable to open input file" << std::endl; }
 
@@ -181,36 +263,63 @@
     }
 
 /*
-    Source - Statistical distance filter
+    Source - Statistical quantities computation
  */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_dist( std::vector < fs_Match_t > const fsRaw, float const fsStrength ) {
+    void fs_matchSIEVE_stat( fs_Stat_t * const fsStat ) {
 
-        /* Instance return variable */
-        std::vector < fs_Match_t > fsSieve;
+        /* Compute means */
+        fsStat->mx = ( float ) fsStat->sx / ( float ) fsStat->n;
+        fsStat->my = ( float ) fsStat->sy / ( float ) fsStat->n;
 
-        /* Instance distance vector */
-        std::vector < float > fsDist;
+        /* Compute standard deviations */
+        fsStat->dx = std::sqrt( ( float ) fsStat->qx / ( float ) fsStat->n - fsStat->mx * fsStat->mx );
+        fsStat->dy = std::sqrt( ( float ) fsStat->qy / ( float ) fsStat->n - fsStat->my * fsStat->my );
 
-        /* Statistical quantities variables */
-        float fsMean ( 0.0 );
-        float fsStdd ( 0.0 );
+    }
+
+/*
+    Source - Statistical distance accumulation
+ */
 
-        /* Compute distances */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ )
+    void fs_matchSIEVE_stat_dist_accum( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat ) {
 
-            /* Push current distance */
-            fsDist.push_back( FS_DIST( fsRaw[fsIndex] ) );
+        /* Accumulate distances */
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
+
+            /* Compute current distance */
+            float fsDist( FS_DIST( fsChunk[fsIndex] ) );
+
+            /* Accumulate sums */
+            fsStat->sx += fsDist;
+            fsStat->qx += fsDist * fsDist;
+
+        }
+
+        /* Update matches count */
+        fsStat->n += fsChunk.size();
+
+    }
+
+/*
+    Source - Statistical distance filter
+ */
 
-        /* Compute statistical quantities */
-        fsMean = LC_VMEAN( fsDist );
-        fsStdd = LC_VSTDD( fsDist, fsMean );
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_dist( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength ) {
+
+        /* Instance return variable */
+        std::vector < lc_Match_t > fsSieve;
 
         /* Statistical distance filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ )
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
+
+            /* Compute current distance */
+            float fsDist( FS_DIST( fsChunk[fsIndex] ) );
 
             /* Apply sieve */
-            if ( ( fsDist[fsIndex] - fsMean ) < fsStrength * fsStdd ) fsSieve.push_back( fsRaw[fsIndex] );
+            if ( ( fsDist - fsStat->mx ) < fsStrength * fsStat->dx ) fsSieve.push_back( fsChunk[fsIndex] );
+
+        }
 
         /* Return filtered matches */
         return( fsSieve );
@@ -221,17 +330,17 @@
     Source - Threshold distance filter
  */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_thre_dist( std::vector < fs_Match_t > const fsRaw, float const fsMininum, float const fsMaximum ) {
+    std::vector < lc_Match_t > fs_matchSIEVE_thre_dist( std::vector < lc_Match_t > const & fsChunk, float const fsMininum, float const fsMaximum ) {
 
         /* Instance return variable */
-        std::vector < fs_Match_t > fsSieve;
+        std::vector < lc_Match_t > fsSieve;
 
         /* Threshold distance filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ )
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ )
 
             /* Apply sieve */
-            if ( ( FS_DIST( fsRaw[fsIndex] ) > fsMininum ) && 
-                 ( FS_DIST( fsRaw[fsIndex] ) < fsMaximum ) ) fsSieve.push_back( fsRaw[fsIndex] );
+            if ( ( FS_DIST( fsChunk[fsIndex] ) > fsMininum ) && 
+                 ( FS_DIST( fsChunk[fsIndex] ) < fsMaximum ) ) fsSieve.push_back( fsChunk[fsIndex] );
 
         /* Return filtered matches */
         return( fsSieve );
@@ -239,45 +348,52 @@
     }
 
 /*
-    Source - Statistical displacement filter
+    Source - Statistical displacement accumulation
  */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_disp( std::vector < fs_Match_t > const fsRaw, float const fsStrength ) {
+    void fs_matchSIEVE_stat_disp_accum( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat ) {
 
-        /* Instance return variable */
-        std::vector < fs_Match_t > fsSieve;
+        /* Accumulate displacements */
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
 
-        /* Instance distance vector */
-        std::vector < float > fsDispX;
-        std::vector < float > fsDispY;
+            /* Compute current displacement */
+            float fsDispX( fabs( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx ) );
+            float fsDispY( fabs( fsChunk[fsIndex].ay - fsChunk[fsIndex].by ) );
 
-        /* Statistical quantities variables */
-        float fsMeanX ( 0.0 );
-        float fsMeanY ( 0.0 );
-        float fsStddX ( 0.0 );
-        float fsStddY ( 0.0 );
+            /* Accumulate sums */
+            fsStat->sx += fsDispX;
+            fsStat->sy += fsDispY;
+            fsStat->qx += fsDispX * fsDispX;
+            fsStat->qy += fsDispY * fsDispY;
 
-        /* Compute displacement */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ ) {
+        }
 
-            /* Push current distance */
-            fsDispX.push_back( fabs( fsRaw[fsIndex].ax - fsRaw[fsIndex].bx ) );
-            fsDispY.push_back( fabs( fsRaw[fsIndex].ay - fsRaw[fsIndex].by ) );
+        /* Update matches count */
+        fsStat->n += fsChunk.size();
 
-        }
+    }
 
-        /* Compute statistical quantities */
-        fsMeanX = LC_VMEAN( fsDispX );
-        fsMeanY = LC_VMEAN( fsDispY );
-        fsStddX = LC_VSTDD( fsDispX, fsMeanX );
-        fsStddY = LC_VSTDD( fsDispY, fsMeanY );
+/*
+    Source - Statistical displacement filter
+ */
+
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_disp( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength ) {
+
+        /* Instance return variable */
+        std::vector < lc_Match_t > fsSieve;
 
         /* Statistical distance filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ )
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
+
+            /* Compute current displacement */
+            float fsDispX( fabs( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx ) );
+            float fsDispY( fabs( fsChunk[fsIndex].ay - fsChunk[fsIndex].by ) );
 
             /* Apply sieve */
-            if ( ( ( fsDispX[fsIndex] - fsMeanX ) < fsStrength * fsStddX ) && 
-                 ( ( fsDispY[fsIndex] - fsMeanY ) < fsStrength * fsStddY ) ) fsSieve.push_back( fsRaw[fsIndex] );
+            if ( ( ( fsDispX - fsStat->mx ) < fsStrength * fsStat->dx ) && 
+                 ( ( fsDispY - fsStat->my ) < fsStrength * fsStat->dy ) ) fsSieve.push_back( fsChunk[fsIndex] );
+
+        }
 
         /* Return filtered matches */
         return( fsSieve );
@@ -285,45 +401,52 @@
     }
 
 /*
-    Source - Statistical flow filter
+    Source - Statistical flow accumulation
  */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_flow( std::vector < fs_Match_t > const fsRaw, float const fsStrength ) {
+    void fs_matchSIEVE_stat_flow_accum( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat ) {
 
-        /* Instance return variable */
-        std::vector < fs_Match_t > fsSieve;
+        /* Accumulate normalized displacements */
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
 
-        /* Instance distance vector */
-        std::vector < float > fsDispX;
-        std::vector < float > fsDispY;
+            /* Compute current normalized displacement */
+            float fsDispX( fabs( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx ) / FS_DIST( fsChunk[fsIndex] ) );
+            float fsDispY( fabs( fsChunk[fsIndex].ay - fsChunk[fsIndex].by ) / FS_DIST( fsChunk[fsIndex] ) );
 
-        /* Statistical quantities variables */
-        float fsMeanX ( 0.0 );
-        float fsMeanY ( 0.0 );
-        float fsStddX ( 0.0 );
-        float fsStddY ( 0.0 );
+            /* Accumulate sums */
+            fsStat->sx += fsDispX;
+            fsStat->sy += fsDispY;
+            fsStat->qx += fsDispX * fsDispX;
+            fsStat->qy += fsDispY * fsDispY;
 
-        /* Compute displacement */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ ) {
+        }
 
-            /* Push current distance */
-            fsDispX.push_back( fabs( fsRaw[fsIndex].ax - fsRaw[fsIndex].bx ) / FS_DIST( fsRaw[fsIndex] ) );
-            fsDispY.push_back( fabs( fsRaw[fsIndex].ay - fsRaw[fsIndex].by ) / FS_DIST( fsRaw[fsIndex] ) );
+        /* Update matches count */
+        fsStat->n += fsChunk.size();
 
-        }
+    }
+
+/*
+    Source - Statistical flow filter
+ */
+
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_flow( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength ) {
 
-        /* Compute statistical quantities */
-        fsMeanX = LC_VMEAN( fsDispX );
-        fsMeanY = LC_VMEAN( fsDispY );
-        fsStddX = LC_VSTDD( fsDispX, fsMeanX );
-        fsStddY = LC_VSTDD( fsDispY, fsMeanY );
+        /* Instance return variable */
+        std::vector < lc_Match_t > fsSieve;
 
         /* Statistical distance filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ )
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
+
+            /* Compute current normalized displacement */
+            float fsDispX( fabs( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx ) / FS_DIST( fsChunk[fsIndex] ) );
+            float fsDispY( fabs( fsChunk[fsIndex].ay - fsChunk[fsIndex].by ) / FS_DIST( fsChunk[fsIndex] ) );
 
             /* Apply sieve */
-            if ( ( ( fsDispX[fsIndex] - fsMeanX ) < fsStrength * fsStddX ) && 
-                 ( ( fsDispY[fsIndex] - fsMeanY ) < fsStrength * fsStddY ) ) fsSieve.push_back( fsRaw[fsIndex] );
+            if ( ( ( fsDispX - fsStat->mx ) < fsStrength * fsStat->dx ) && 
+                 ( ( fsDispY - fsStat->my ) < fsStrength * fsStat->dy ) ) fsSieve.push_back( fsChunk[fsIndex] );
+
+        }
 
         /* Return filtered matches */
         return( fsSieve );
@@ -331,44 +454,47 @@
     }
 
 /*
-    Source - Dichotomous slope filter
+    Source - Dichotomous slope accumulation
  */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_dich_slop( std::vector < fs_Match_t > const fsRaw ) {
+    void fs_matchSIEVE_dich_slop_accum( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat ) {
 
-        /* Instance return variable */
-        std::vector < fs_Match_t > fsSieve;
+        /* Accumulate differentials */
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
 
-        /* Instance differentials */
-        std::vector < float > fsDiffX;
-        std::vector < float > fsDiffY;
+            /* Accumulate sums */
+            fsStat->sx += ( float ) ( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx );
+            fsStat->sy += ( float ) ( fsChunk[fsIndex].ay - fsChunk[fsIndex].by );
 
-        /* Statistical variables */
-        int fsMeanX ( 0.0 );
-        int fsMeanY ( 0.0 );
+        }
 
-        /* Compute dichotomous filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ ) {
+        /* Update matches count */
+        fsStat->n += fsChunk.size();
 
-            /* Push differentials */
-            fsDiffX.push_back( fsRaw[fsIndex].ax - fsRaw[fsIndex].bx );
-            fsDiffY.push_back( fsRaw[fsIndex].ay - fsRaw[fsIndex].by );
+    }
 
-        }
+/*
+    Source - Dichotomous slope filter
+ */
+
+    std::vector < lc_Match_t > fs_matchSIEVE_dich_slop( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat ) {
+
+        /* Instance return variable */
+        std::vector < lc_Match_t > fsSieve;
 
         /* Compute differential mean signs */
-        fsMeanX = LC_SIGN( LC_VMEAN( fsDiffX ) );
-        fsMeanY = LC_SIGN( LC_VMEAN( fsDiffY ) );
+        int fsMeanX( LC_SIGN( fsStat->mx ) );
+        int fsMeanY( LC_SIGN( fsStat->my ) );
 
         /* Dichotomous slope filter */
-        for ( unsigned int fsIndex( 0 ); fsIndex < fsRaw.size(); fsIndex ++ ) {
+        for ( unsigned int fsIndex( 0 ); fsIndex < fsChunk.size(); fsIndex ++ ) {
 
             /* Apply sieve */
-            if ( ( LC_SIGN( fsDiffX[fsIndex] ) == fsMeanX ) && 
-                 ( LC_SIGN( fsDiffY[fsIndex] ) == fsMeanY ) ) {
+            if ( ( LC_SIGN( fsChunk[fsIndex].ax - fsChunk[fsIndex].bx ) == fsMeanX ) && 
+                 ( LC_SIGN( fsChunk[fsIndex].ay - fsChunk[fsIndex].by ) == fsMeanY ) ) {
 
                 /* Sieve passed */
-                fsSieve.push_back( fsRaw[fsIndex] );
+                fsSieve.push_back( fsChunk[fsIndex] );
 
             }
 
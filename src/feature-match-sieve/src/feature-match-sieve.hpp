@@ -105,6 +105,12 @@
     "Short arguments and parameters summary :\n\n"           \
     "\t-i\tInput matches file\n"                             \
     "\t-o\tOutput matches file\n"                            \
+    "\t-I\tInput matches database\n"                         \
+    "\t-O\tOutput matches database\n"                        \
+    "\t-A\tDatabase pair first image name\n"                 \
+    "\t-B\tDatabase pair second image name\n"                \
+    "\t-b\tBinary matches file format\n"                     \
+    "\t-c\tMatches chunk size\n"                             \
     "\t-s\tSieve parameter : strenght\n"                     \
     "\t-m\tSieve parameter : minimum\n"                      \
     "\t-a\tSieve parameter : maximum\n"                      \
@@ -116,6 +122,17 @@
     "feature-match-sieve - feature-suite\n"                  \
     "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
 
+    /* Default matches chunk size */
+    # define FS_CHUNK       65536
+
+    /* Define sieve modes */
+    # define FS_NONE        0
+    # define FS_STAT_DIST   1
+    # define FS_THRE_DIST   2
+    # define FS_STAT_DISP   3
+    # define FS_STAT_FLOW   4
+    # define FS_DICH_SLOP   5
+
 /* 
     Header - Preprocessor macros
  */
@@ -131,35 +148,47 @@
     Header - Structures
  */
 
-    /*! \struct fs_Match_struct
-     *  \brief Match structure
-     *  
-     *  Structure that stores the description of a match between two keypoints.
-     *  
-     *  \var fs_Match_struct::ai
-     *  Index of the first keypoint in the keypoints list
-     *  \var fs_Match_struct::ax
-     *  Position x of the keypoint on the first image
-     *  \var fs_Match_struct::ay 
-     *  Position y of the keypoint on the first image
-     *  \var fs_Match_struct::bi 
-     *  Index of the second keypoint in the keypoints list
-     *  \var fs_Match_struct::bx
-     *  Position x of the keypoint on the second image
-     *  \var fs_Match_struct::by 
-     *  Position z of the keypoint on the second image
+    /*! \struct fs_Stat_struct
+     *  \brief Statistical quantities structure
+     *
+     *  Structure that accumulates the sums required by the statistical sieves
+     *  during the first pass on the matches. The means and standard deviations
+     *  are computed from the sums before the second pass, in which the sieve
+     *  is applied.
+     *
+     *  \var fs_Stat_struct::sx
+     *  Sum of the first quantity
+     *  \var fs_Stat_struct::sy
+     *  Sum of the second quantity
+     *  \var fs_Stat_struct::qx
+     *  Sum of the squared first quantity
+     *  \var fs_Stat_struct::qy
+     *  Sum of the squared second quantity
+     *  \var fs_Stat_struct::n
+     *  Amount of accumulated matches
+     *  \var fs_Stat_struct::mx
+     *  Mean of the first quantity
+     *  \var fs_Stat_struct::my
+     *  Mean of the second quantity
+     *  \var fs_Stat_struct::dx
+     *  Standard deviation of the first quantity
+     *  \var fs_Stat_struct::dy
+     *  Standard deviation of the second quantity
      */
 
-    typedef struct fs_Match_struct {
+    typedef struct fs_Stat_struct {
 
-        int   ai;
-        float ax;
-        float ay;
-        int   bi;
-        float bx;
-        float by;
+        double sx;
+        double sy;
+        double qx;
+        double qy;
+        size_t n;
+        float  mx;
+        float  my;
+        float  dx;
+        float  dy;
 
-    } fs_Match_t;
+    } fs_Stat_t;
 
 /* 
     Header - Function prototypes
@@ -168,9 +197,11 @@
     /*! \brief Software main function
      *  
      *  The main function frame follows : parameters are initialized and read. 
-     *  The matches file is read and the desired sieve is applied according to 
-     *  parameters. The matches that passed the sieve are then exported in the 
-     *  output matches file.
+     *  The matches file is read chunk by chunk. For the statistical sieves, a
+     *  first pass accumulates the statistical quantities of the matches. The
+     *  desired sieve is then applied on each chunk during a second pass and
+     *  the matches that passed the sieve are streamed in the output matches
+     *  file. The memory usage is then independent of the matches count.
      *  
      *  \param argc Standard main parameter
      *  \param argv Standard main parameter
@@ -178,63 +209,120 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Statistical quantities computation
+     *
+     *  This function computes the means and standard deviations of the two
+     *  quantities from the sums accumulated during the first pass.
+     *
+     *  \param  fsStat      Statistical quantities structure
+     */
+
+    void fs_matchSIEVE_stat ( fs_Stat_t * const fsStat );
+
+    /*! \brief Statistical distance accumulation
+     *
+     *  This function accumulates the sums of the disparity of the provided
+     *  chunk of matches.
+     *
+     *  \param  fsChunk     Chunk of matches
+     *  \param  fsStat      Statistical quantities structure
+     */
+
+    void fs_matchSIEVE_stat_dist_accum ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat );
+
     /*! \brief Statistical distance sieve
      *  
-     *  This function compute the disparity of the input matches and extract the
-     *  statistical quantities of it. The sieve is applied according to those
-     *  quantities and the standard deviation tolerence factor. The smaller is
-     *  this factor, the more strict is the sieve.
+     *  This function applies the sieve on the disparity of the input matches
+     *  according to its statistical quantities and the standard deviation
+     *  tolerence factor. The smaller is this factor, the more strict is the
+     *  sieve.
      *  
-     *  \param  fsRaw       Raw matches
+     *  \param  fsChunk     Chunk of raw matches
+     *  \param  fsStat      Statistical quantities of the disparity
      *  \param  fsStrength  Standard deviation tolerence factor
      *  
      *  \return Returns matches that passed the sieve
      */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_dist ( std::vector < fs_Match_t > const fsRaw, float const fsStrength );
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_dist ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength );
 
     /*! \brief Threshold distance sieve
      *  
      *  This function filter the matches by removing the ones that have a 
      *  disparity outside of the range defined by the minimum and maximum 
-     *  parameters.
+     *  parameters. It requires no statistical pass.
      *  
-     *  \param  fsRaw       Raw matches
+     *  \param  fsChunk     Chunk of raw matches
      *  \param  fsMininum   Minimum disparity threshold
      *  \param  fsMaximum   Maximum disparity threshold
      *
      *  \return Returns matches that passed the sieve
      */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_thre_dist ( std::vector < fs_Match_t > const fsRaw, float const fsMininum, float const fsMaximum );
+    std::vector < lc_Match_t > fs_matchSIEVE_thre_dist ( std::vector < lc_Match_t > const & fsChunk, float const fsMininum, float const fsMaximum );
+
+    /*! \brief Statistical displacement accumulation
+     *
+     *  This function accumulates the sums of the x and y components of the
+     *  disparity of the provided chunk of matches.
+     *
+     *  \param  fsChunk     Chunk of matches
+     *  \param  fsStat      Statistical quantities structure
+     */
+
+    void fs_matchSIEVE_stat_disp_accum ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat );
 
     /*! \brief Statistical displacement sieve
      *  
-     *  This function compute the statistical quantities of the x and y 
-     *  components of the disparity. The sieve criteria is based on distribution
-     *  standard deviations and the tolerence factor.
+     *  This function applies the sieve on the x and y components of the
+     *  disparity. The sieve criteria is based on distribution standard
+     *  deviations and the tolerence factor.
      *  
-     *  \param  fsRaw       Raw matches
+     *  \param  fsChunk     Chunk of raw matches
+     *  \param  fsStat      Statistical quantities of the components
      *  \param  fsStrength  Standard deviation tolerence factor
      *
      *  \return Returns matches that passed the sieve
      */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_disp ( std::vector < fs_Match_t > const fsRaw, float const fsStrength );
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_disp ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength );
+
+    /*! \brief Statistical flow accumulation
+     *
+     *  This function accumulates the sums of the normalized x and y components
+     *  of the disparity of the provided chunk of matches.
+     *
+     *  \param  fsChunk     Chunk of matches
+     *  \param  fsStat      Statistical quantities structure
+     */
+
+    void fs_matchSIEVE_stat_flow_accum ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat );
 
     /*! \brief Statistical flow sieve
      *  
-     *  This function compute the statistical quantities of the normalized x and
-     *  y components of the disparity. The sieve criteria is based on standard 
-     *  deviations of distribution and the tolerence factor.
+     *  This function applies the sieve on the normalized x and y components
+     *  of the disparity. The sieve criteria is based on standard deviations of
+     *  distribution and the tolerence factor.
      *  
-     *  \param  fsRaw       Raw matches
+     *  \param  fsChunk     Chunk of raw matches
+     *  \param  fsStat      Statistical quantities of the components
      *  \param  fsStrength  Standard deviation tolerence factor
      *
      *  \return Returns matches that passed the sieve
      */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_stat_flow ( std::vector < fs_Match_t > const fsRaw, float const fsStrength );
+    std::vector < lc_Match_t > fs_matchSIEVE_stat_flow ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat, float const fsStrength );
+
+    /*! \brief Dichotomous slop accumulation
+     *
+     *  This function accumulates the sums of the x and y differentials of the
+     *  provided chunk of matches.
+     *
+     *  \param  fsChunk     Chunk of matches
+     *  \param  fsStat      Statistical quantities structure
+     */
+
+    void fs_matchSIEVE_dich_slop_accum ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t * const fsStat );
 
     /*! \brief Dichotomous slop sieve
      *  
@@ -242,12 +330,13 @@
      *  The matches that have the same slope as the statistically most 
      *  represented one are kept.
      *  
-     *  \param  fsRaw   Raw matches
+     *  \param  fsChunk     Chunk of raw matches
+     *  \param  fsStat      Statistical quantities of the differentials
      *
      *  \return Returns matches that passed the sieve
      */
 
-    std::vector < fs_Match_t > fs_matchSIEVE_dich_slop ( std::vector < fs_Match_t > const fsRaw );
+    std::vector < lc_Match_t > fs_matchSIEVE_dich_slop ( std::vector < lc_Match_t > const & fsChunk, fs_Stat_t const * const fsStat );
 
 /*
     Header - Include guard
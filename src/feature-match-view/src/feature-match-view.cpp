@@ -55,19 +55,8 @@
         char * fsMatIPath( NULL );
         char * fsImgOPath( NULL );
 
-        /* Keypoint matrix size */
-        int fsRows ( 0 );
-
-        /* Keypoint coordinates */
-        float fsKeyAI ( 0.0 );
-        float fsKeyAX ( 0.0 );
-        float fsKeyAY ( 0.0 );
-        float fsKeyBI ( 0.0 );
-        float fsKeyBX ( 0.0 );
-        float fsKeyBY ( 0.0 );
-
-        /* Input stream */
-        std::ifstream fsMatchfile;
+        /* Matches array */
+        std::vector < lc_Match_t > fsMatch;
 
         /* Image variable */
         cv::Mat fsInputA;
@@ -107,29 +96,17 @@
                     /* Create composite image by channel mixing */
                     cv::mixChannels( fsMixArray, 2, & fsOutput, 1, fsMixParam, 2 );
 
-                    /* Open keypoint output file */
-                    fsMatchfile.open( fsMatIPath, std::ios::in );
-
-                    /* Verify stream state */
-                    if ( fsMatchfile.is_open() == true ) {
+                    /* Import matches */
+                    if ( lc_matchfile_read( fsMatIPath, fsMatch, NULL ) == true ) {
 
-                        /* Read keypoint matrix size */
-                        fsMatchfile >> fsRows;
-
-                        /* Export results */
-                        for ( int fsIndex( 0 ); fsIndex < fsRows; fsIndex ++ ) {
-
-                            /* Read current keypoint */
-                            fsMatchfile >> fsKeyAI >> fsKeyBI >> fsKeyAX >> fsKeyAY >> fsKeyBX >> fsKeyBY;
+                        /* Draw matches */
+                        for ( unsigned int fsIndex( 0 ); fsIndex < fsMatch.size(); fsIndex ++ ) {
 
                             /* Draw match line */
-                            cv::line( fsOutput, cv::Point2f( fsKeyAX, fsKeyAY ), cv::Point( fsKeyBX, fsKeyBY ), cv::Scalar( 0, 177, 235 ) );
+                            cv::line( fsOutput, cv::Point2f( fsMatch[fsIndex].ax, fsMatch[fsIndex].ay ), cv::Point( fsMatch[fsIndex].bx, fsMatch[fsIndex].by ), cv::Scalar( 0, 177, 235 ) );
 
                         }
 
-                        /* Close output stream */
-                        fsMatchfile.close();
-
                         /* Write result image */
                         if ( imwrite( fsImgOPath, fsOutput ) == false ) {
 
@@ -0,0 +1,219 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+/* 
+    Source - Includes
+ */
+
+    # include "feature-match-vocabulary.hpp"
+
+/*
+    Source - Entry point
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Path variables */
+        char * fsStore     ( NULL );
+        char * fsOutputfile( NULL );
+        char * fsVocabulary( NULL );
+
+        /* Vocabulary parameters variables */
+        int          fsBranch( LC_VOCABULARY_BRANCH );
+        int          fsDepth ( LC_VOCABULARY_DEPTH  );
+        unsigned int fsSample( LC_VOCABULARY_SAMPLE );
+
+        /* Ranking parameters variables */
+        int fsCount( FS_COUNT );
+
+        /* Store variables */
+        lc_Store_t fsFeature;
+
+        /* Vocabulary variables */
+        lc_Vocabulary_t fsTree;
+
+        /* Images variables */
+        std::vector < cv::KeyPoint > fsKey;
+        cv::Mat fsDesc;
+        cv::Mat fsFloat;
+
+        /* Visual words variables */
+        std::vector < uint32_t > fsIdent;
+        std::vector < std::vector < uint32_t > > fsWord;
+
+        /* Ranking variables */
+        std::vector < std::vector < std::pair < float, int > > > fsRank;
+
+        /* Exported pairs variables */
+        std::set < std::pair < uint32_t, uint32_t > > fsPair;
+
+        /* Output variables */
+        lc_Writer_t fsWriter;
+
+        /* Arguments and parameters handle */
+        lc_stdp( lc_stda( argc, argv, "--store"     , "-S" ), argv, & fsStore     , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"    , "-o" ), argv, & fsOutputfile, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--vocabulary", "-v" ), argv, & fsVocabulary, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--branch"    , "-b" ), argv, & fsBranch    , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--depth"     , "-d" ), argv, & fsDepth     , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--sample"    , "-s" ), argv, & fsSample    , LC_UINT   );
+        lc_stdp( lc_stda( argc, argv, "--count"     , "-k" ), argv, & fsCount     , LC_INT    );
+
+        /* Software swicth */
+        if ( ( lc_stda( argc, argv, "--help", "-h" ) ) || ( argc <= 1 ) ) {
+
+            /* Display message */
+            std::cout << FS_HELP;
+
+        } else {
+
+            /* Verify path strings */
+            if ( ( fsStore != NULL ) && ( fsOutputfile != NULL ) ) {
+
+                /* Open features store */
+                if ( lc_store_open( fsStore, & fsFeature ) == true ) {
+
+                    /* Obtain vocabulary tree */
+                    if ( fs_vocabulary_tree( & fsFeature, fsVocabulary, fsBranch, fsDepth, fsSample, & fsTree ) == true ) {
+
+                        /* Quantize store images */
+                        for ( uint32_t fsImage( 0 ); fsImage < lc_store_slots( & fsFeature ); fsImage ++ ) {
+
+                            /* Read image descriptors */
+                            if ( lc_store_read( & fsFeature, fsImage, fsKey, fsDesc ) == false ) continue;
+
+                            /* Convert descriptors */
+                            lc_store_float( & fsFeature, fsDesc, fsFloat );
+
+                            /* Push image */
+                            fsIdent.push_back( fsImage ), fsWord.push_back( std::vector < uint32_t > () );
+
+                            /* Quantize descriptors on visual words */
+                            if ( fsFloat.cols == fsTree.node.cols ) lc_vocabulary_quantize( & fsTree, fsFloat, fsWord.back() );
+
+                        }
+
+                        /* Rank images by similarity */
+                        lc_vocabulary_rank( fsWord, lc_vocabulary_words( & fsTree ), fsCount, fsRank );
+
+                        /* Create output file */
+                        if ( lc_writer_open( fsOutputfile, & fsWriter ) == true ) {
+
+                            /* Export pairs */
+                            for ( size_t fsParse( 0 ); fsParse < fsRank.size(); fsParse ++ ) {
+
+                                /* Export pairs of image */
+                                for ( size_t fsNear( 0 ); fsNear < fsRank[fsParse].size(); fsNear ++ ) {
+
+                                    /* Compose pair - lower identifier first */
+                                    std::pair < uint32_t, uint32_t > fsItem( std::minmax( fsIdent[fsParse], fsIdent[fsRank[fsParse][fsNear].second] ) );
+
+                                    /* Check exported pairs */
+                                    if ( fsPair.insert( fsItem ).second == false ) continue;
+
+                                    /* Export pair */
+                                    lc_writer_integer( & fsWriter, fsItem.first ); lc_writer_char( & fsWriter, ' ' ); lc_writer_integer( & fsWriter, fsItem.second ); lc_writer_char( & fsWriter, '\n' );
+
+                                }
+
+                            }
+
+                            /* Close output file */
+                            if ( lc_writer_close( & fsWriter ) == false ) {
+
+                                /* Display message */
+                                std::cerr << "Error : Unable to write output file" << std::endl;
+
+                            }
+
+                        /* Display message */
+                        } else { std::cerr << "Error : Unable to open output file" << std::endl; }
+
+                    /* Display message */
+                    } else { std::cerr << "Error : Unable to obtain vocabulary" << std::endl; }
+
+                    /* Close features store */
+                    lc_store_close( & fsFeature );
+
+                /* Display message */
+                } else { std::cerr << "Error : Unable to open features store" << std::endl; }
+
+            /* Display message */
+            } else { std::cerr << "Error : Invalid path specification" << std::endl; }
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Vocabulary tree
+ */
+
+    bool fs_vocabulary_tree( lc_Store_t const * const fsStore, char const * const fsPath, int const fsBranch, int const fsDepth, unsigned int const fsSample, lc_Vocabulary_t * const fsTree ) {
+
+        /* Training variables */
+        cv::Mat fsTrain;
+
+        /* Descriptors count variables */
+        uint64_t fsTotal( 0 );
+
+        /* Read vocabulary file */
+        if ( ( fsPath != NULL ) && ( lc_vocabulary_read( fsPath, fsTree ) == true ) ) return( true );
+
+        /* Compose training sample */
+        if ( lc_store_sample( fsStore, fsSample, fsTrain, & fsTotal ) == false ) return( false );
+
+        /* Train vocabulary tree */
+        if ( lc_vocabulary_train( fsTrain, fsBranch, fsDepth, fsTree ) == false ) return( false );
+
+        /* Write vocabulary file */
+        if ( ( fsPath != NULL ) && ( lc_vocabulary_write( fsPath, fsTree ) == false ) ) {
+
+            /* Display message */
+            std::cerr << "Error : Unable to write vocabulary file" << std::endl;
+
+        }
+
+        /* Send message */
+        return( true );
+
+    }
+
@@ -0,0 +1,175 @@
+/*
+ * feature suite - Feature detection suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   feature-match-vocabulary.hpp
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *  
+     *  Software main header
+     */
+
+    /*! \mainpage feature-match-vocabulary
+     *
+     *  \section feature-suite
+     *  \section _ Features detection suite
+     *  
+     *  The feature-suite provides tools in the context of automatic image 
+     *  matching. The suite is separated into small softwares that solve a
+     *  specific part of the problem. It is designed so in order to perform 
+     *  research using each software as a brick of the overall solver.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/feature-suite/wiki.
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __FS_MATCH_VOCABULARY__
+    # define __FS_MATCH_VOCABULARY__
+
+/* 
+    Header - Includes
+ */
+
+    # include <iostream>
+    # include <vector>
+    # include <set>
+    # include <algorithm>
+    # include <cstdlib>
+    # include <common-all.hpp>
+    # include <opencv2/opencv.hpp>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define FS_HELP "Usage summary :\n\n"                        \
+    "\tfeature-match-vocabulary [Arguments] [Parameters] ...\n\n" \
+    "Short arguments and parameters summary :\n\n"                \
+    "\t-S\tInput features store\n"                                \
+    "\t-o\tOutput pairs file\n"                                   \
+    "\t-v\tVocabulary file\n"                                     \
+    "\t-b\tVocabulary tree branching factor\n"                    \
+    "\t-d\tVocabulary tree depth\n"                               \
+    "\t-s\tTraining sample size\n"                                \
+    "\t-k\tAmount of similar images per image\n\n"                \
+    "feature-match-vocabulary - feature-suite\n"                  \
+    "Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch\n"
+
+    /* Default amount of similar images */
+    # define FS_COUNT       8
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function frame follows : parameters are initialized and read.
+     *  The vocabulary tree is read from the vocabulary file or trained on a
+     *  sample of the features store descriptors, and then saved if a file is
+     *  specified. The descriptors of each image of the store are quantized
+     *  on visual words and the images are ranked by TF-IDF similarity using
+     *  an inverted file. The pairs made of each image and its most similar
+     *  images are exported, one pair of store identifiers per line, each pair
+     *  being exported once, lower identifier first. The pairs file drives the
+     *  match tools through their store identifiers.
+     *  
+     *  \param argc Standard main parameter
+     *  \param argv Standard main parameter
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Vocabulary tree
+     *
+     *  This function reads the vocabulary tree from the specified file. If
+     *  the file is not specified or can not be read, the tree is trained on a
+     *  sample of the store descriptors and written in the file, if specified.
+     *
+     *  \param  fsStore     Features store structure
+     *  \param  fsPath      Path of the vocabulary file, NULL if not used
+     *  \param  fsBranch    Branching factor of the tree
+     *  \param  fsDepth     Depth of the tree
+     *  \param  fsSample    Maximum amount of training descriptors
+     *  \param  fsTree      Vocabulary structure to initialize
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    bool fs_vocabulary_tree ( lc_Store_t const * const fsStore, char const * const fsPath, int const fsBranch, int const fsDepth, unsigned int const fsSample, lc_Vocabulary_t * const fsTree );
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+